@@ -30,6 +30,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Full attribute set with change tracking.}
 @revs_end
 
 */
@@ -60,11 +61,38 @@ class DynamicalEntity : public SpaceFOM::PhysicalEntityBase
    DynamicalEntity();          // Default constructor.
    virtual ~DynamicalEntity(); // Destructor.
 
+   // Default data.
+   /*! @brief Sets up the attributes for a dynamical entity using default values.
+    *  @param mngr_object TrickHLA::Object associated with this entity.
+    *  @param sim_obj_name Name of SimObject containing this entity.
+    *  @param entity_obj_name Name of the entity object in the SimObject.
+    *  @param entity_name Name of the entity instance.
+    *  @param parent_ref_frame_name Name of the parent reference frame.
+    *  @param publishes Does this federate publish this entity. */
+   virtual void default_data( TrickHLA::Object *mngr_object,
+                              char const       *sim_obj_name,
+                              char const       *entity_obj_name,
+                              char const       *entity_name,
+                              char const       *parent_ref_frame_name,
+                              bool              publishes );
+
+   /*! @brief Initialization callback as part of the TrickHLA::Packing functions.
+    *  @param obj Object associated with this packing class. */
+   virtual void initialize_callback( TrickHLA::Object *obj );
+
    // Data pack and unpack routines.
    virtual void pack();
    virtual void unpack();
 
   protected:
+   /*! @brief Get the number of attributes default_data() sets up.
+    *  @return Number of attributes. */
+   virtual unsigned int const get_default_attribute_count() const
+   {
+      return 15;
+   }
+
+
    double force[3];           ///< @trick_units{N} Total external force on vehicle applied
                               ///       through the vehicle center of mass.
                               ///       Expressed in the vehicle struct frame.
@@ -75,6 +103,11 @@ class DynamicalEntity : public SpaceFOM::PhysicalEntityBase
    double inertia[3][3];      /// trick_units{kg*m2} Inertia matrix in element body frame.
    double inertia_rate[3][3]; /// @trick_units{kg*m2/s} Inertia matrix in element body frame.
 
+   double prev_mass;               ///< @trick_io{**} Last packed mass.
+   double prev_mass_rate;          ///< @trick_io{**} Last packed mass rate.
+   double prev_inertia[3][3];      ///< @trick_io{**} Last packed inertia matrix.
+   double prev_inertia_rate[3][3]; ///< @trick_io{**} Last packed inertia rate matrix.
+
   private:
    // This object is not copyable
    DynamicalEntity( DynamicalEntity const & );
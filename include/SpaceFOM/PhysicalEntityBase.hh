@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @python_module{SpaceFOM}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
 @trick_link_dependency{../../source/TrickHLA/OpaqueBuffer.cpp}
 @trick_link_dependency{../../source/TrickHLA/Packing.cpp}
 @trick_link_dependency{../../source/SpaceFOM/PhysicalEntityBase.cpp}
@@ -33,6 +34,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Full attribute set with change tracking.}
 @revs_end
 
 */
@@ -41,10 +43,13 @@ NASA, Johnson Space Center\n
 #define SPACEFOM_PHYSICAL_ENTITY_BASE_HH
 
 // System include files.
+#include <string>
 
 // TrickHLA include files.
+#include "TrickHLA/Conditional.hh"
 #include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/Packing.hh"
+#include "TrickHLA/Types.hh"
 
 // SpaceFOM include files.
 #include "SpaceFOM/QuaternionEncoder.hh"
@@ -52,6 +57,9 @@ NASA, Johnson Space Center\n
 
 namespace TrickHLA
 {
+class Attribute;
+class Conditional;
+class Object;
 class Packing;
 class OpaqueBuffer;
 } // namespace TrickHLA
@@ -59,7 +67,29 @@ class OpaqueBuffer;
 namespace SpaceFOM
 {
 
-class PhysicalEntityBase : public TrickHLA::Packing, public TrickHLA::OpaqueBuffer
+/*!
+ * @brief Index of the PhysicalEntity and DynamicalEntity attributes that are
+ * only sent when their value changes.
+ */
+typedef enum {
+
+   PHYSICAL_ENTITY_TRACKED_NAME             = 0, ///< Entity name.
+   PHYSICAL_ENTITY_TRACKED_TYPE             = 1, ///< Entity type.
+   PHYSICAL_ENTITY_TRACKED_STATUS           = 2, ///< Entity status.
+   PHYSICAL_ENTITY_TRACKED_PARENT_REF_FRAME = 3, ///< Entity parent reference frame.
+   PHYSICAL_ENTITY_TRACKED_CENTER_OF_MASS   = 4, ///< Center of mass.
+   PHYSICAL_ENTITY_TRACKED_BODY_WRT_STRUCT  = 5, ///< Body wrt. structural attitude.
+   PHYSICAL_ENTITY_TRACKED_MASS             = 6, ///< DynamicalEntity mass.
+   PHYSICAL_ENTITY_TRACKED_MASS_RATE        = 7, ///< DynamicalEntity mass rate.
+   PHYSICAL_ENTITY_TRACKED_INERTIA          = 8, ///< DynamicalEntity inertia.
+   PHYSICAL_ENTITY_TRACKED_INERTIA_RATE     = 9, ///< DynamicalEntity inertia rate.
+   PHYSICAL_ENTITY_TRACKED_COUNT            = 10 ///< Number of tracked attributes.
+
+} PhysicalEntityTrackedEnum;
+
+class PhysicalEntityBase : public TrickHLA::Packing,
+                           public TrickHLA::OpaqueBuffer,
+                           public TrickHLA::Conditional
 {
    // Let the Trick input processor access protected and private data.
    // InputProcessor is really just a marker class (does not really
@@ -76,9 +106,39 @@ class PhysicalEntityBase : public TrickHLA::Packing, public TrickHLA::OpaqueBuff
    PhysicalEntityBase();          // Default constructor.
    virtual ~PhysicalEntityBase(); // Destructor.
 
+   // Default data.
+   /*! @brief Sets up the attributes for a physical entity using default values.
+    *  @param mngr_object TrickHLA::Object associated with this entity.
+    *  @param sim_obj_name Name of SimObject containing this entity.
+    *  @param entity_obj_name Name of the entity object in the SimObject.
+    *  @param entity_name Name of the entity instance.
+    *  @param parent_ref_frame_name Name of the parent reference frame.
+    *  @param publishes Does this federate publish this entity. */
+   virtual void default_data( TrickHLA::Object *mngr_object,
+                              char const       *sim_obj_name,
+                              char const       *entity_obj_name,
+                              char const       *entity_name,
+                              char const       *parent_ref_frame_name,
+                              bool              publishes );
+
    // Initialization routines.
    void initialize();
 
+   /*! @brief Initialization callback as part of the TrickHLA::Packing functions.
+    *  @param obj Object associated with this packing class. */
+   virtual void initialize_callback( TrickHLA::Object *obj );
+
+   // From the TrickHLA::Conditional class.
+   /*! @brief Only send the rarely changing attributes when they have been
+    *  modified since they were last sent.
+    *  @return True if the attribute should be sent.
+    *  @param attr Attribute to check. */
+   virtual bool should_send( TrickHLA::Attribute *attr );
+
+   /*! @brief Mark all the change tracked attributes as changed so that they
+    *  are sent on the next update, for example after an ownership transfer. */
+   void mark_all_changed();
+
    // Access functions.
    virtual void        set_name( char const *name );
    virtual char const *get_name()
@@ -109,10 +169,86 @@ class PhysicalEntityBase : public TrickHLA::Packing, public TrickHLA::OpaqueBuff
       return state.time;
    }
 
+   /*! @brief Get the entity space/time coordinate state.
+    *  @return A reference to the SpaceTimeCoordinateData. */
+   SpaceTimeCoordinateData &get_state()
+   {
+      return state;
+   }
+
    virtual void pack();
    virtual void unpack();
 
+  public:
+   bool send_on_change_only; ///< @trick_units{--} Only send the rarely changing attributes when modified (default: true).
+
   protected:
+   /*! @brief Get the number of attributes default_data() sets up.
+    *  @return Number of attributes. */
+   virtual unsigned int const get_default_attribute_count() const
+   {
+      return 9;
+   }
+
+   /*! @brief Configure an attribute using default values.
+    *  @param attr       Attribute to configure.
+    *  @param FOM_name   FOM name of the attribute.
+    *  @param trick_name Trick name of the data for the attribute.
+    *  @param publishes  Does this federate publish this entity.
+    *  @param encoding   RTI encoding of the data. */
+   void setup_attribute( TrickHLA::Attribute   &attr,
+                         char const            *FOM_name,
+                         std::string const     &trick_name,
+                         bool const             publishes,
+                         TrickHLA::EncodingEnum encoding );
+
+   /*! @brief Associate a change tracked attribute with this conditional.
+    *  @param index    Tracked attribute index.
+    *  @param FOM_name FOM name of the attribute. */
+   void track_attribute( PhysicalEntityTrackedEnum const index,
+                         char const                     *FOM_name );
+
+   /*! @brief Flag a change tracked attribute as changed if needed.
+    *  @param index   Tracked attribute index.
+    *  @param changed True if the data for the attribute changed. */
+   void update_tracked_attribute( PhysicalEntityTrackedEnum const index,
+                                  bool const                      changed )
+   {
+      if ( changed ) {
+         tracked_changed[index] = true;
+      }
+   }
+
+   /*! @brief Compare a string with its previous value and update it.
+    *  @return True if the string changed.
+    *  @param value    Current string value, which can be NULL.
+    *  @param previous Previous string value. */
+   static bool string_changed( char const *value, std::string &previous );
+
+   /*! @brief Compare an array of doubles with its previous value and update it.
+    *  @return True if any of the values changed.
+    *  @param value    Current values.
+    *  @param previous Previous values.
+    *  @param count    Number of values. */
+   static bool data_changed( double const *value, double *previous, unsigned int const count );
+
+   /*! @brief Uses Trick memory allocation routines to allocate a new string
+    *  that is input file compliant. */
+   char *allocate_input_string( std::string const &cpp_string );
+
+   TrickHLA::Attribute *state_attr;           ///< @trick_io{**} Entity state Attribute.
+   TrickHLA::Attribute *body_wrt_struct_attr; ///< @trick_io{**} Body wrt. structural Attribute.
+
+   TrickHLA::Attribute *tracked_attr[PHYSICAL_ENTITY_TRACKED_COUNT];    ///< @trick_io{**} Change tracked Attributes.
+   bool                 tracked_changed[PHYSICAL_ENTITY_TRACKED_COUNT]; ///< @trick_io{**} Changed since last sent.
+
+   std::string    prev_name;             ///< @trick_io{**} Last packed name.
+   std::string    prev_type;             ///< @trick_io{**} Last packed type.
+   std::string    prev_status;           ///< @trick_io{**} Last packed status.
+   std::string    prev_parent_ref_frame; ///< @trick_io{**} Last packed parent frame name.
+   double         prev_cm[3];            ///< @trick_io{**} Last packed center of mass.
+   QuaternionData prev_body_wrt_struct;  ///< @trick_io{**} Last packed body wrt. structural attitude.
+
    char  *name;             ///< @trick_units{--} Name of this entity(required).
    char  *type;             ///< @trick_units{--} True underlying type for this entity(optional).
    char  *status;           ///< @trick_units{--} Status string for this entity (optional).
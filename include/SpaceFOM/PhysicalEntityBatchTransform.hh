@@ -0,0 +1,189 @@
+/*!
+@file SpaceFOM/PhysicalEntityBatchTransform.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM batch physical entity state
+frame transformation utility.
+
+This class holds the states of many physical entities that share a common
+parent reference frame in a structure-of-arrays layout and transforms all of
+them into a common target reference frame (i.e. a display or GNC frame) in a
+single pass. The data layout lets the compiler vectorize the quaternion and
+3x3 rotation kernels, which is considerably faster than transforming each
+entity state one at a time.
+
+The quaternion convention is the SpaceFOM (and JEOD) left transformation
+quaternion, where the attitude quaternion of a frame transforms vectors from
+the parent frame to the child frame. The angular velocity is expressed in the
+child frame.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityBatchTransform.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityBase.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Batch entity frame transformation.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_PHYSICAL_ENTITY_BATCH_TRANSFORM_HH
+#define SPACEFOM_PHYSICAL_ENTITY_BATCH_TRANSFORM_HH
+
+// System include files.
+#include <string>
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityBase.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.h"
+
+namespace SpaceFOM
+{
+
+class PhysicalEntityBatchTransform
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__PhysicalEntityBatchTransform();
+
+  public:
+   /*! @brief Default constructor for the SpaceFOM PhysicalEntityBatchTransform class. */
+   PhysicalEntityBatchTransform();
+   /*! @brief Destructor for the SpaceFOM PhysicalEntityBatchTransform class. */
+   virtual ~PhysicalEntityBatchTransform();
+
+   /*! @brief Make sure the batch can hold at least the specified number of
+    *  entity states without reallocating.
+    *  @param new_capacity Number of entity states. */
+   void ensure_capacity( unsigned int const new_capacity );
+
+   /*! @brief Remove all the entity states from the batch but keep the memory. */
+   void clear()
+   {
+      count = 0;
+   }
+
+   /*! @brief Get the number of entity states in the batch.
+    *  @return Number of entity states. */
+   unsigned int const get_count() const
+   {
+      return count;
+   }
+
+   /*! @brief Get the number of entity states the batch can hold.
+    *  @return Capacity of the batch. */
+   unsigned int const get_capacity() const
+   {
+      return capacity;
+   }
+
+   /*! @brief Append an entity state to the batch.
+    *  @return Index of the entity state in the batch.
+    *  @param state Entity state with respect to the batch parent frame. */
+   unsigned int const add_state( SpaceTimeCoordinateData const &state );
+
+   /*! @brief Append the state of a physical entity to the batch.
+    *  @return Index of the entity state in the batch.
+    *  @param entity Physical entity whose state is expressed in the batch
+    *  parent frame. */
+   unsigned int const add_entity( PhysicalEntityBase &entity )
+   {
+      return add_state( entity.get_state() );
+   }
+
+   /*! @brief Copy the entity state at the specified index into the batch.
+    *  @param index Index of the entity state in the batch.
+    *  @param state Entity state to copy from. */
+   void set_state( unsigned int const index, SpaceTimeCoordinateData const &state );
+
+   /*! @brief Copy the entity state at the specified index out of the batch.
+    *  @param index Index of the entity state in the batch.
+    *  @param state Entity state to copy to. */
+   void get_state( unsigned int const index, SpaceTimeCoordinateData &state ) const;
+
+   /*! @brief Transform all the entity states in the batch from the common
+    *  parent frame into the target frame, in place.
+    *  @param parent_wrt_target State of the batch parent frame with respect
+    *  to the target frame. */
+   void transform( SpaceTimeCoordinateData const &parent_wrt_target );
+
+   /*! @brief Transform a single entity state from its parent frame into the
+    *  target frame using scalar math. This is the reference implementation
+    *  for the batch transformation.
+    *  @param parent_wrt_target State of the parent frame with respect to the
+    *  target frame.
+    *  @param entity_wrt_parent Entity state with respect to the parent frame.
+    *  @param entity_wrt_target Entity state with respect to the target frame. */
+   static void transform_state( SpaceTimeCoordinateData const &parent_wrt_target,
+                                SpaceTimeCoordinateData const &entity_wrt_parent,
+                                SpaceTimeCoordinateData       &entity_wrt_target );
+
+   /*! @brief Time the batch transformation against the per-entity scalar
+    *  transformation for a synthetic set of entity states.
+    *  @return Summary of the timing results and the largest difference found
+    *  between the two methods.
+    *  @param num_entities Number of entity states to transform.
+    *  @param iterations   Number of times to transform all the entity states. */
+   std::string benchmark( unsigned int const num_entities,
+                          unsigned int const iterations );
+
+  protected:
+   unsigned int capacity; ///< @trick_units{--} Number of entity states allocated.
+   unsigned int count;    ///< @trick_units{--} Number of entity states in use.
+
+   double *pos_x; ///< @trick_units{m} Entity position x component.
+   double *pos_y; ///< @trick_units{m} Entity position y component.
+   double *pos_z; ///< @trick_units{m} Entity position z component.
+
+   double *vel_x; ///< @trick_units{m/s} Entity velocity x component.
+   double *vel_y; ///< @trick_units{m/s} Entity velocity y component.
+   double *vel_z; ///< @trick_units{m/s} Entity velocity z component.
+
+   double *quat_s; ///< @trick_units{--} Entity attitude quaternion scalar.
+   double *quat_x; ///< @trick_units{--} Entity attitude quaternion vector x component.
+   double *quat_y; ///< @trick_units{--} Entity attitude quaternion vector y component.
+   double *quat_z; ///< @trick_units{--} Entity attitude quaternion vector z component.
+
+   double *ang_vel_x; ///< @trick_units{rad/s} Entity angular velocity x component.
+   double *ang_vel_y; ///< @trick_units{rad/s} Entity angular velocity y component.
+   double *ang_vel_z; ///< @trick_units{rad/s} Entity angular velocity z component.
+
+   double *time; ///< @trick_units{s} Entity state time.
+
+  private:
+   /*! @brief Free all the structure-of-arrays memory. */
+   void free_arrays();
+
+   // This object is not copyable
+   /*! @brief Copy constructor for PhysicalEntityBatchTransform class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PhysicalEntityBatchTransform( PhysicalEntityBatchTransform const &rhs );
+   /*! @brief Assignment operator for PhysicalEntityBatchTransform class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PhysicalEntityBatchTransform &operator=( PhysicalEntityBatchTransform const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_PHYSICAL_ENTITY_BATCH_TRANSFORM_HH: Do NOT put anything after this line!
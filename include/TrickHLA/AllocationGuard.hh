@@ -0,0 +1,176 @@
+/*!
+@file TrickHLA/AllocationGuard.hh
+@ingroup TrickHLA
+@brief This class counts the heap allocations made inside the TrickHLA
+scheduled jobs, which is used to verify that the steady state real-time frames
+do not allocate.
+
+The guard is only built in when THLA_ALLOCATION_GUARD is defined in
+CompileConfig.hh, in which case malloc(), calloc(), realloc() and the aligned
+allocators posix_memalign(), aligned_alloc(), memalign(), valloc() and
+pvalloc() are replaced with versions that count the allocations made while a
+guard scope is active on the calling thread and the guard is armed, before
+calling the glibc allocator. The Trick Memory Manager allocations and C++ new,
+including the aligned new, end up in these, so they are counted too. The counting takes no locks and never
+allocates. Use the THLA_ALLOCATION_GUARD_SCOPE macro so the scopes can be
+compiled out.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AllocationGuard.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Count the aligned allocations and reset all the counts when armed.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ALLOCATION_GUARD_HH
+#define TRICKHLA_ALLOCATION_GUARD_HH
+
+// System include files.
+#include <cstddef>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+#if defined( THLA_ALLOCATION_GUARD )
+#   define THLA_ALLOCATION_GUARD_SCOPE( name ) \
+      TrickHLA::AllocationGuardScope thla_allocation_guard_scope( name )
+#else
+#   define THLA_ALLOCATION_GUARD_SCOPE( name )
+#endif
+
+namespace TrickHLA
+{
+
+class AllocationGuard
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AllocationGuard();
+
+  public:
+   /*! @brief Reset all the counts and start counting the allocations made
+    *  inside the guard scopes. */
+   static void arm();
+
+   /*! @brief Stop counting allocations. The counts are kept. */
+   static void disarm();
+
+   /*! @brief Is the guard counting allocations.
+    *  @return True if armed. */
+   static bool is_armed()
+   {
+      return __atomic_load_n( &armed, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Is the guard built in, which needs THLA_ALLOCATION_GUARD
+    *  defined and the glibc allocator.
+    *  @return True if the allocations can be counted. */
+   static bool const is_built_in();
+
+   /*! @brief Get the number of allocations counted since armed.
+    *  @return Number of allocations made inside the guard scopes. */
+   static unsigned long long const get_allocation_count();
+
+   /*! @brief Get the allocations counted for each guard scope.
+    *  @return Multi-line allocation report. */
+   static std::string const to_string();
+
+   /*! @brief Count an allocation if the guard is armed and the calling thread
+    *  is inside a guard scope, which is called by the allocation functions.
+    *  @param size Number of bytes allocated. */
+   static void record_allocation( size_t const size );
+
+   /*! @brief Set the guard scope of the calling thread.
+    *  @return The previous scope name, or NULL if none.
+    *  @param name Scope name, which must be a string literal, or NULL for none. */
+   static char const *set_scope( char const *name );
+
+  protected:
+   static bool armed; ///< @trick_io{**} True if counting allocations.
+
+  private:
+   // Do not allow the constructor, copy constructor or assignment operator.
+   /*! @brief Constructor for AllocationGuard class, which only has static
+    *  functions. */
+   AllocationGuard();
+   /*! @brief Copy constructor for AllocationGuard class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AllocationGuard( AllocationGuard const &rhs );
+   /*! @brief Assignment operator for AllocationGuard class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AllocationGuard &operator=( AllocationGuard const &rhs );
+};
+
+/*!
+ * @brief Counts the allocations on this thread from construction to
+ * destruction under the given name. Use the THLA_ALLOCATION_GUARD_SCOPE macro
+ * so it can be compiled out.
+ */
+class AllocationGuardScope
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AllocationGuardScope();
+
+  public:
+   /*! @brief Constructor for the TrickHLA AllocationGuardScope class.
+    *  @param name Scope name, which must be a string literal. */
+   explicit AllocationGuardScope( char const *name )
+      : prev_name( AllocationGuard::set_scope( name ) )
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA AllocationGuardScope class. */
+   ~AllocationGuardScope()
+   {
+      (void)AllocationGuard::set_scope( prev_name );
+   }
+
+  private:
+   char const *prev_name; ///< @trick_io{**} Scope name to restore, or NULL.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AllocationGuardScope class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AllocationGuardScope( AllocationGuardScope const &rhs );
+   /*! @brief Assignment operator for AllocationGuardScope class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AllocationGuardScope &operator=( AllocationGuardScope const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ALLOCATION_GUARD_HH: Do NOT put anything after this line!
@@ -0,0 +1,173 @@
+/*!
+@file TrickHLA/AsyncLogger.hh
+@ingroup TrickHLA
+@brief Asynchronous logger that moves the formatting and writing of the
+TrickHLA debug messages off of the calling threads.
+
+Each thread that logs a message gets its own lock-free ring of fixed size
+records, which only that thread writes to. A record holds the format string,
+the stream, a timestamp and a copy of the arguments, where strings are
+copied into the record, so nothing is formatted on the calling thread. A
+background thread drains the rings, orders the records by their timestamp,
+formats them and writes them with send_hs(). A record is dropped and counted
+if the ring of the thread is full, so a caller never waits on the writer. A
+message whose arguments do not fit in a record is formatted on the calling
+thread and queued as text split over consecutive records, so it is still
+written in order with the other messages.
+
+When the logger is not started the messages are formatted and written on the
+calling thread as before. Every call site can also be limited to a number of
+messages per second, where the suppressed messages are counted and reported.
+
+Use the THLA_LOG and THLA_DEBUG_LOG macros, which give every call site its own
+rate limit state.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AsyncLogger.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Queue the oversized messages in order and drain them all on stop.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ASYNC_LOGGER_HH
+#define TRICKHLA_ASYNC_LOGGER_HH
+
+// System include files.
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// TrickHLA include files.
+#include "TrickHLA/DebugHandler.hh"
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class ThreadConfig;
+
+// Rate limit state of one call site, see the THLA_LOG macro.
+typedef struct {
+   int64_t      window_begin_ns; ///< @trick_io{**} Start of the current one second window.
+   unsigned int window_count;    ///< @trick_io{**} Messages logged in the current window.
+   unsigned int suppressed;      ///< @trick_io{**} Messages suppressed in the current window.
+} LogCallSite;
+
+class AsyncLogger
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AsyncLogger();
+
+  public:
+   /*! @brief Start the writer thread.
+    *  @return True if the writer thread is running.
+    *  @param records_per_thread Size of the ring for each thread that has not
+    *  logged a message yet, rounded up to a power of two.
+    *  @param thread_config Affinity, priority and name for the writer
+    *  thread, or NULL for the defaults. */
+   static bool start( size_t const records_per_thread,
+                      ThreadConfig *thread_config = NULL );
+
+   /*! @brief Stop queuing messages, stop the writer thread and write the
+    *  queued messages. Messages are written on the calling thread again
+    *  afterwards. */
+   static void stop();
+
+   /*! @brief Is the writer thread running.
+    *  @return True if messages are queued for the writer thread. */
+   static bool is_running()
+   {
+      return __atomic_load_n( &running, __ATOMIC_ACQUIRE );
+   }
+
+   /*! @brief Set the rate limit for every call site.
+    *  @param messages_per_second Messages per second for each call site,
+    *  where zero is unlimited. */
+   static void set_rate_limit( unsigned int const messages_per_second );
+
+   /*! @brief Get the number of messages dropped because a ring was full.
+    *  @return Number of dropped messages. */
+   static unsigned long long get_dropped_count();
+
+   /*! @brief Log a message, which is either queued for the writer thread or
+    *  written now. Use the THLA_LOG macro instead of calling this directly.
+    *  @param site   Rate limit state of the call site.
+    *  @param stream Stream to write to, stdout or stderr.
+    *  @param format The printf style format, which must be a string literal
+    *  because it is formatted later. */
+   static void log( LogCallSite &site,
+                    FILE        *stream,
+                    char const  *format,
+                    ... )
+#if defined( __GNUC__ )
+      __attribute__( ( format( printf, 3, 4 ) ) )
+#endif
+      ;
+
+  protected:
+   static bool         running;            ///< @trick_io{**} True if the writer thread is running.
+   static size_t       records_per_thread; ///< @trick_io{**} Ring size for new threads.
+   static unsigned int rate_limit;         ///< @trick_io{**} Messages per second for each call site, zero for unlimited.
+
+  private:
+   // Do not allow the constructor, copy constructor or assignment operator.
+   /*! @brief Constructor for AsyncLogger class, which only has static
+    *  functions. */
+   AsyncLogger();
+   /*! @brief Copy constructor for AsyncLogger class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AsyncLogger( AsyncLogger const &rhs );
+   /*! @brief Assignment operator for AsyncLogger class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AsyncLogger &operator=( AsyncLogger const &rhs );
+};
+
+} // namespace TrickHLA
+
+// Log a printf style message with a string literal format, for example:
+//    THLA_LOG( stdout, "Object::send():%d '%s'%c", __LINE__, name, THLA_NEWLINE );
+#define THLA_LOG( stream, ... )                                              \
+   do {                                                                      \
+      static TrickHLA::LogCallSite thla_log_call_site = { 0, 0, 0 };         \
+      TrickHLA::AsyncLogger::log( thla_log_call_site, stream, __VA_ARGS__ ); \
+   } while ( 0 )
+
+// Log a debug message if DebugHandler::show() is true for the level and code
+// section, where levels above THLA_MAX_DEBUG_LEVEL generate no code.
+#define THLA_DEBUG_LOG( level, code, stream, ... )                \
+   do {                                                           \
+      if ( TrickHLA::DebugHandler::show( ( level ), ( code ) ) ) { \
+         THLA_LOG( stream, __VA_ARGS__ );                         \
+      }                                                           \
+   } while ( 0 )
+
+#endif // TRICKHLA_ASYNC_LOGGER_HH: Do NOT put anything after this line!
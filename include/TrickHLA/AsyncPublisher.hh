@@ -0,0 +1,238 @@
+/*!
+@file TrickHLA/AsyncPublisher.hh
+@ingroup TrickHLA
+@brief This class issues the RTI attribute updates for the cyclic and
+requested object data from a dedicated publisher thread.
+
+Depending on the RTI, the updateAttributeValues() call can block on socket
+writes or internal RTI locks. When enabled, the Trick main thread packs the
+attribute buffers as usual and hands the resulting attribute handle value map
+(which holds its own copy of the encoded bytes) to this class. The publisher
+thread then makes the RTI calls in the same order they were queued. The
+flush() barrier must be called before the Time Advance Request so that all
+the Timestamp Order (TSO) updates for the frame are sent before we ask for
+the next time advance.
+
+NOTE: The RTI ambassador will be called from both the Trick main thread and
+the publisher thread, so this requires an RTI that supports calling the
+RTI ambassador from more than one thread.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/AsyncPublisher.cpp}
+@trick_link_dependency{../../source/TrickHLA/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/ThreadConfig.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Atomic running flag.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_ASYNC_PUBLISHER_HH
+#define TRICKHLA_ASYNC_PUBLISHER_HH
+
+// System include files.
+#include <cstdint>
+#include <deque>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/StandardsSupport.hh"
+#include "TrickHLA/ThreadConfig.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Object;
+
+/*!
+ * @brief An attribute update queued for the publisher thread.
+ */
+class AsyncPublishRecord
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AsyncPublishRecord();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA AsyncPublishRecord class. */
+   AsyncPublishRecord()
+      : object( NULL ),
+        instance_handle(),
+        attribute_values(),
+        timestamp_order( false ),
+        update_time()
+   {
+      return;
+   }
+
+   Object *object; ///< @trick_io{**} Object the update is for, used for messages.
+
+   RTI1516_NAMESPACE::ObjectInstanceHandle    instance_handle;  ///< @trick_io{**} Object instance handle.
+   RTI1516_NAMESPACE::AttributeHandleValueMap attribute_values; ///< @trick_io{**} Encoded attribute values.
+
+   bool      timestamp_order; ///< @trick_io{**} True to send as Timestamp Order (TSO).
+   Int64Time update_time;     ///< @trick_io{**} HLA logical time of the TSO update.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AsyncPublishRecord class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AsyncPublishRecord( AsyncPublishRecord const &rhs );
+   /*! @brief Assignment operator for AsyncPublishRecord class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AsyncPublishRecord &operator=( AsyncPublishRecord const &rhs );
+};
+
+class AsyncPublisher
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__AsyncPublisher();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA AsyncPublisher class. */
+   AsyncPublisher();
+   /*! @brief Destructor for the TrickHLA AsyncPublisher class. */
+   virtual ~AsyncPublisher();
+
+   /*! @brief Start the publisher thread.
+    *  @param rti_amb       The RTI ambassador to issue the attribute updates with.
+    *  @param thread_config Affinity, priority and name for the publisher
+    *  thread, or NULL for the defaults. */
+   void start( RTI1516_NAMESPACE::RTIambassador *rti_amb,
+               ThreadConfig                     *thread_config = NULL );
+
+   /*! @brief Send any queued updates and then stop the publisher thread. */
+   void stop();
+
+   /*! @brief Is the publisher thread running.
+    *  @return True if the publisher thread is running. */
+   bool is_running() const
+   {
+      return __atomic_load_n( &running, __ATOMIC_ACQUIRE );
+   }
+
+   /*! @brief Queue an attribute update for the publisher thread.
+    *  @details The attribute values are swapped into the queued record, so
+    *  the map passed in is returned holding an empty (recycled) map.
+    *  @param obj              Object the update is for.
+    *  @param instance_handle  Object instance handle.
+    *  @param attribute_values Attribute values to send, swapped out.
+    *  @param timestamp_order  True to send as Timestamp Order (TSO).
+    *  @param update_time      HLA logical time of the TSO update. */
+   void publish( Object                                        *obj,
+                 RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_handle,
+                 RTI1516_NAMESPACE::AttributeHandleValueMap    &attribute_values,
+                 bool const                                     timestamp_order,
+                 Int64Time const                               &update_time );
+
+   /*! @brief Preallocate the update records so that publishing does not
+    *  allocate them in the real-time frames.
+    *  @param count Number of records, typically one per published object. */
+   void reserve_records( size_t const count );
+
+   /*! @brief Wait until the publisher thread has sent all the queued
+    *  updates. This is the per-frame barrier called before the Time Advance
+    *  Request so that the TSO ordering of our updates is preserved. */
+   void flush();
+
+   /*! @brief The publisher thread loop, which is only public so that it can
+    *  be called from the pthread start function. */
+   void run();
+
+   /*! @brief Get a summary of the publisher statistics.
+    *  @return Summary of the publisher statistics. */
+   std::string get_summary();
+
+  protected:
+   RTI1516_NAMESPACE::RTIambassador *rti_ambassador; ///< @trick_io{**} RTI ambassador.
+
+   pthread_t     publisher_thread; ///< @trick_io{**} The publisher thread.
+   ThreadConfig *thread_config;    ///< @trick_io{**} Publisher thread configuration, or NULL.
+   bool          running;          ///< @trick_io{**} True if the publisher thread is running, only accessed atomically.
+   bool          stop_requested;   ///< @trick_io{**} True to ask the publisher thread to exit.
+   bool          thread_ready;     ///< @trick_io{**} True once the publisher thread applied its configuration.
+
+   MutexLock      queue_mutex; ///< @trick_io{**} Mutex protecting the queue.
+   pthread_cond_t queue_cond;  ///< @trick_io{**} Signaled when an update is queued.
+   pthread_cond_t flush_cond;  ///< @trick_io{**} Signaled when the queue has been drained.
+   pthread_cond_t ready_cond;  ///< @trick_io{**} Signaled when the publisher thread is ready.
+
+   std::deque< AsyncPublishRecord * >  queue;        ///< @trick_io{**} Updates waiting to be sent, in order.
+   std::vector< AsyncPublishRecord * > free_records; ///< @trick_io{**} Records available for reuse.
+   bool                                publishing;   ///< @trick_io{**} True while an update is being sent.
+
+   unsigned long long queued_count;    ///< @trick_io{**} Number of updates queued.
+   unsigned long long published_count; ///< @trick_io{**} Number of updates sent.
+   unsigned long long error_count;     ///< @trick_io{**} Number of updates the RTI rejected.
+   unsigned long long flush_count;     ///< @trick_io{**} Number of flushes that had to wait.
+   size_t             max_queue_depth; ///< @trick_io{**} Largest number of queued updates.
+   int64_t            flush_wait_max;  ///< @trick_io{**} Longest flush wait in microseconds.
+
+  private:
+   /*! @brief Send an update to the RTI.
+    *  @param record Update to send. */
+   void send_record( AsyncPublishRecord &record );
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for AsyncPublisher class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   AsyncPublisher( AsyncPublisher const &rhs );
+   /*! @brief Assignment operator for AsyncPublisher class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   AsyncPublisher &operator=( AsyncPublisher const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_ASYNC_PUBLISHER_HH: Do NOT put anything after this line!
@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
+@trick_link_dependency{../../source/TrickHLA/StringStorage.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
 
@@ -29,6 +30,15 @@ NASA, Johnson Space Center\n
 @revs_begin
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse the encoded buffer for unchanged strings.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional front/back encode buffers.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse string memory when decoding.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Debug messages through the asynchronous logger.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Data cycles to the next sub-rate send.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Exact string change detection.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Swap the encode buffers once per frame with a string cache per slot.}
 @revs_end
 
 */
@@ -48,6 +58,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files.
 #include "TrickHLA/Conditional.hh"
 #include "TrickHLA/StandardsSupport.hh"
+#include "TrickHLA/StringStorage.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 
@@ -60,6 +71,10 @@ NASA, Johnson Space Center\n
 #include RTI1516_HEADER
 #pragma GCC diagnostic pop
 
+// Largest number of encode buffer slots, which is one bit each in the mask
+// of the slots that hold the cached encoded strings.
+#define THLA_MAX_BUFFER_SLOTS 64
+
 namespace TrickHLA
 {
 
@@ -98,6 +113,10 @@ class Attribute
    // Added for conditional sending of this attribute
    Conditional *conditional; ///< @trick_units{--} Handler for a conditional attribute
 
+   BufferGrowthEnum buffer_growth;         ///< @trick_units{--} How the encode buffer grows (default: BUFFER_GROWTH_GEOMETRIC).
+   size_t           buffer_capacity_limit; ///< @trick_units{count} High-water mark for geometric buffer growth, 0 for no limit (default: 0).
+   size_t           max_buffer_size;       ///< @trick_units{count} Largest encoded size in bytes of variable size data, which the buffer is grown to before the real-time frames, 0 for the current size (default: 0).
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -327,6 +346,15 @@ class Attribute
       return false;
    }
 
+   /*! @brief Get the number of data cycles until the sub-rate is ready for
+    *  sending data, where the next data cycle counts as one.
+    *  @return Number of data cycles until the next send. */
+   int const get_data_cycles_to_ready() const
+   {
+      int const cycles = cycle_ratio - cycle_cnt;
+      return ( ( cycles > 1 ) ? cycles : 1 );
+   }
+
    /*! @brief Set the preferred transportation order.
     *  @param order The transportation type enumeration value. */
    void set_preferred_order( TransportationEnum const order )
@@ -441,7 +469,61 @@ class Attribute
     *  @return The size in bytes of the attribute. */
    size_t get_attribute_size();
 
+   /*! @brief Get the total capacity of the encode buffers.
+    *  @return The capacity of all the buffer slots in bytes. */
+   size_t get_buffer_capacity() const;
+
+   /*! @brief Get the number of bytes last encoded into or received in the
+    *  buffer.
+    *  @return The number of bytes used in the buffer. */
+   size_t get_buffer_size() const
+   {
+      return size;
+   }
+
+   /*! @brief Shrink the encode buffer capacity to the number of encoded
+    *  bytes it currently holds. */
+   void shrink_to_fit();
+
+   /*! @brief Grow the encode buffers to the max_buffer_size or the encoded
+    *  size of the current value, whichever is larger, and prefault them so
+    *  the real-time frames do not allocate or page fault. */
+   void prepare_buffers_for_real_time();
+
+   /*! @brief Use the specified number of encode buffer slots. With two or
+    *  more slots the attribute is packed into the back buffer while the
+    *  front buffer, which holds the last packed value, is being consumed.
+    *  @param requested_slots Number of buffer slots, 1 for a single buffer,
+    *  limited to THLA_MAX_BUFFER_SLOTS. */
+   void set_buffer_slots( unsigned int const requested_slots );
+
+   /*! @brief Get the number of encode buffer slots.
+    *  @return Number of buffer slots. */
+   unsigned int const get_buffer_slots() const
+   {
+      return buffer_slots;
+   }
+
+   /*! @brief Publish the back buffer as the front buffer and move on to the
+    *  next slot for packing, which is done once per frame after all the packs.
+    *  This is a zero-copy swap and does nothing for a single buffer or if the
+    *  attribute was not packed since the last swap. */
+   void swap_buffers();
+
+   /*! @brief Get the front buffer, which holds the last packed value. This
+    *  can be called from any thread. The buffer stays valid until the
+    *  attribute has been packed buffer-slots minus one more times.
+    *  @return The front buffer.
+    *  @param num_bytes Returns the number of encoded bytes in the buffer. */
+   unsigned char const *get_front_buffer( size_t &num_bytes ) const;
+
   private:
+   /*! @brief Prints the internal state of the attribute to standard out.
+    *  @param function Name of the calling function.
+    *  @param line     Line number of the caller.
+    *  @param banner   Banner line to print before the state. */
+   void print_state( char const *function, int const line, char const *banner ) const;
+
    /*! @brief Calculates the attribute size in bytes and the number of items it contains. */
    void calculate_size_and_number_of_items();
 
@@ -487,6 +569,18 @@ class Attribute
     * appropriate decoding. */
    void decode_string_from_buffer();
 
+   /*! @brief Encode a string attribute into the buffer, reusing the
+    * previously encoded bytes if the strings have not changed since they were
+    * last encoded. */
+   void encode_string_to_buffer_if_changed();
+
+   /*! @brief Invalidate the encoded string cache for the back buffer because
+    * it no longer holds the encoded strings. */
+   void invalidate_string_cache()
+   {
+      string_cache_slots &= ~( 1ULL << back_slot );
+   }
+
    /*! @brief Copy the data from the source to the destination and byteswap as
     * needed.
     *  @param dest      Destination to copy data to.
@@ -504,8 +598,24 @@ class Attribute
    unsigned char *buffer;          ///< @trick_units{--} Byte buffer for the attribute value bytes.
    size_t         buffer_capacity; ///< @trick_units{count} The capacity of the buffer.
 
+   unsigned int    buffer_slots;  ///< @trick_io{**} Number of encode buffer slots, 1 for a single buffer.
+   unsigned char **slot_buffer;   ///< @trick_io{**} Encode buffer for each slot.
+   unsigned long  *slot_capacity; ///< @trick_io{**} Capacity of each slot buffer in bytes.
+   unsigned long  *slot_size;     ///< @trick_io{**} Number of encoded bytes in each slot buffer.
+   unsigned int    back_slot;     ///< @trick_io{**} Slot being packed, which is the one in buffer.
+   unsigned int    front_slot;    ///< @trick_io{**} Last packed slot, only changed atomically.
+   bool            back_packed;   ///< @trick_io{**} The back buffer was packed since the last swap.
+
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
+   StringStorage string_storage; ///< @trick_io{**} Reusable memory for the decoded strings.
+
+   unsigned long long string_cache_slots;    ///< @trick_io{**} Bit for each buffer slot that holds the encoded strings copied in string_cache_data.
+   EncodingEnum       string_cache_encoding; ///< @trick_io{**} RTI encoding of the cached strings.
+   size_t             string_cache_items;    ///< @trick_io{**} Number of cached strings.
+   std::string        string_cache_data;     ///< @trick_io{**} Copy of the cached strings, each followed by its null character.
+   size_t             string_cache_size;     ///< @trick_io{**} Encoded size in bytes of the cached strings.
+
    size_t size;      ///< @trick_units{count} The size of the attribute in bytes.
    size_t num_items; ///< @trick_units{count} Number of attribute items, length of the array.
 
@@ -31,11 +31,13 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../source/TrickHLA/CTETimelineBase.cpp}
 @trick_link_dependency{../source/TrickHLA/Timeline.cpp}
+@trick_link_dependency{../source/TrickHLA/TSCTimeline.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, January 2019, --, Initial implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
 @revs_end
 
 */
@@ -22,6 +22,11 @@ NASA, Johnson Space Center\n
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER7, TrickHLA, February 2009, --, Consolidated config settings.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added frame phase tracing setting.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added USDT probes setting.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added maximum debug level setting.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added TSC clock setting.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added THLA_ALLOCATION_GUARD.}
 @revs_end
 
 */
@@ -42,6 +47,38 @@ NASA, Johnson Space Center\n
 // Default: THLA_QUEUE_REFLECTED_ATTRIBUTES
 #define THLA_QUEUE_REFLECTED_ATTRIBUTES
 
+// Set to THLA_FRAME_TRACING to build in the frame phase trace scopes, which
+// still have to be enabled at runtime with the federate trace_frame_phases
+// setting. Set to NO_THLA_FRAME_TRACING to remove them from the build.
+// Default: THLA_FRAME_TRACING
+#define THLA_FRAME_TRACING
+
+// Set to THLA_USDT_PROBES to build in the USDT static probes for tools like
+// bpftrace and perf, which are only built in if the system has <sys/sdt.h>.
+// Set to NO_THLA_USDT_PROBES to remove them from the build.
+// Default: THLA_USDT_PROBES
+#define THLA_USDT_PROBES
+
+// Set to THLA_TSC_CLOCK to read the monotonic time of the TrickHLA sleep
+// timeouts, elapsed time statistics and CTE timeline from the calibrated
+// invariant TSC on x86_64, which falls back to clock_gettime() at runtime if
+// the TSC is not usable. Set to NO_THLA_TSC_CLOCK to always use clock_gettime().
+// Default: THLA_TSC_CLOCK
+#define THLA_TSC_CLOCK
+
+// Set to THLA_ALLOCATION_GUARD to replace malloc(), calloc(), realloc() and the
+// aligned allocators with versions that count the allocations made inside the TrickHLA scheduled jobs
+// once armed by the federate allocation_guard setting, which needs glibc. Set
+// to NO_THLA_ALLOCATION_GUARD to use the system allocator unchanged.
+// Default: NO_THLA_ALLOCATION_GUARD
+#define NO_THLA_ALLOCATION_GUARD
+
+// The highest debug level built in, from 0 (DEBUG_LEVEL_NO_TRACE) to 11
+// (DEBUG_LEVEL_FULL_TRACE). Debug messages above this level are removed by the
+// compiler and can not be turned on at runtime with the debug_level setting.
+// Default: 11
+#define THLA_MAX_DEBUG_LEVEL 11
+
 // Insert a compile time error if an unsupported version of Trick 17 is used.
 // Minimum supported Trick 17 version: 17.5.0
 #define MIN_TRICK_VER 17  // Set to the minimum supported Trick Major version.
@@ -27,6 +27,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Tony Varesic, L3 Titan Group, IMSim, Jan 2010, --, Initial version.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, July 2020, --, Rewrite to use static data and functions.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Inline show() with the compile time maximum debug level.}
 @revs_end
 */
 
@@ -37,6 +38,7 @@ NASA, Johnson Space Center\n
 #include <string>
 
 // TrickHLA Model include files.
+#include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Types.hh"
 
 namespace TrickHLA
@@ -64,10 +66,17 @@ class DebugHandler
    virtual ~DebugHandler();
 
    /*! @brief Conditional test to see if a debug message should be shown.
+    *  @details Levels above THLA_MAX_DEBUG_LEVEL are always false, so the
+    *  compiler removes the message code for a constant level.
     *  @return Returns true if the requested message should be printed.
     *  @param level Debug level of incoming message.
     *  @param code  Debug code source area of the incoming message. */
-   static bool const show( DebugLevelEnum const level, DebugSourceEnum const code );
+   static bool const show( DebugLevelEnum const level, DebugSourceEnum const code )
+   {
+      return ( ( level <= THLA_MAX_DEBUG_LEVEL )
+               && ( debug_level >= level )
+               && ( ( code_section & code ) != 0 ) );
+   }
 
    /*! @brief Set the debug level and code-section.
     *  @param level Debug level of incoming message.
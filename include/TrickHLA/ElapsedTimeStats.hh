@@ -19,9 +19,14 @@ NASA, Johnson Space Center\n
 
 @python_module{TrickHLA}
 
+@tldh
+@trick_link_dependency{../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../source/TrickHLA/TSCTimeline.cpp}
+
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, Sept 2020, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
 @revs_end
 
 */
@@ -0,0 +1,113 @@
+/*!
+@file TrickHLA/EventCount.hh
+@ingroup TrickHLA
+@brief An event count lets a thread wait for a condition that other threads
+change with lock-free atomic stores.
+
+A waiter gets a key with prepare_wait(), checks its condition, and only then
+calls wait() with the key. A thread that changes the condition calls
+notify_all(), which only takes the mutex if there is a waiter. A notify that
+happens after the key was taken makes the wait return right away, so a
+wakeup can not be lost between checking the condition and waiting.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/EventCount.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_EVENT_COUNT_HH
+#define TRICKHLA_EVENT_COUNT_HH
+
+// System include files.
+#include <pthread.h>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class EventCount
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__EventCount();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA EventCount class. */
+   EventCount();
+   /*! @brief Destructor for the TrickHLA EventCount class. */
+   virtual ~EventCount();
+
+   /*! @brief Register as a waiter, which must be done before checking the
+    *  condition, and must be followed by wait() or cancel_wait().
+    *  @return The key to pass to wait(). */
+   unsigned int const prepare_wait();
+
+   /*! @brief Unregister as a waiter because the condition was met. */
+   void cancel_wait();
+
+   /*! @brief Block until notified after the key was taken, or until the
+    *  timeout, and unregister as a waiter.
+    *  @return True if notified, false for a timeout.
+    *  @param key            The key from prepare_wait().
+    *  @param timeout_micros Maximum time to wait in microseconds. */
+   bool const wait( unsigned int const key, long const timeout_micros );
+
+   /*! @brief Wake all the waiters, which is cheap if there are none. Call
+    *  this after changing the condition the waiters are checking. */
+   void notify_all();
+
+   /*! @brief Get the number of times a waiter actually blocked.
+    *  @return Number of blocking waits. */
+   unsigned long long const get_block_count() const;
+
+  protected:
+   MutexLock      mutex; ///< @trick_io{**} Mutex for the condition variable.
+   pthread_cond_t cond;  ///< @trick_io{**} Signaled on a notify with waiters.
+
+   unsigned int sequence; ///< @trick_io{**} Incremented on every notify.
+   unsigned int waiters;  ///< @trick_io{**} Number of registered waiters.
+
+   unsigned long long block_count; ///< @trick_io{**} Number of blocking waits.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for EventCount class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   EventCount( EventCount const &rhs );
+   /*! @brief Assignment operator for EventCount class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   EventCount &operator=( EventCount const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_EVENT_COUNT_HH: Do NOT put anything after this line!
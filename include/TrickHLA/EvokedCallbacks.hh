@@ -0,0 +1,150 @@
+/*!
+@file TrickHLA/EvokedCallbacks.hh
+@ingroup TrickHLA
+@brief This class delivers the RTI callbacks on the Trick main thread when the
+federate is connected with the HLA_EVOKED callback model.
+
+With the HLA_IMMEDIATE callback model the RTI calls the federate ambassador
+from its own thread at any time. With the HLA_EVOKED callback model the RTI
+only calls the federate ambassador from inside evokeCallback() and
+evokeMultipleCallbacks(), which TrickHLA calls from the thread that connected
+to the RTI at defined frame points, with a wall clock budget, and from every
+TrickHLA wait loop in place of the sleep. The callbacks are then serialized
+with the Trick main thread jobs in a deterministic order.
+
+\par<b>Assumptions and Limitations:</b>
+- Only the thread that connected to the RTI evokes callbacks. A wait on any
+other thread, such as a blocking cyclic read on a Trick child thread, only
+sleeps and relies on the main thread to deliver the callbacks.
+- A wait inside a callback sleeps, since the RTI does not allow evoking
+callbacks from within a callback.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/EvokedCallbacks.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_EVOKED_CALLBACKS_HH
+#define TRICKHLA_EVOKED_CALLBACKS_HH
+
+// System include files.
+#include <cstdint>
+#include <pthread.h>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+class EvokedCallbacks
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__EvokedCallbacks();
+
+  public:
+   /*! @brief Start evoking the callbacks from the calling thread, which must
+    *  be the thread that connected to the RTI with HLA_EVOKED.
+    *  @param rti_amb The RTI ambassador to evoke the callbacks with. */
+   static void enable( RTI1516_NAMESPACE::RTIambassador *rti_amb );
+
+   /*! @brief Stop evoking callbacks, which is done before disconnecting. */
+   static void disable();
+
+   /*! @brief Are the callbacks evoked by TrickHLA.
+    *  @return True if the HLA_EVOKED callback model is in use. */
+   static bool is_enabled()
+   {
+      return __atomic_load_n( &enabled, __ATOMIC_ACQUIRE );
+   }
+
+   /*! @brief Wait for a callback and deliver it, which is used in place of
+    *  the sleep in the TrickHLA wait loops.
+    *  @return True if the wait was done by the RTI, false if the caller has
+    *  to sleep itself because the callbacks are not evoked, or not from this
+    *  thread, or the RTI could not evoke them.
+    *  @param wait_seconds Longest wait for a callback in seconds. */
+   static bool const wait( double const wait_seconds );
+
+   /*! @brief Deliver the pending callbacks at a frame point.
+    *  @return True if callbacks are still pending when the budget ran out.
+    *  @param budget_seconds Wall clock budget in seconds. */
+   static bool const deliver( double const budget_seconds );
+
+   /*! @brief Get a summary of the frame point and wait deliveries.
+    *  @return Summary of the callback delivery statistics. */
+   static std::string const get_summary();
+
+  protected:
+   /*! @brief Report an exception from the RTI, which is only printed the
+    *  first time and counted after that.
+    *  @param function Name of the function the exception is from.
+    *  @param what     The exception message. */
+   static void record_error( char const *function, std::wstring const &what );
+
+   static bool enabled; ///< @trick_io{**} True if the callbacks are evoked by TrickHLA.
+
+   static RTI1516_NAMESPACE::RTIambassador *rti_ambassador; ///< @trick_io{**} RTI ambassador.
+
+   static pthread_t evoking_thread; ///< @trick_io{**} The thread that evokes the callbacks.
+
+   static unsigned long long wait_count;    ///< @trick_io{**} Number of waits done by the RTI.
+   static unsigned long long deliver_count; ///< @trick_io{**} Number of frame point deliveries.
+   static unsigned long long overrun_count; ///< @trick_io{**} Number of deliveries that ran out of budget.
+   static unsigned long long error_count;   ///< @trick_io{**} Number of exceptions from the RTI.
+   static int64_t            deliver_total; ///< @trick_io{**} Total frame point delivery time in microseconds.
+   static int64_t            deliver_max;   ///< @trick_io{**} Longest frame point delivery in microseconds.
+
+  private:
+   // Do not allow the constructor, copy constructor or assignment operator.
+   /*! @brief Constructor for EvokedCallbacks class, which only has static
+    *  functions. */
+   EvokedCallbacks();
+   /*! @brief Copy constructor for EvokedCallbacks class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   EvokedCallbacks( EvokedCallbacks const &rhs );
+   /*! @brief Assignment operator for EvokedCallbacks class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   EvokedCallbacks &operator=( EvokedCallbacks const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_EVOKED_CALLBACKS_HH: Do NOT put anything after this line!
@@ -45,6 +45,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Edwin Z. Crues, Titan Systems Corp., DIS, Feb 2002, --, HLA Ball Sim.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Callback thread configuration.}
 @revs_end
 
 */
@@ -496,6 +497,12 @@ class FedAmb : public RTI1516_NAMESPACE::FederateAmbassador
       federation_restored_rebuild_federate_handle_set = false;
    }
 
+  protected:
+   /*! @brief Apply the federate callback_thread configuration the first
+    *  time a callback arrives on an RTI thread, which is called at the start
+    *  of each callback. */
+   void check_callback_thread();
+
   private:
    bool federation_restore_status_response_context_switch;
    bool federation_restored_rebuild_federate_handle_set;
@@ -20,14 +20,20 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../source/TrickHLA/AsyncLogger.cpp}
+@trick_link_dependency{../source/TrickHLA/AsyncPublisher.cpp}
 @trick_link_dependency{../source/TrickHLA/DebugHandler.cpp}
 @trick_link_dependency{../source/TrickHLA/ExecutionControlBase.cpp}
 @trick_link_dependency{../source/TrickHLA/Int64Time.cpp}
+@trick_link_dependency{../source/TrickHLA/LatencyHistogram.cpp}
 @trick_link_dependency{../source/TrickHLA/FedAmb.cpp}
 @trick_link_dependency{../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../source/TrickHLA/MetricsRegistry.cpp}
 @trick_link_dependency{../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../source/TrickHLA/MutexProtection.cpp}
+@trick_link_dependency{../source/TrickHLA/ThreadConfig.cpp}
+@trick_link_dependency{../source/TrickHLA/TimeStallProfiler.cpp}
 @trick_link_dependency{../source/TrickHLA/TrickThreadCoordinator.cpp}
 @trick_link_dependency{../source/TrickHLA/Types.cpp}
 
@@ -37,6 +43,20 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, Jan 2019, --, SRFOM support & test.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional asynchronous attribute update publisher.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Child thread object data exchange.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Latency histograms.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics in shared memory.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Asynchronous debug logging.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Next Message Request time advance modes.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Adaptive lookahead.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Time advance stall profiler.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Batched time advance requests.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Pipelined time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation and allocation guard.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, HLA_EVOKED callback model.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread affinity and scheduling configuration.}
 @revs_end
 
 */
@@ -52,12 +72,17 @@ NASA, Johnson Space Center\n
 #include "trick/Flag.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AsyncPublisher.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/KnownFederate.hh"
+#include "TrickHLA/LatencyHistogram.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/StandardsSupport.hh"
+#include "TrickHLA/ThreadConfig.hh"
+#include "TrickHLA/TimeStallProfiler.hh"
 #include "TrickHLA/TrickThreadCoordinator.hh"
 #include "TrickHLA/Types.hh"
 
@@ -135,6 +160,54 @@ class Federate
    bool time_constrained; ///< @trick_units{--} HLA Time Constrained flag (default: true).
    bool time_management;  ///< @trick_units{--} Enable HLA Time Management flag (default: true).
 
+   TimeAdvanceModeEnum time_advance_mode; /**< @trick_units{--}
+      How the federate asks for a time advance. TIME_ADVANCE_MODE_TAR makes a
+      Time Advance Request every frame. TIME_ADVANCE_MODE_NMR and
+      TIME_ADVANCE_MODE_NMRA make a Next Message Request (Available) to the
+      later of the next frame and the next event time set with
+      set_next_event_time(), which is granted early at the time of the next
+      timestamped message. While the granted time is at or past the next
+      frame no request is made, so an event driven federate only gates the
+      federation at its messages and events. TIME_ADVANCE_MODE_BATCH makes
+      one Time Advance Request to the next frame in which an object sends
+      data, found from the object data cycles and attribute sub-rates, but
+      not past the next event time, and runs the frames before it without
+      waiting on the RTI. Timestamped data received from the other federates
+      is then reflected up to that time (default: TIME_ADVANCE_MODE_TAR). */
+
+   unsigned int batch_max_frames; /**< @trick_units{--}
+      Most frames one Time Advance Request spans for TIME_ADVANCE_MODE_BATCH,
+      which bounds how late the data of the other federates can be (default: 10). */
+
+   bool pipelined_time_advance; /**< @trick_units{--}
+      Run the models of the frame while the Time Advance Grant is pending
+      instead of waiting for it in wait_for_time_advance_grant(), when every
+      object we receive cyclic data for has a late_data_dependence. The grant
+      is then waited for, and the cyclic data and interactions received, in
+      wait_for_pipelined_time_advance_grant(). A strict dependence, a Trick
+      child thread exchange, a zero lookahead or a time advance mode other
+      than TIME_ADVANCE_MODE_TAR falls back to the blocking wait (default: false). */
+
+   bool adaptive_lookahead; /**< @trick_units{--}
+      Adjust the HLA lookahead, within lookahead_min_time and
+      lookahead_max_time, to the smallest distance from the granted time of
+      the timestamps this federate sends its cyclic data and interactions at.
+      A federate that sends less often than its lookahead_time then lets the
+      other federates advance further. The lookahead is changed right after a
+      Time Advance Grant, and is kept when nothing timestamped was sent. The
+      Time Advance Request step stays the lookahead_time (default: false). */
+
+   double lookahead_min_time; /**< @trick_units{s}
+      Smallest adaptive lookahead, where zero uses the lookahead_time (default: 0.0). */
+
+   double lookahead_max_time; /**< @trick_units{s}
+      Largest adaptive lookahead, where zero uses the lookahead_time. It must
+      not be greater than the data cycle time of the Trick main thread (default: 0.0). */
+
+   unsigned int adaptive_lookahead_frames; /**< @trick_units{--}
+      Number of Time Advance Grants the send timestamps are tracked over
+      before the lookahead is adjusted (default: 10). */
+
    // The Federates known to be in the Federation, and specified in the input files.
    // TODO: change this to be an STL Array.
    bool           enable_known_feds; ///< @trick_units{--} Enable use of known Federates list (default: true)
@@ -157,6 +230,128 @@ class Federate
    bool unfreeze_after_save; /**< @trick_units{--}
       Flag to indicate that we should go to run immediately after a save. */
 
+   bool async_publish; /**< @trick_units{--}
+      Send the cyclic and requested attribute updates from a dedicated
+      publisher thread instead of the Trick main thread, which requires an
+      RTI that supports calls from more than one thread (default: false). */
+
+   bool child_thread_data_exchange; /**< @trick_units{--}
+      True to have each Trick child thread associated to TrickHLA pack, send,
+      receive and unpack its own associated objects in the
+      send_child_thread_data() and receive_child_thread_data() jobs that
+      THLAThread.sm schedules, instead of the Trick main thread doing it. The attribute updates are serialized
+      so this requires an RTI that supports calls from more than one thread
+      (default: false). */
+
+   bool trace_frame_phases; /**< @trick_units{--}
+      Record the begin and end times of the HLA frame phases and RTI
+      callbacks, and write them to trace_file at shutdown in the Chrome trace
+      format, which can be viewed in chrome://tracing or the Perfetto UI
+      (default: false). */
+
+   unsigned int trace_events_per_thread; /**< @trick_units{--}
+      Number of trace events kept for each thread, where the oldest events
+      are overwritten once this is exceeded (default: 65536). */
+
+   char *trace_file; /**< @trick_units{--}
+      Name of the trace file (default: "trickhla_trace.json"). */
+
+   bool latency_stats; /**< @trick_units{--}
+      Record latency histograms for the Time Advance Request to Grant wait,
+      the blocking cyclic read wait, the pack, unpack and send of each
+      object, and the interaction processing, and print the percentiles at
+      shutdown (default: false). */
+
+   double latency_stats_report_period; /**< @trick_units{s}
+      Wall clock period in seconds between printing the latency percentiles
+      while running, where zero only prints them at shutdown (default: 0.0). */
+
+   bool time_stall_profiler; /**< @trick_units{--}
+      Find the federate that holds back each Time Advance Grant that takes
+      longer than the stall threshold from the MOM time state of the joined
+      federates, and print the stalls for each federate at shutdown
+      (default: false). */
+
+   double stall_threshold; /**< @trick_units{s}
+      Wall clock Time Advance Request to Grant wait in seconds at or above
+      which the wait is profiled as a stall (default: 0.1). */
+
+   double stall_report_period; /**< @trick_units{s}
+      Wall clock period in seconds between printing the stall report while
+      running, where zero only prints it at shutdown (default: 0.0). */
+
+   bool runtime_metrics; /**< @trick_units{--}
+      Keep the update, byte, queue and Time Advance Grant wait counters for
+      each object, attribute and interaction in a POSIX shared memory segment
+      that can be watched while running with scripts/trickhla_metrics.py
+      (default: false). */
+
+   char *metrics_shm_name; /**< @trick_units{--}
+      Name of the shared memory segment for the runtime metrics
+      (default: "/TrickHLA_" followed by the federate name). */
+
+   bool async_debug_log; /**< @trick_units{--}
+      Queue the TrickHLA debug messages of the data exchange and RTI callback
+      paths in a lock-free ring for each thread, and format and write them
+      from a background thread instead of the calling thread (default: false). */
+
+   unsigned int async_log_records_per_thread; /**< @trick_units{--}
+      Number of queued debug messages kept for each thread, where new
+      messages are dropped and counted once this is exceeded (default: 1024). */
+
+   unsigned int debug_log_rate_limit; /**< @trick_units{--}
+      Maximum number of those debug messages per second from each place in
+      the code, where the rest are counted and reported as suppressed, and
+      zero is unlimited (default: 0). */
+
+   bool real_time_memory; /**< @trick_units{--}
+      After the initialization, grow the attribute and parameter buffers to
+      their max_buffer_size, prefault them and preallocate the publisher
+      records so the first real-time frames do not allocate or page fault
+      on them (default: false). */
+
+   bool lock_memory; /**< @trick_units{--}
+      With real_time_memory, also lock all the current and future pages of
+      the process in memory with mlockall() and keep the allocator from
+      returning memory to the system, which usually needs the CAP_IPC_LOCK
+      capability or a large enough memlock limit (default: false). */
+
+   bool allocation_guard; /**< @trick_units{--}
+      Count the heap allocations made inside the TrickHLA scheduled jobs
+      from the end of the initialization, warn on the first one, and print
+      them at shutdown, which needs THLA_ALLOCATION_GUARD defined in
+      CompileConfig.hh (default: false). */
+
+   bool evoked_callbacks; /**< @trick_units{--}
+      Connect to the RTI with the HLA_EVOKED callback model so the RTI
+      callbacks are only delivered on the Trick main thread, at the top of
+      each frame and while TrickHLA waits, instead of on an RTI thread at any
+      time. Without the publisher thread or Trick child threads the data path
+      then skips its mutex locking (default: false). */
+
+   double callback_budget; /**< @trick_units{s}
+      Wall clock budget in seconds for delivering the pending callbacks at the
+      top of each frame with evoked_callbacks, where the callbacks left over
+      are delivered at the next frame point or wait (default: 0.001). */
+
+   ThreadConfig callback_thread; /**< @trick_units{--}
+      CPU cores, SCHED_FIFO priority and name for the RTI thread that delivers
+      the callbacks, applied on its first callback so the callback handling
+      can be kept off the Trick real-time cores. Not used with
+      evoked_callbacks, where the callbacks run on the Trick main thread. */
+
+   ThreadConfig publisher_thread; /**< @trick_units{--}
+      CPU cores, SCHED_FIFO priority and name for the async_publish
+      publisher thread. */
+
+   ThreadConfig logger_thread; /**< @trick_units{--}
+      CPU cores, SCHED_FIFO priority and name for the async_debug_log
+      writer thread. */
+
+   ThreadConfig ownership_thread; /**< @trick_units{--}
+      CPU cores, SCHED_FIFO priority and name for the short lived threads
+      that handle the attribute ownership push and divestiture. */
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -657,6 +852,17 @@ class Federate
    /*! @brief Wait for a HLA time-advance grant. */
    void wait_for_time_advance_grant();
 
+   /*! @brief Wait for the HLA time-advance grant of a pipelined frame, then
+    *  receive the cyclic data and process the interactions for the frame. */
+   void wait_for_pipelined_time_advance_grant();
+
+   /*! @brief Is the frame running ahead of a pending Time Advance Grant.
+    *  @return True while a pipelined frame waits for its grant. */
+   bool const is_pipelined_grant_pending() const
+   {
+      return this->pipelined_grant_pending;
+   }
+
    /*! @brief Initialize the thread memory associated with the Trick child threads. */
    void initialize_thread_state( double const main_thread_data_cycle_time );
 
@@ -677,6 +883,24 @@ class Federate
    /*! @brief Wait to receive data when the Trick main thread is ready. */
    void wait_to_receive_data();
 
+   /*! @brief Trick child thread job that waits for the Trick main thread to
+    *  receive data and then receives and unpacks the objects associated to
+    *  the calling child thread. Use instead of wait_to_receive_data(). */
+   void receive_child_thread_data();
+
+   /*! @brief Trick child thread job that packs and sends the objects
+    *  associated to the calling child thread and then waits for the Trick
+    *  main thread to send its data. Use instead of wait_to_send_data(). */
+   void send_child_thread_data();
+
+   /*! @brief Get the Trick thread-id the object with the given index is
+    *  associated to, which is 0 for the main thread. */
+   unsigned int const get_thread_id_for_obj( unsigned int const obj_index ) const;
+
+   /*! @brief Is the data for the object with the given index exchanged by the
+    *  Trick child thread it is associated to instead of the main thread. */
+   bool const is_obj_exchanged_by_child_thread( unsigned int const obj_index ) const;
+
    /*! @brief Get the data cycle time in microseconds for the configured object
     * index or return the default data cycle time in microseconds otherwise. */
    int64_t const get_data_cycle_time_micros_for_obj( unsigned int const obj_index,
@@ -832,6 +1056,66 @@ class Federate
       return RTI_ambassador.get();
    }
 
+   /*! @brief Get the attribute update publisher thread if it is running.
+    *  @return Pointer to the running publisher, or NULL if the attribute
+    *  updates should be sent from the calling thread. */
+   AsyncPublisher *get_async_publisher()
+   {
+      return async_publisher.is_running() ? &async_publisher : NULL;
+   }
+
+   /*! @brief Get the mutex that serializes the attribute updates sent to the
+    *  RTI from the Trick main and child threads, which only locks when
+    *  child_thread_data_exchange is enabled.
+    *  @return Pointer to the RTI update mutex. */
+   MutexLock *get_rti_update_mutex()
+   {
+      return &rti_update_mutex;
+   }
+
+   /*! @brief Are the latency histograms being recorded.
+    *  @return True if latency statistics are enabled. */
+   bool is_latency_stats_enabled() const
+   {
+      return this->latency_stats;
+   }
+
+   /*! @brief Print the latency percentiles for the federate, interactions
+    *  and objects. */
+   void print_latency_stats();
+
+   /*! @brief Is this a reflection of the MOM HLAfederate time state the
+    *  time stall profiler asked for.
+    *  @return True if the time stall profiler takes the values.
+    *  @param values The reflected attribute values. */
+   bool is_time_stall_reflection( RTI1516_NAMESPACE::AttributeHandleValueMap const &values ) const
+   {
+      return stall_profiler.is_time_state_reflection( values );
+   }
+
+   /*! @brief Update the time stall profiler from a reflection of the MOM
+    *  HLAfederate time state.
+    *  @param instance_hndl MOM HLAfederate object instance handle.
+    *  @param values        The reflected attribute values. */
+   void reflect_time_stall_state( RTI1516_NAMESPACE::ObjectInstanceHandle const    &instance_hndl,
+                                  RTI1516_NAMESPACE::AttributeHandleValueMap const &values )
+   {
+      stall_profiler.reflect_time_state( instance_hndl, values );
+   }
+
+   /*! @brief Forget a federate in the time stall profiler.
+    *  @param instance_hndl MOM HLAfederate object instance handle. */
+   void remove_time_stall_federate( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl )
+   {
+      if ( stall_profiler.is_initialized() ) {
+         stall_profiler.remove_federate( instance_hndl );
+      }
+   }
+
+   /*! @brief Print the Time Advance Grant stalls and the federates that
+    *  limited them. */
+   void print_time_stall_report();
+
    /*! @brief Get the pointer to the associated TrickHLA Federate Ambassador instance.
     *  @return Pointer to associated TrickHLA::FedAmb. */
    FedAmb *get_fed_ambassador()
@@ -895,6 +1179,34 @@ class Federate
       return this->requested_time;
    }
 
+   /*! @brief Is a Next Message Request used for the time advance.
+    *  @return True for the TIME_ADVANCE_MODE_NMR and TIME_ADVANCE_MODE_NMRA modes. */
+   bool const is_next_message_mode() const
+   {
+      return ( ( this->time_advance_mode == TIME_ADVANCE_MODE_NMR )
+               || ( this->time_advance_mode == TIME_ADVANCE_MODE_NMRA ) );
+   }
+
+   /*! @brief Get the HLA time the timestamps of the data sent this frame
+    *  start from, which is the requested time while a batched Time Advance
+    *  Request is outstanding and the granted time otherwise.
+    *  @return HLA time in microseconds. */
+   int64_t const get_send_base_time_in_micros() const
+   {
+      return ( ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH )
+               && ( this->requested_time > this->granted_time ) )
+                ? this->requested_time.get_time_in_micros()
+                : this->granted_time.get_time_in_micros();
+   }
+
+   /*! @brief Set the HLA time of the next event of this federate, which is
+    *  how far a Next Message Request asks to advance when there are no
+    *  messages before it, and the latest frame a batched Time Advance Request
+    *  goes to, so set it before the frame a timestamped interaction is sent
+    *  in. A time at or before the next frame has no effect.
+    *  @param time HLA time of the next event in seconds. */
+   void set_next_event_time( double const time );
+
    /*! @brief Get the current federate lookahead time.
     *  @return Reference to current federate lookahead time. */
    Int64Interval const &get_lookahead() const
@@ -916,6 +1228,12 @@ class Federate
       return ( this->lookahead.get_time_in_micros() <= 0LL );
    }
 
+   /*! @brief Record the distance from the granted time of a timestamp this
+    *  federate sends data at, for the adaptive lookahead. This can be called
+    *  from any thread.
+    *  @param distance_micros Send time minus the granted time in microseconds. */
+   void record_send_distance( int64_t const distance_micros );
+
    /*! @brief Set the name of the save.
     *  @param save_label Save name. */
    void set_save_name( std::wstring const &save_label )
@@ -1011,6 +1329,33 @@ class Federate
     *  @param value HLA lookahead time in seconds. */
    void set_lookahead( double value );
 
+   /*! @brief Adjust the adaptive lookahead to the send timestamps tracked
+    *  over the last adaptive_lookahead_frames Time Advance Grants, which must
+    *  be called while the time is granted. */
+   void update_adaptive_lookahead();
+
+   /*! @brief Deliver the pending RTI callbacks within the callback_budget
+    *  when the callbacks are evoked, which is done at the top of the frame. */
+   void deliver_evoked_callbacks();
+
+   /*! @brief Prepare the memory for the real-time frames and arm the
+    *  allocation guard, as configured by the real_time_memory, lock_memory
+    *  and allocation_guard settings. */
+   void prepare_real_time_memory();
+
+   /*! @brief Print the effective CPU affinity and scheduling of the Trick
+    *  main thread and the threads TrickHLA configures, which is done at
+    *  startup when any thread is configured or for debug level 1. */
+   void print_thread_report();
+
+   /*! @brief Get the MOM HLAfederate time state attribute handles and
+    *  subscribe to them for the time stall profiler. */
+   void setup_time_stall_profiler();
+
+   /*! @brief Query the GALT and ask for the MOM time state of the joined
+    *  federates once a Time Advance Request to Grant wait is a stall. */
+   void query_time_stall_state();
+
    /*! @brief Set start to save flag.
     *  @param save_flag True if save started; False otherwise. */
    void set_start_to_save( bool save_flag )
@@ -1104,6 +1449,13 @@ class Federate
 
    Int64Interval lookahead; ///< @trick_units{--} Lookahead time for data.
 
+   int64_t      lookahead_pending_micros; ///< @trick_io{**} Lower adaptive lookahead not yet safe to send with, or -1 for none.
+   Int64Time    lookahead_pending_time;   ///< @trick_io{**} Granted time at which the lower adaptive lookahead is safe to send with.
+   int64_t      min_send_distance_micros; ///< @trick_io{**} Smallest send time minus granted time in the current adaptive lookahead window.
+   unsigned int lookahead_window_grants;  ///< @trick_io{**} Time Advance Grants in the current adaptive lookahead window.
+   unsigned int lookahead_window_waits;   ///< @trick_io{**} TAR to TAG waits measured in the current adaptive lookahead window.
+   int64_t      lookahead_window_wait_ns; ///< @trick_io{**} Sum of the TAR to TAG waits in the current adaptive lookahead window.
+
    bool shutdown_called; ///< @trick_units{--} Flag to indicate shutdown has been called.
 
    std::wstring save_name;    ///< @trick_io{**} Name for a save file
@@ -1160,6 +1512,8 @@ class Federate
    MutexLock    time_adv_state_mutex; ///< @trick_units{--} HLA Time advance state mutex lock.
    Int64Time    granted_time;         ///< @trick_units{--} HLA time given by RTI
    Int64Time    requested_time;       ///< @trick_units{--} requested/desired HLA time
+   Int64Time    next_event_time;      ///< @trick_units{--} HLA time of the next event of this federate for the Next Message Request modes.
+   Int64Time    batch_frame_time;     ///< @trick_units{--} HLA time of the current frame for the batched time advance mode.
    double       HLA_time;             ///< @trick_units{s}  Current HLA time to allow for plotting.
    bool         start_to_save;        ///< @trick_io{**} Save flag
    bool         start_to_restore;     ///< @trick_io{**} Restore flag
@@ -1169,6 +1523,8 @@ class Federate
    bool time_regulating_state;  ///< @trick_units{--} Internal flag, federates HLA Time Regulation state (default: false).
    bool time_constrained_state; ///< @trick_units{--} Internal flag, federates HLA Time Constrained state (default: false).
 
+   bool pipelined_grant_pending; ///< @trick_io{**} True while a pipelined frame runs ahead of its Time Advance Grant.
+
    bool got_startup_sync_point;     ///< @trick_units{--} "startup" Sync-Point has been created. For DIS compatibility
    bool make_copy_of_run_directory; ///< @trick_units{--} Make a backup of RUN directory before restarting the federation via federation manager (default: false).
 
@@ -1195,6 +1551,24 @@ class Federate
 
    TrickThreadCoordinator thread_coordinator; ///< @trick_units{--} Trick child thread coordinator with HLA.
 
+   AsyncPublisher async_publisher; ///< @trick_io{**} Publisher thread for the attribute updates.
+
+   MutexLock rti_update_mutex; ///< @trick_io{**} Serializes the attribute updates sent from more than one thread.
+
+   LatencyHistogram tag_wait_stats;               ///< @trick_io{**} Time Advance Request to Grant wait latency.
+   int64_t          tar_begin_ns;                 ///< @trick_io{**} Time of the last Time Advance Request in nanoseconds.
+   int64_t          next_latency_stats_report_ns; ///< @trick_io{**} Time of the next latency report in nanoseconds.
+
+   MetricsRegistry metrics_registry; ///< @trick_io{**} Runtime metrics in shared memory.
+
+   TimeStallProfiler                     stall_profiler;       ///< @trick_io{**} Finds the federates holding back our Time Advance Grants.
+   RTI1516_NAMESPACE::AttributeHandleSet stall_MOM_attributes; ///< @trick_io{**} MOM HLAfederate time state attributes.
+   int64_t                               stall_GALT_micros;    ///< @trick_io{**} GALT queried in the current stall, -1 if not known.
+   bool                                  stall_queried;        ///< @trick_io{**} True once the current stall has been queried.
+   int64_t                               next_stall_report_ns; ///< @trick_io{**} Time of the next stall report in nanoseconds.
+
+   bool allocation_warned; ///< @trick_io{**} True once an allocation in a guarded job has been reported.
+
    // Federation required associations.
    //
 #pragma GCC diagnostic push
@@ -28,6 +28,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, July 2020, --, Changed function names to match TrickHLA coding style.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added Int64TimeValue conversions and the Int64TimeCache.}
 @revs_end
 
 */
@@ -43,6 +44,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA includes
 #include "TrickHLA/Int64Interval.hh"
+#include "TrickHLA/Int64TimeValue.hh"
 #include "TrickHLA/StandardsSupport.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -96,6 +98,10 @@ class Int64Time
     *  @param value HLA 64bit Integer Time value initialization. */
    explicit Int64Time( RTI1516_NAMESPACE::HLAinteger64Time const &value );
 
+   /*! @brief Initialization constructor for the TrickHLA Int64Time class.
+    *  @param value TrickHLA integer microseconds time value initialization. */
+   explicit Int64Time( Int64TimeValue const &value );
+
    /*! @brief Copy constructor for the TrickHLA Int64Time class.
     *  @param value TrickHLA Long Integer Time value initialization. */
    Int64Time( Int64Time const &value );
@@ -302,12 +308,19 @@ class Int64Time
    // Interface routines
    //
    /*! @brief Get the HLA integer time.
-    *  @return A copy of the encapsulated HLAinteger64Time class. */
-   RTI1516_NAMESPACE::HLAinteger64Time get() const
+    *  @return A reference to the encapsulated HLAinteger64Time class. */
+   RTI1516_NAMESPACE::HLAinteger64Time const &get() const
    {
       return ( hla_time );
    }
 
+   /*! @brief Get the time as a plain integer microseconds value.
+    *  @return The time as a TrickHLA::Int64TimeValue. */
+   Int64TimeValue const get_value() const
+   {
+      return Int64TimeValue( get_time_in_micros() );
+   }
+
    // decodes the HLA encoded time into encapsulated class
    /*! @brief Saves the incoming HLA encoded LogicalTime into the encapsulated class.
     *  @param user_supplied_tag Time encoded in user supplied tag. */
@@ -348,6 +361,10 @@ class Int64Time
     *  @param value The desired time as a TrickHLA::Int64Time. */
    void set( Int64Time const &value );
 
+   /*! @brief Set the time to the given value.
+    *  @param value The desired time as a TrickHLA::Int64TimeValue. */
+   void set( Int64TimeValue const &value );
+
   private:
    /*! @brief Return the whole seconds part of the current timestamp.
     *  @return The whole seconds part of the timestamp in seconds. */
@@ -362,6 +379,74 @@ class Int64Time
 
 }; // end of Int64Time class
 
+// Number of distinct update times an Int64TimeCache holds.
+#define THLA_INT64_TIME_CACHE_SIZE 8
+
+/*!
+ * @brief Converted HLA times of one frame, so that every object sent with the
+ * same update time shares one HLAinteger64Time instead of converting the time
+ * again for each object. Call clear() at the start of each frame.
+ */
+class Int64TimeCache
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__Int64TimeCache();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA Int64TimeCache class. */
+   Int64TimeCache() : count( 0 )
+   {
+      return;
+   }
+
+   /*! @brief Forget the times of the previous frame. */
+   void clear()
+   {
+      this->count = 0;
+   }
+
+   /*! @brief Get the HLA time for the given time, converting it only the
+    *  first time it is asked for in this frame. When the cache is full the
+    *  last entry is reused, so the returned reference is only valid until the
+    *  next call.
+    *  @return The HLA time as a TrickHLA::Int64Time.
+    *  @param value The time in integer microseconds. */
+   Int64Time const &get( Int64TimeValue const &value )
+   {
+      for ( unsigned int i = 0; i < this->count; ++i ) {
+         if ( values[i] == value ) {
+            return times[i];
+         }
+      }
+      unsigned int const i = ( this->count < THLA_INT64_TIME_CACHE_SIZE )
+                                ? this->count++
+                                : ( THLA_INT64_TIME_CACHE_SIZE - 1 );
+      values[i] = value;
+      times[i].set( value );
+      return times[i];
+   }
+
+  private:
+   unsigned int   count;                              ///< @trick_io{**} Number of cached times.
+   Int64TimeValue values[THLA_INT64_TIME_CACHE_SIZE]; ///< @trick_io{**} Cached times in microseconds.
+   Int64Time      times[THLA_INT64_TIME_CACHE_SIZE];  ///< @trick_io{**} Cached converted HLA times.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for Int64TimeCache class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   Int64TimeCache( Int64TimeCache const &rhs );
+   /*! @brief Assignment operator for Int64TimeCache class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   Int64TimeCache &operator=( Int64TimeCache const &rhs );
+};
+
 } // namespace TrickHLA
 
 #endif // TRICKHLA_INT64_TIME_HH
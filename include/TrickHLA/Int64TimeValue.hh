@@ -0,0 +1,181 @@
+/*!
+@file TrickHLA/Int64TimeValue.hh
+@ingroup TrickHLA
+@brief This class represents the HLA time as a plain 64 bit integer count of
+microseconds.
+
+Unlike the TrickHLA::Int64Time, which wraps the RTI vendor HLAinteger64Time
+class with its virtual functions, this class is trivially copyable so the time
+arithmetic and comparisons of the per frame scheduling and send paths are done
+on integers. The value is converted to an HLAinteger64Time, through the
+TrickHLA::Int64Time, only where the time is handed to the RTI.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../source/TrickHLA/Int64Interval.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_INT64_TIME_VALUE_HH
+#define TRICKHLA_INT64_TIME_VALUE_HH
+
+// System include files.
+#include <cstdint>
+
+// TrickHLA include files.
+#include "TrickHLA/Constants.hh"
+
+namespace TrickHLA
+{
+
+class Int64TimeValue
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__Int64TimeValue();
+
+  public:
+   // NOTE: Do not add a copy constructor, assignment operator, destructor
+   // or virtual function, which would make this class no longer trivially
+   // copyable.
+
+   /*! @brief Default constructor for the TrickHLA Int64TimeValue class. */
+   Int64TimeValue() : micros( 0LL )
+   {
+      return;
+   }
+
+   /*! @brief Initialization constructor for the TrickHLA Int64TimeValue class.
+    *  @param value Time in integer microseconds. */
+   explicit Int64TimeValue( int64_t const value ) : micros( value )
+   {
+      return;
+   }
+
+   /*! @brief Addition operator.
+    *  @return The time plus the interval.
+    *  @param interval_micros Time interval in integer microseconds. */
+   Int64TimeValue operator+( int64_t const interval_micros ) const
+   {
+      return Int64TimeValue( this->micros + interval_micros );
+   }
+
+   /*! @brief Addition then assignment operator.
+    *  @return This time plus the interval.
+    *  @param interval_micros Time interval in integer microseconds. */
+   Int64TimeValue &operator+=( int64_t const interval_micros )
+   {
+      this->micros += interval_micros;
+      return ( *this );
+   }
+
+   /*! @brief Subtraction operator.
+    *  @return The time interval between the two times in integer microseconds.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   int64_t operator-( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros - rhs.micros );
+   }
+
+   /*! @brief Less than comparison operator.
+    *  @return True if this time is less than the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator<( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros < rhs.micros );
+   }
+
+   /*! @brief Greater than comparison operator.
+    *  @return True if this time is greater than the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator>( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros > rhs.micros );
+   }
+
+   /*! @brief Less than or equal to comparison operator.
+    *  @return True if this time is less than or equal to the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator<=( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros <= rhs.micros );
+   }
+
+   /*! @brief Greater than or equal to comparison operator.
+    *  @return True if this time is greater than or equal to the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator>=( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros >= rhs.micros );
+   }
+
+   /*! @brief Equals comparison operator.
+    *  @return True if this time is equal to the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator==( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros == rhs.micros );
+   }
+
+   /*! @brief Not equal to comparison operator.
+    *  @return True if this time is not equal to the right operand; False otherwise.
+    *  @param rhs Right hand side operand as a TrickHLA::Int64TimeValue. */
+   bool operator!=( Int64TimeValue const &rhs ) const
+   {
+      return ( this->micros != rhs.micros );
+   }
+
+   /*! @brief Get the time in microseconds.
+    *  @return Time in integer microseconds. */
+   int64_t get_time_in_micros() const
+   {
+      return this->micros;
+   }
+
+   /*! @brief Get the time in seconds.
+    *  @return Time in seconds as a floating point double. */
+   double get_time_in_seconds() const
+   {
+      return ( (double)( this->micros / MICROS_MULTIPLIER )
+               + ( (double)( this->micros % MICROS_MULTIPLIER ) / (double)MICROS_MULTIPLIER ) );
+   }
+
+   /*! @brief Set the time.
+    *  @param value Time in integer microseconds. */
+   void set( int64_t const value )
+   {
+      this->micros = value;
+   }
+
+  private:
+   int64_t micros; ///< @trick_units{--} HLA time in integer microseconds.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_INT64_TIME_VALUE_HH: Do NOT put anything after this line!
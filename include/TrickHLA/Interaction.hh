@@ -26,6 +26,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../source/TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../source/TrickHLA/InteractionHandler.cpp}
 @trick_link_dependency{../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../source/TrickHLA/MetricsRegistry.cpp}
 @trick_link_dependency{../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../source/TrickHLA/Parameter.cpp}
 @trick_link_dependency{../source/TrickHLA/Types.cpp}
@@ -35,6 +36,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Aug 2006, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics.}
 @revs_end
 
 */
@@ -50,6 +52,7 @@ NASA, Johnson Space Center\n
 // TrickHLA include files
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/Types.hh"
@@ -340,6 +343,20 @@ class Interaction
       return preferred_order;
    }
 
+   /*! @brief Set the runtime metrics entry for this interaction.
+    *  @param entry The metrics entry, or NULL for none. */
+   void set_metrics( MetricsEntry *entry )
+   {
+      metrics = entry;
+   }
+
+   /*! @brief Get the runtime metrics entry for this interaction.
+    *  @return The metrics entry, or NULL if metrics are disabled. */
+   MetricsEntry *get_metrics()
+   {
+      return metrics;
+   }
+
    MutexLock mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
   private:
@@ -356,6 +373,12 @@ class Interaction
    size_t         user_supplied_tag_capacity; ///< @trick_units{--} Capacity of the user supplied tag.
    unsigned char *user_supplied_tag;          ///< @trick_units{--} User supplied tag data.
 
+   MetricsEntry *metrics; ///< @trick_io{**} Runtime metrics for this interaction, NULL if disabled.
+
+   /*! @brief Count the parameter values just sent in the runtime metrics.
+    *  @param param_values_map The parameter values sent. */
+   void record_sent_metrics( RTI1516_NAMESPACE::ParameterHandleValueMap const &param_values_map );
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for Interaction class.
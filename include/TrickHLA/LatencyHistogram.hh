@@ -0,0 +1,160 @@
+/*!
+@file TrickHLA/LatencyHistogram.hh
+@ingroup TrickHLA
+@brief This class is a fixed memory, lock-free latency histogram that reports
+percentiles.
+
+The buckets follow the HDR (High Dynamic Range) histogram layout: values below
+THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT nanoseconds have their own bucket, and
+above that every power of two range is split into half that many linear
+buckets, so any recorded value is within 1/32 (about 3%) of the value
+reported for its bucket. Values up to about 68 seconds are resolved, and
+larger values are counted in the last bucket. The minimum, maximum and mean
+are exact.
+
+Recording a value is a few relaxed atomic operations and never allocates or
+blocks, so values can be recorded from any thread, and a summary can be
+taken from another thread while values are being recorded.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_LATENCY_HISTOGRAM_HH
+#define TRICKHLA_LATENCY_HISTOGRAM_HH
+
+// System include files.
+#include <cstdint>
+#include <string>
+
+// Number of linear buckets for the smallest values, which sets the precision.
+#define THLA_LATENCY_HISTOGRAM_SUB_BUCKET_BITS 6
+#define THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT ( 1 << THLA_LATENCY_HISTOGRAM_SUB_BUCKET_BITS )
+
+// Values are resolved up to 2^36 nanoseconds, which is about 68 seconds.
+#define THLA_LATENCY_HISTOGRAM_MAX_VALUE_BITS 36
+
+#define THLA_LATENCY_HISTOGRAM_BUCKET_COUNT                                       \
+   ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT                                      \
+     + ( ( THLA_LATENCY_HISTOGRAM_MAX_VALUE_BITS - THLA_LATENCY_HISTOGRAM_SUB_BUCKET_BITS ) \
+         * ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 ) ) )
+
+namespace TrickHLA
+{
+
+class LatencyHistogram
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__LatencyHistogram();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA LatencyHistogram class. */
+   LatencyHistogram();
+   /*! @brief Destructor for the TrickHLA LatencyHistogram class. */
+   virtual ~LatencyHistogram();
+
+   /*! @brief Get the monotonic clock time to measure a latency with.
+    *  @return The time in nanoseconds. */
+   static int64_t now();
+
+   /*! @brief Record a latency value.
+    *  @param value_ns Latency in nanoseconds, where negative values are
+    *  recorded as zero. */
+   void record( int64_t const value_ns );
+
+   /*! @brief Record the latency from the given begin time until now.
+    *  @param begin_ns Begin time from now() in nanoseconds. */
+   void record_since( int64_t const begin_ns )
+   {
+      record( now() - begin_ns );
+   }
+
+   /*! @brief Clear all the recorded values. This is not atomic with respect
+    *  to values being recorded at the same time. */
+   void reset();
+
+   /*! @brief Get the number of values recorded.
+    *  @return Number of values recorded. */
+   unsigned long long const get_count() const;
+
+   /*! @brief Get the minimum value recorded.
+    *  @return Minimum value in nanoseconds, or 0 if nothing was recorded. */
+   int64_t const get_min() const;
+
+   /*! @brief Get the maximum value recorded.
+    *  @return Maximum value in nanoseconds, or 0 if nothing was recorded. */
+   int64_t const get_max() const;
+
+   /*! @brief Get the mean of the values recorded.
+    *  @return Mean value in nanoseconds, or 0 if nothing was recorded. */
+   double const get_mean() const;
+
+   /*! @brief Get the value at or below which the given percentage of the
+    *  recorded values fall.
+    *  @return Value in nanoseconds, or 0 if nothing was recorded.
+    *  @param percentile Percentile from 0 to 100 (e.g. 99.9). */
+   int64_t const get_value_at_percentile( double const percentile ) const;
+
+   /*! @brief Returns a one line summary of the count, minimum, percentiles,
+    *  maximum and mean in microseconds. */
+   std::string const to_string() const;
+
+  protected:
+   unsigned long long counts[THLA_LATENCY_HISTOGRAM_BUCKET_COUNT]; ///< @trick_io{**} Number of values in each bucket.
+
+   unsigned long long total_count; ///< @trick_io{**} Number of values recorded.
+   unsigned long long total_sum;   ///< @trick_io{**} Sum of the values recorded in nanoseconds.
+   int64_t            min_value;   ///< @trick_io{**} Minimum value recorded in nanoseconds.
+   int64_t            max_value;   ///< @trick_io{**} Maximum value recorded in nanoseconds.
+
+   /*! @brief Get the bucket index for a value.
+    *  @return Bucket index.
+    *  @param value_ns Value in nanoseconds. */
+   static unsigned int const get_bucket_index( uint64_t const value_ns );
+
+   /*! @brief Get the highest value that maps to a bucket.
+    *  @return Highest value of the bucket in nanoseconds.
+    *  @param index Bucket index. */
+   static int64_t const get_bucket_highest_value( unsigned int const index );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for LatencyHistogram class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   LatencyHistogram( LatencyHistogram const &rhs );
+   /*! @brief Assignment operator for LatencyHistogram class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   LatencyHistogram &operator=( LatencyHistogram const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_LATENCY_HISTOGRAM_HH: Do NOT put anything after this line!
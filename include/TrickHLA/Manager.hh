@@ -23,9 +23,13 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../source/TrickHLA/ExecutionControlBase.cpp}
 @trick_link_dependency{../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../source/TrickHLA/ItemQueue.cpp}
+@trick_link_dependency{../source/TrickHLA/Int64Interval.cpp}
+@trick_link_dependency{../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../source/TrickHLA/InteractionItem.cpp}
+@trick_link_dependency{../source/TrickHLA/LatencyHistogram.cpp}
 @trick_link_dependency{../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../source/TrickHLA/MetricsRegistry.cpp}
 @trick_link_dependency{../source/TrickHLA/MutexLock.cpp}
 @trick_link_dependency{../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../source/TrickHLA/Types.cpp}
@@ -36,6 +40,16 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, Jan 2019, --, SRFOM support and testing.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer memory report and shrink hook.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Child thread object data exchange.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Object index lookup for frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Interaction processing latency histogram.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics registration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Batched and pipelined time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Integer update times with a per frame HLA time cache.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Single threaded data path for evoked callbacks.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Persistent HLA time caches for the Trick child threads.}
 @revs_end
 
 */
@@ -49,7 +63,11 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/ExecutionControlBase.hh"
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/Int64TimeValue.hh"
 #include "TrickHLA/ItemQueue.hh"
+#include "TrickHLA/LatencyHistogram.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/StandardsSupport.hh"
@@ -202,6 +220,32 @@ class Manager
    /*! @brief Handle the received cyclic data. */
    void receive_cyclic_data();
 
+   /*! @brief Send the cyclic and requested attribute data for the objects
+    *  associated to a Trick child thread, called from that child thread.
+    *  @param thread_id Trick child thread-id. */
+   void send_cyclic_and_requested_data_for_child_thread( unsigned int const thread_id );
+
+   /*! @brief Get the number of frames from the current one to the next frame
+    *  in which any object sends an attribute update, from the data cycle of
+    *  each object and the sub-rate of its attributes.
+    *  @return Frames to the next send, from 1 up to max_frames.
+    *  @param frame_micros Time between the frames in microseconds.
+    *  @param max_frames   Most frames to look ahead. */
+   unsigned int const get_frames_to_next_send( int64_t const      frame_micros,
+                                                unsigned int const max_frames ) const;
+
+   /*! @brief Determine if the received cyclic data of every object is only
+    *  needed at the end of the model step, so the frame can run while the
+    *  Time Advance Grant is pending.
+    *  @return True if every object we receive cyclic data for has a late
+    *  data dependence and is received by the Trick main thread. */
+   bool const is_late_data_dependence_only();
+
+   /*! @brief Handle the received cyclic data for the objects associated to a
+    *  Trick child thread, called from that child thread.
+    *  @param thread_id Trick child thread-id. */
+   void receive_cyclic_data_for_child_thread( unsigned int const thread_id );
+
    /*! @brief Process the object discovery.
     *  @return True if the instance was recognized, false otherwise.
     *  @param theObject             Instance handle to a Federate or Object instance.
@@ -221,6 +265,15 @@ class Manager
     *  @param obj_instance_name Object instance name. */
    Object *get_trickhla_object( std::wstring const &obj_instance_name );
 
+   /*! @brief Gets the index of a TrickHLA Object in the objects array.
+    *  @return Object index, or -1 if the object is not in the array, such as
+    *  the ExecutionConfiguration object.
+    *  @param obj The TrickHLA Object. */
+   int get_object_index( Object const *obj ) const
+   {
+      return ( ( obj >= objects ) && ( obj < ( objects + obj_count ) ) ) ? (int)( obj - objects ) : -1;
+   }
+
    /*! @brief The object instance name reservation succeeded for the given name.
     *  @param obj_instance_name Object instance name. */
    void object_instance_name_reservation_succeeded( std::wstring const &obj_instance_name );
@@ -417,6 +470,36 @@ class Manager
       return interactions;
    }
 
+   /*! @brief Print a report of the buffer capacity against the bytes used
+    *  for each object and attribute, and each interaction and parameter. */
+   void print_buffer_memory_report();
+
+   /*! @brief Shrink the buffers of all the object attributes and interaction
+    *  parameters to the bytes they currently hold, for example after a
+    *  transient burst of large updates. */
+   void shrink_buffers_to_fit();
+
+   /*! @brief Grow the buffers of all the object attributes and interaction
+    *  parameters to their configured maximum size and prefault them, so the
+    *  real-time frames do not allocate or page fault on them. */
+   void prepare_buffers_for_real_time();
+
+   /*! @brief Skip the locking of the object, interaction and queue mutexes
+    *  shared by the RTI callbacks and the data exchange jobs, which is only
+    *  safe when the callbacks are evoked on the thread that runs those jobs.
+    *  @param single_thread True to not lock the mutexes. */
+   void set_single_threaded( bool const single_thread );
+
+   /*! @brief Get the number of runtime metrics entries needed for all the
+    *  objects, attributes and interactions.
+    *  @return The number of entries. */
+   unsigned int const get_metrics_entry_count() const;
+
+   /*! @brief Add the runtime metrics entries for all the objects, attributes
+    *  and interactions, and hand them to the objects and interactions.
+    *  @param registry The metrics registry, which must be initialized. */
+   void register_metrics( MetricsRegistry &registry );
+
    /*! @brief Reset the manager as initialized. */
    void reset_mgr_initialized()
    {
@@ -465,6 +548,11 @@ class Manager
 
    int64_t job_cycle_time_micros; // us Cycle time for the send_cyclic_and_requested_data and recieve_cyclic_data jobs
 
+   Int64TimeCache update_time_cache; ///< @trick_io{**} HLA update times of the current frame for the Trick main thread.
+
+   Int64TimeCache *thread_time_caches;    ///< @trick_io{**} HLA update times of the current frame for each Trick thread-id.
+   unsigned int    thread_time_cache_cnt; ///< @trick_io{**} Number of thread_time_caches, one per Trick thread.
+
    bool rejoining_federate; ///< @trick_units{--} Internal flag to indicate if the federate is rejoining the federation.
    bool restore_determined; ///< @trick_io{**} Internal flag to indicate that the restore status has been determined.
    bool restore_federate;   ///< @trick_io{**} Internal flag to indicate if the federate is to be restored
@@ -477,6 +565,8 @@ class Manager
 
    bool federate_has_been_restored; ///< @trick_io{**} Federate has been restored. do not reserve the object names again!
 
+   LatencyHistogram interaction_stats; ///< @trick_io{**} Latency of processing each received interaction.
+
    Federate *federate; ///< @trick_units{--} Associated TrickHLA Federate.
 
    ExecutionControlBase *execution_control; /**< @trick_units{--}
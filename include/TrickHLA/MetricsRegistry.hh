@@ -0,0 +1,195 @@
+/*!
+@file TrickHLA/MetricsRegistry.hh
+@ingroup TrickHLA
+@brief This class keeps the runtime counters for the objects, attributes and
+interactions in a shared memory segment that a monitor process can read.
+
+The segment starts with a MetricsHeader followed by an array of MetricsEntry
+records, one for each object, followed by one for each of its attributes, and
+one for each interaction. The counters are only updated with relaxed atomic
+operations in place, so the federate never waits on a reader, and a reader
+never has to lock anything. The magic string in the header is written last,
+so a reader knows the entries are complete once it sees it. The reader tool
+is scripts/trickhla_metrics.py.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/MetricsRegistry.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Adaptive lookahead values.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_METRICS_REGISTRY_HH
+#define TRICKHLA_METRICS_REGISTRY_HH
+
+// System include files.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// The layout version must change whenever the structures below change.
+#define THLA_METRICS_MAGIC "THLAMTR"
+#define THLA_METRICS_VERSION 2
+#define THLA_METRICS_NAME_SIZE 96
+
+namespace TrickHLA
+{
+
+typedef enum {
+   METRICS_OBJECT      = 0, ///< Counters for an object instance.
+   METRICS_ATTRIBUTE   = 1, ///< Counters for an attribute of an object.
+   METRICS_INTERACTION = 2  ///< Counters for an interaction class.
+} MetricsKindEnum;
+
+// Counters for one object, attribute or interaction in the shared segment.
+typedef struct {
+   char               name[THLA_METRICS_NAME_SIZE]; ///< @trick_io{**} Object instance, attribute or interaction FOM name.
+   unsigned int       kind;                         ///< @trick_io{**} One of MetricsKindEnum.
+   int                parent;                       ///< @trick_io{**} Index of the object entry for an attribute, otherwise -1.
+   unsigned long long updates_sent;                 ///< @trick_io{**} Number of updates or interactions sent.
+   unsigned long long updates_received;             ///< @trick_io{**} Number of reflections or interactions received.
+   unsigned long long bytes_sent;                   ///< @trick_io{**} Number of encoded bytes sent.
+   unsigned long long bytes_received;               ///< @trick_io{**} Number of encoded bytes received.
+   unsigned long long reflections_queued;           ///< @trick_io{**} Number of reflections or interactions queued for the main thread.
+   unsigned long long reflections_coalesced;        ///< @trick_io{**} Number of reflections overwritten by a newer one in the same frame.
+   unsigned long long queue_depth_high_water;       ///< @trick_io{**} Largest number of queued reflections or interactions.
+} MetricsEntry;
+
+// Federate wide values at the start of the shared segment.
+typedef struct {
+   char               magic[8];                              ///< @trick_io{**} THLA_METRICS_MAGIC once the entries are complete.
+   unsigned int       version;                               ///< @trick_io{**} THLA_METRICS_VERSION.
+   unsigned int       header_size;                           ///< @trick_io{**} Size of this header in bytes.
+   unsigned int       entry_size;                            ///< @trick_io{**} Size of a MetricsEntry in bytes.
+   unsigned int       entry_count;                           ///< @trick_io{**} Number of entries after the header.
+   int                pid;                                   ///< @trick_io{**} Process ID of the federate.
+   unsigned int       reserved;                              ///< @trick_io{**} Padding for alignment.
+   char               federate_name[THLA_METRICS_NAME_SIZE]; ///< @trick_io{**} Name of the federate.
+   long long          granted_time_micros;                   ///< @trick_io{**} Last granted HLA time in microseconds.
+   unsigned long long tag_count;                             ///< @trick_io{**} Number of Time Advance Grants.
+   unsigned long long tag_wait_total_ns;                     ///< @trick_io{**} Total Time Advance Request to Grant wait.
+   unsigned long long tag_wait_max_ns;                       ///< @trick_io{**} Longest Time Advance Request to Grant wait.
+   unsigned long long tag_wait_last_ns;                      ///< @trick_io{**} Last Time Advance Request to Grant wait.
+   long long          lookahead_micros;                      ///< @trick_io{**} Adaptive lookahead in microseconds, zero if not adaptive.
+   long long          send_distance_micros;                  ///< @trick_io{**} Smallest send time minus granted time of the last adaptive window, -1 for none.
+   unsigned long long lookahead_changes;                     ///< @trick_io{**} Number of adaptive lookahead changes.
+} MetricsHeader;
+
+class MetricsRegistry
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__MetricsRegistry();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA MetricsRegistry class. */
+   MetricsRegistry();
+   /*! @brief Destructor for the TrickHLA MetricsRegistry class. */
+   virtual ~MetricsRegistry();
+
+   /*! @brief Create and map the shared memory segment.
+    *  @return True on success, false if the segment could not be created.
+    *  @param segment_name  POSIX shared memory name, such as "/TrickHLA_fed".
+    *  @param federate_name Name of the federate.
+    *  @param entry_count   Number of entries to make room for. */
+   bool initialize( char const        *segment_name,
+                    char const        *federate_name,
+                    unsigned int const entry_count );
+
+   /*! @brief Is the shared memory segment mapped.
+    *  @return True if the registry is initialized. */
+   bool is_initialized() const
+   {
+      return ( header != NULL );
+   }
+
+   /*! @brief Add the next entry, which must be done before publish().
+    *  @return The entry, or NULL if there is no room.
+    *  @param kind   Kind of entry.
+    *  @param name   Name for the entry.
+    *  @param parent Object entry for an attribute, otherwise NULL. */
+   MetricsEntry *add_entry( MetricsKindEnum const kind,
+                            char const           *name,
+                            MetricsEntry const   *parent );
+
+   /*! @brief Mark the entries as complete for the readers. */
+   void publish();
+
+   /*! @brief Record a Time Advance Grant.
+    *  @param wait_ns             Time Advance Request to Grant wait in nanoseconds.
+    *  @param granted_time_micros Granted HLA time in microseconds. */
+   void record_time_advance_grant( int64_t const wait_ns,
+                                   int64_t const granted_time_micros );
+
+   /*! @brief Record the adaptive lookahead at the end of a window.
+    *  @param lookahead_micros     Lookahead in microseconds.
+    *  @param send_distance_micros Smallest send distance of the window in microseconds, -1 for none.
+    *  @param changed              True if the lookahead was changed. */
+   void record_lookahead( int64_t const lookahead_micros,
+                          int64_t const send_distance_micros,
+                          bool const    changed );
+
+   /*! @brief Unmap and remove the shared memory segment. */
+   void shutdown();
+
+   /*! @brief Add to a counter from any thread.
+    *  @param counter The counter.
+    *  @param value   Amount to add. */
+   static void add( unsigned long long &counter,
+                    unsigned long long  value )
+   {
+      __atomic_add_fetch( &counter, value, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Raise a high-water mark from any thread.
+    *  @param counter The high-water mark.
+    *  @param value   The current value. */
+   static void update_high_water( unsigned long long &counter,
+                                  unsigned long long  value );
+
+  protected:
+   std::string segment_name; ///< @trick_io{**} POSIX shared memory name.
+   size_t      segment_size; ///< @trick_io{**} Size of the mapped segment in bytes.
+
+   MetricsHeader *header;     ///< @trick_io{**} Start of the mapped segment.
+   MetricsEntry  *entries;    ///< @trick_io{**} Entries following the header.
+   unsigned int   entry_used; ///< @trick_io{**} Number of entries added.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for MetricsRegistry class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   MetricsRegistry( MetricsRegistry const &rhs );
+   /*! @brief Assignment operator for MetricsRegistry class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   MetricsRegistry &operator=( MetricsRegistry const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_METRICS_REGISTRY_HH: Do NOT put anything after this line!
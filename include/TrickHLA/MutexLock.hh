@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Single threaded mode without locking.}
 @revs_end
 
 */
@@ -66,8 +67,26 @@ class MutexLock
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const unlock();
 
+   /*! @brief Skip the locking when everything that uses the mutex runs on
+    *  one thread, which must only be changed while the mutex is not locked.
+    *  @param single_thread True to not lock the mutex. */
+   void set_single_threaded( bool const single_thread )
+   {
+      this->single_threaded = single_thread;
+   }
+
+   /*! @brief Is the locking skipped.
+    *  @return True if the mutex is not locked. */
+   bool is_single_threaded() const
+   {
+      return single_threaded;
+   }
+
    pthread_mutex_t mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
+  protected:
+   bool single_threaded; ///< @trick_io{**} True to skip the locking.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for MutexLock class.
@@ -21,12 +21,15 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{../source/TrickHLA/Attribute.cpp}
 @trick_link_dependency{../source/TrickHLA/ElapsedTimeStats.cpp}
+@trick_link_dependency{../source/TrickHLA/LatencyHistogram.cpp}
 @trick_link_dependency{../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../source/TrickHLA/Int64Interval.cpp}
 @trick_link_dependency{../source/TrickHLA/Int64Time.cpp}
 @trick_link_dependency{../source/TrickHLA/LagCompensation.cpp}
 @trick_link_dependency{../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../source/TrickHLA/MetricsRegistry.cpp}
 @trick_link_dependency{../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../source/TrickHLA/ObjectSnapshot.cpp}
 @trick_link_dependency{../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../source/TrickHLA/OwnershipHandler.cpp}
 @trick_link_dependency{../source/TrickHLA/Packing.cpp}
@@ -38,6 +41,15 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, May 2006, --, DSES Created Object}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional front/back attribute buffers.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Seqlock snapshots of received data.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Latency histograms.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Data cycles to the next send for batched time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Late data dependence for pipelined frames.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Single threaded data path for evoked callbacks.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Keep the object mutexes locking when ownership can transfer.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Swap the attribute encode buffers once per frame.}
 @revs_end
 
 */
@@ -59,7 +71,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/ElapsedTimeStats.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/LatencyHistogram.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/ObjectSnapshot.hh"
 #include "TrickHLA/ReflectedAttributesQueue.hh"
 #include "TrickHLA/StandardsSupport.hh"
 #include "TrickHLA/StringUtilities.hh"
@@ -133,9 +148,27 @@ class Object
 
    bool blocking_cyclic_read; ///< @trick_units{--} True to block in receive_cyclic_data() for data to be received.
 
+   bool late_data_dependence; /**< @trick_units{--}
+      True if the models only use the received data of this object at the
+      end of their step, so the frame can run while the Time Advance Grant
+      is pending when the Federate pipelined_time_advance is set. The data
+      is then received, through the receive side lag compensation, in
+      Federate::wait_for_pipelined_time_advance_grant() (default: false). */
+
    int        attr_count; ///< @trick_units{--} Number of object attributes.
    Attribute *attributes; ///< @trick_units{--} Array of object attributes.
 
+   unsigned int buffer_slots; /**< @trick_units{count}
+      Number of encode buffers for each attribute. Use 2 for front/back
+      buffers so the next pack does not overwrite the value being sent, or
+      more to give the consumers of the sent value more time (default: 1). */
+
+   bool snapshot_received_data; /**< @trick_units{--}
+      True to also copy the received attribute values into a store protected
+      by a sequence lock so that threads other than the Trick main thread can
+      get a consistent copy with read_snapshot() without taking the object
+      mutex (default: false). */
+
    LagCompensation    *lag_comp;      ///< @trick_units{--} Lag compensation object.
    LagCompensationEnum lag_comp_type; ///< @trick_units{--} Type of lag compensation.
 
@@ -266,6 +299,40 @@ class Object
     *  @param theAttributes Attributes data. */
    void extract_data( RTI1516_NAMESPACE::AttributeHandleValueMap &theAttributes );
 
+   /*! @brief Copy the most recently received attribute values into the
+    *  snapshot. This can be called from any thread, never blocks the thread
+    *  extracting the received data, and never returns a partial update.
+    *  @details Requires snapshot_received_data to be true. The snapshot
+    *  holds the encoded values, indexed the same as the attributes array.
+    *  @return True if the snapshot was taken, false if snapshots are not
+    *  enabled for this object.
+    *  @param snapshot The snapshot to copy into, reused between calls. */
+   bool read_snapshot( ObjectSnapshot &snapshot ) const;
+
+   /*! @brief Get the version of the received data, which changes every time
+    *  new data is extracted and can be compared with the version of a
+    *  snapshot to check for new data without copying it.
+    *  @return Version of the received data. */
+   unsigned long long const get_snapshot_version() const
+   {
+      return snapshot_store.get_version();
+   }
+
+   /*! @brief Set the runtime metrics entries for this object, which are
+    *  followed by one entry for each attribute.
+    *  @param entry First of the attr_count + 1 entries, or NULL for none. */
+   void set_metrics( MetricsEntry *entry )
+   {
+      this->metrics = entry;
+   }
+
+   /*! @brief Get the number of runtime metrics entries this object needs.
+    *  @return The number of entries. */
+   unsigned int const get_metrics_entry_count() const
+   {
+      return ( 1 + ( ( attr_count > 0 ) ? (unsigned int)attr_count : 0 ) );
+   }
+
    /*! @brief Remove this object instance from the RTI/Federation. */
    void remove();
 
@@ -483,6 +550,12 @@ class Object
     *  @return True for any locally owned and published attribute with a sub-rate that is ready. */
    bool any_locally_owned_published_cyclic_data_ready_attribute();
 
+   /*! @brief Get the number of data cycles until this object sends an
+    *  attribute update, which does not change the sub-rate counters.
+    *  @return Data cycles until the next send, where the next data cycle
+    *  counts as one, or zero if the object sends no cyclic data. */
+   int const get_data_cycles_to_next_send() const;
+
    /*! @brief Determines if any attribute update is locally owned and published
     * at initialization.
     *  @return True for any locally owned and published initialization attribute. */
@@ -659,6 +732,10 @@ class Object
     *  @param attr_config Attribute configuration. */
    void unpack_attribute_buffers( DataUpdateEnum const attr_config );
 
+   /*! @brief Publish the attribute values packed this frame as the front
+    *  buffers, which is done once all the sends of the frame are done. */
+   void swap_attribute_buffers();
+
    /*! @brief Copy the cyclic and requested attribute values to the buffer for each attribute. */
    void pack_cyclic_and_requested_attribute_buffers()
    {
@@ -711,6 +788,19 @@ class Object
     * @param include_requested True to also included requeted attributes */
    void create_attribute_set( DataUpdateEnum const required_config, bool const include_requested );
 
+   /*! @brief Skip the locking of the object mutexes, which is only safe
+    *  when the RTI callbacks are evoked on the thread that runs the data
+    *  exchange jobs for this object. The object and ownership mutexes keep
+    *  locking if the ownership push or divestiture threads could run.
+    *  @param single_thread True to not lock the mutexes. */
+   void set_single_threaded( bool const single_thread );
+
+   /*! @brief Determine if the object can take part in an ownership transfer,
+    *  which is serviced by the ownership push and divestiture threads.
+    *  @return True if the object has an ownership handler or a published
+    *  attribute it does not own that another federate could push to it. */
+   bool const is_ownership_transfer_possible() const;
+
    MutexLock mutex;           ///< @trick_io{**} Mutex to lock thread over critical code sections.
    MutexLock ownership_mutex; ///< @trick_io{**} Mutex to lock thread over attribute ownership code sections.
 
@@ -752,13 +842,26 @@ class Object
 
    AttributeMap thla_attribute_map; ///< @trick_io{**} Map of the Attribute's, key is the AttributeHandle.
 
+   ObjectSnapshotStore snapshot_store; ///< @trick_io{**} Seqlock protected copy of the received data.
+
+   MetricsEntry *metrics; ///< @trick_io{**} Runtime metrics for the object followed by its attributes, NULL if disabled.
+
   public:
    unsigned long long send_count;    ///< @trick_units{--} Number of times data from this object was sent.
    unsigned long long receive_count; ///< @trick_units{--} Number of times data for this object was received.
 
    ElapsedTimeStats elapsed_time_stats; ///< @trick_units{--} Statistics of elapsed times between cyclic data reads.
 
+   LatencyHistogram blocking_read_stats; ///< @trick_io{**} Latency waiting for a blocking cyclic read.
+   LatencyHistogram pack_stats;          ///< @trick_io{**} Latency of packing the cyclic data.
+   LatencyHistogram send_stats;          ///< @trick_io{**} Latency of sending the cyclic data.
+   LatencyHistogram unpack_stats;        ///< @trick_io{**} Latency of unpacking the received cyclic data.
+
   private:
+   /*! @brief Count the attribute values just sent, or about to be queued for
+    *  the publisher thread, in the runtime metrics. */
+   void record_sent_metrics();
+
    /*! @brief Sets the new value of the name attribute.
     *  @param new_name New name for the object instance. */
    void set_name( char const *new_name );
@@ -0,0 +1,191 @@
+/*!
+@file TrickHLA/ObjectSnapshot.hh
+@ingroup TrickHLA
+@brief This class provides consistent snapshots of the attribute data received
+for an object to readers on any thread.
+
+The received attribute values are copied into a store protected by a
+sequence lock (seqlock) when they are extracted. A reader copies the store
+into its own ObjectSnapshot and retries if an update happened while it was
+copying, so the reader never blocks the writer and never sees a torn update.
+The snapshot holds the encoded attribute values in the same format as the
+RTI delivered them.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ObjectSnapshot.cpp}
+@trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_OBJECT_SNAPSHOT_HH
+#define TRICKHLA_OBJECT_SNAPSHOT_HH
+
+// System include files.
+#include <cstddef>
+#include <vector>
+
+namespace TrickHLA
+{
+
+class ObjectSnapshot
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ObjectSnapshot();
+
+   friend class ObjectSnapshotStore;
+
+  public:
+   /*! @brief Default constructor for the TrickHLA ObjectSnapshot class. */
+   ObjectSnapshot();
+   /*! @brief Destructor for the TrickHLA ObjectSnapshot class. */
+   virtual ~ObjectSnapshot();
+
+   /*! @brief Get the number of attributes in the snapshot.
+    *  @return Number of attributes. */
+   unsigned int const get_attribute_count() const
+   {
+      return (unsigned int)data.size();
+   }
+
+   /*! @brief Get the encoded data for an attribute.
+    *  @return The encoded data, or NULL if nothing has been received.
+    *  @param index     Index of the attribute in the object attributes array.
+    *  @param num_bytes Returns the number of bytes of encoded data. */
+   unsigned char const *get_attribute_data( unsigned int const index,
+                                            size_t            &num_bytes ) const;
+
+   /*! @brief Get the version of the received data in this snapshot, which is
+    *  the number of updates received before the snapshot was taken.
+    *  @return Version of the received data. */
+   unsigned long long const get_version() const
+   {
+      return version;
+   }
+
+  protected:
+   std::vector< std::vector< unsigned char > > data; ///< @trick_io{**} Encoded data for each attribute.
+   std::vector< bool >                         valid; ///< @trick_io{**} True if data was received for the attribute.
+
+   unsigned long long version; ///< @trick_io{**} Version of the received data.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ObjectSnapshot class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ObjectSnapshot( ObjectSnapshot const &rhs );
+   /*! @brief Assignment operator for ObjectSnapshot class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ObjectSnapshot &operator=( ObjectSnapshot const &rhs );
+};
+
+class ObjectSnapshotStore
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ObjectSnapshotStore();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA ObjectSnapshotStore class. */
+   ObjectSnapshotStore();
+   /*! @brief Destructor for the TrickHLA ObjectSnapshotStore class. */
+   virtual ~ObjectSnapshotStore();
+
+   /*! @brief Allocate the store for the specified number of attributes,
+    *  which must be done before there are any readers.
+    *  @param attribute_count Number of attributes in the object. */
+   void initialize( unsigned int const attribute_count );
+
+   /*! @brief Is the store initialized.
+    *  @return True if the store is initialized. */
+   bool is_initialized() const
+   {
+      return ( buffers != NULL );
+   }
+
+   /*! @brief Start an update, which makes readers retry until end_write()
+    *  is called. Only one thread may write at a time. */
+   void begin_write();
+
+   /*! @brief Copy the received encoded data for an attribute into the store.
+    *  @param index     Index of the attribute in the object attributes array.
+    *  @param src       Encoded data.
+    *  @param num_bytes Number of bytes of encoded data. */
+   void write( unsigned int const index,
+               void const        *src,
+               size_t const       num_bytes );
+
+   /*! @brief Finish an update and make it visible to the readers. */
+   void end_write();
+
+   /*! @brief Copy the store into the snapshot, retrying until the copy is
+    *  not torn by a concurrent update. This can be called from any thread.
+    *  @param snapshot The snapshot to copy into. */
+   void read( ObjectSnapshot &snapshot ) const;
+
+   /*! @brief Get the version of the received data, which can be used to
+    *  check for new data without taking a snapshot.
+    *  @return Version of the received data. */
+   unsigned long long const get_version() const;
+
+   /*! @brief Get the number of times a reader had to retry because of a
+    *  concurrent update.
+    *  @return Number of reader retries. */
+   unsigned long long const get_read_retry_count() const;
+
+  protected:
+   unsigned int    attr_count; ///< @trick_io{**} Number of attributes.
+   unsigned char **buffers;    ///< @trick_io{**} Received data for each attribute.
+   unsigned long  *capacities; ///< @trick_io{**} Capacity of each buffer in bytes.
+   unsigned long  *sizes;      ///< @trick_io{**} Number of bytes received for each attribute.
+
+   std::vector< unsigned char * > retired; ///< @trick_io{**} Buffers replaced while a reader may still be copying them.
+
+   unsigned long long sequence;                 ///< @trick_io{**} Seqlock sequence, odd while an update is in progress.
+   mutable unsigned long long read_retry_count; ///< @trick_io{**} Number of reader retries.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ObjectSnapshotStore class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ObjectSnapshotStore( ObjectSnapshotStore const &rhs );
+   /*! @brief Assignment operator for ObjectSnapshotStore class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ObjectSnapshotStore &operator=( ObjectSnapshotStore const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_OBJECT_SNAPSHOT_HH: Do NOT put anything after this line!
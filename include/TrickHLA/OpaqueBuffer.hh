@@ -29,6 +29,8 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, July 2009, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
 @revs_end
 
 */
@@ -87,6 +89,16 @@ class OpaqueBuffer
     *  @param size Requested buffer capacity. */
    void ensure_buffer_capacity( size_t size );
 
+   /*! @brief Shrink the buffer capacity to the data pushed into it, but no
+    *  smaller than the byte alignment. */
+   void shrink_to_fit();
+
+   /*! @brief Grow the buffer to the given size, if larger than the capacity,
+    *  and prefault it so the real-time frames do not allocate or page fault.
+    *  @param max_size Largest number of bytes that will be pushed, or zero to
+    *  keep the current capacity. */
+   void prepare_for_real_time( size_t const max_size );
+
    /*! @brief Reset the push buffer position. */
    void reset_push_position()
    {
@@ -163,6 +175,9 @@ class OpaqueBuffer
    size_t pull_pos; ///< @trick_units{--} Position to pull data from.
    size_t capacity; ///< @trick_units{--} Capacity of the buffer.
 
+   BufferGrowthEnum growth;         ///< @trick_units{--} How the buffer grows (default: BUFFER_GROWTH_EXACT).
+   size_t           capacity_limit; ///< @trick_units{count} High-water mark for geometric growth, 0 for no limit (default: 0).
+
    unsigned char *buffer; ///< @trick_units{--} Byte buffer.
 };
 
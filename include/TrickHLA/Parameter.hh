@@ -21,6 +21,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../source/TrickHLA/Parameter.cpp}
+@trick_link_dependency{../source/TrickHLA/StringStorage.cpp}
 @trick_link_dependency{../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../source/TrickHLA/Utilities.cpp}
 
@@ -29,6 +30,9 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Aug 2006, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse string memory when decoding.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
 @revs_end
 
 */
@@ -44,6 +48,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/StandardsSupport.hh"
+#include "TrickHLA/StringStorage.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 
@@ -80,6 +85,10 @@ class Parameter
 
    EncodingEnum rti_encoding; ///< @trick_units{--} RTI encoding of the data.
 
+   BufferGrowthEnum buffer_growth;         ///< @trick_units{--} How the encode buffer grows (default: BUFFER_GROWTH_GEOMETRIC).
+   size_t           buffer_capacity_limit; ///< @trick_units{count} High-water mark for geometric buffer growth, 0 for no limit (default: 0).
+   size_t           max_buffer_size;       ///< @trick_units{count} Largest encoded size in bytes of variable size data, which the buffer is grown to before the real-time frames, 0 for the current size (default: 0).
+
   public:
    //
    // Public constructors and destructor.
@@ -120,6 +129,30 @@ class Parameter
       return FOM_name;
    }
 
+   /*! @brief Get the capacity of the encode buffer.
+    *  @return The capacity of the buffer in bytes. */
+   size_t get_buffer_capacity() const
+   {
+      return buffer_capacity;
+   }
+
+   /*! @brief Get the number of bytes last encoded into or received in the
+    *  buffer.
+    *  @return The number of bytes used in the buffer. */
+   size_t get_buffer_size() const
+   {
+      return size;
+   }
+
+   /*! @brief Shrink the encode buffer capacity to the number of encoded
+    *  bytes it currently holds. */
+   void shrink_to_fit();
+
+   /*! @brief Grow the encode buffer to the max_buffer_size or the encoded
+    *  size of the current value, whichever is larger, and prefault it so
+    *  the real-time frames do not allocate or page fault. */
+   void prepare_buffer_for_real_time();
+
    /*! @brief Set the FOM name for the paramter.
     *  @param in_name The FOM name for the paramter. */
    void set_FOM_name( char const *in_name )
@@ -241,6 +274,8 @@ class Parameter
 
    bool size_is_static; ///< @trick_units{--} Flag to indicate the size of this attribute is static.
 
+   StringStorage string_storage; ///< @trick_io{**} Reusable memory for the decoded strings.
+
    size_t size;      ///< @trick_units{--} The size of the attribute in bytes.
    size_t num_items; ///< @trick_units{--} Number of attribute items, length of the array.
 
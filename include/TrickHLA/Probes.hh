@@ -0,0 +1,119 @@
+/*!
+@file TrickHLA/Probes.hh
+@ingroup TrickHLA
+@brief USDT (User Statically-Defined Tracing) probes in the TrickHLA data
+exchange, time management, ownership and synchronization point paths.
+
+The probes are SystemTap compatible and can be attached to a running
+federate with bpftrace, perf or stap, for example:
+
+   bpftrace -e 'usdt:./S_main_Linux_*.exe:trickhla:time_advance_grant { printf("%d\n", arg0); }'
+
+Every probe is guarded by a semaphore that the tracer increments when it
+attaches, so the arguments are only computed while a tracer is attached.
+With nothing attached a probe costs a load of the semaphore and an untaken
+branch. The probes are only built in when THLA_USDT_PROBES is defined in
+CompileConfig.hh and the system has the <sys/sdt.h> header (the systemtap-sdt
+development package), otherwise they compile to nothing.
+
+Probes, all with the provider name "trickhla", and their arguments. Object
+indexes are into the Manager objects array, handles are from the RTI hash()
+of the handle, and times are HLA logical times in microseconds, which are -1
+for receive order data:
+   reflect_attributes:           object index, object instance handle, attribute count, bytes, time
+   reflect_attribute:            object index, attribute handle, bytes
+   receive_interaction:          interaction class handle, parameter count, bytes, time
+   time_advance_grant:           granted time
+   send_cyclic_data:             object index, object instance handle, attribute count, bytes, time
+   receive_cyclic_data:          object index, object instance handle, updates unpacked, granted time
+   ownership_assumption_request: object index, object instance handle, attribute count
+   divestiture_confirmation:     object index, object instance handle, attribute count
+   ownership_acquired:           object index, object instance handle, attribute count
+   ownership_release_request:    object index, object instance handle, attribute count
+   sync_point_registered:        label, 1 if succeeded or 0 if failed
+   sync_point_announced:         label
+   federation_synchronized:      label, number of federates that failed to synchronize
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/Probes.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_PROBES_HH
+#define TRICKHLA_PROBES_HH
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+#if defined( THLA_USDT_PROBES ) && defined( __has_include )
+#   if __has_include( <sys/sdt.h> )
+#      define THLA_USDT_PROBES_AVAILABLE
+#   endif
+#endif
+
+#if defined( THLA_USDT_PROBES_AVAILABLE )
+
+// The probes reference the semaphores defined in Probes.cpp.
+#   define _SDT_HAS_SEMAPHORES 1
+#   include <sys/sdt.h>
+
+extern "C" {
+extern unsigned short trickhla_reflect_attributes_semaphore;
+extern unsigned short trickhla_reflect_attribute_semaphore;
+extern unsigned short trickhla_receive_interaction_semaphore;
+extern unsigned short trickhla_time_advance_grant_semaphore;
+extern unsigned short trickhla_send_cyclic_data_semaphore;
+extern unsigned short trickhla_receive_cyclic_data_semaphore;
+extern unsigned short trickhla_ownership_assumption_request_semaphore;
+extern unsigned short trickhla_divestiture_confirmation_semaphore;
+extern unsigned short trickhla_ownership_acquired_semaphore;
+extern unsigned short trickhla_ownership_release_request_semaphore;
+extern unsigned short trickhla_sync_point_registered_semaphore;
+extern unsigned short trickhla_sync_point_announced_semaphore;
+extern unsigned short trickhla_federation_synchronized_semaphore;
+}
+
+// True while a tracer is attached to the probe, so use this to guard the
+// work done to compute the probe arguments.
+#   define THLA_PROBE_ENABLED( name ) __builtin_expect( trickhla_##name##_semaphore != 0, 0 )
+
+#   define THLA_PROBE1( name, a1 ) STAP_PROBE1( trickhla, name, a1 )
+#   define THLA_PROBE2( name, a1, a2 ) STAP_PROBE2( trickhla, name, a1, a2 )
+#   define THLA_PROBE3( name, a1, a2, a3 ) STAP_PROBE3( trickhla, name, a1, a2, a3 )
+#   define THLA_PROBE4( name, a1, a2, a3, a4 ) STAP_PROBE4( trickhla, name, a1, a2, a3, a4 )
+#   define THLA_PROBE5( name, a1, a2, a3, a4, a5 ) STAP_PROBE5( trickhla, name, a1, a2, a3, a4, a5 )
+
+#else
+
+#   define THLA_PROBE_ENABLED( name ) false
+
+// The arguments are not evaluated, sizeof just keeps them from being unused.
+#   define THLA_PROBE1( name, a1 ) (void)sizeof( a1 )
+#   define THLA_PROBE2( name, a1, a2 ) (void)( sizeof( a1 ) + sizeof( a2 ) )
+#   define THLA_PROBE3( name, a1, a2, a3 ) (void)( sizeof( a1 ) + sizeof( a2 ) + sizeof( a3 ) )
+#   define THLA_PROBE4( name, a1, a2, a3, a4 ) (void)( sizeof( a1 ) + sizeof( a2 ) + sizeof( a3 ) + sizeof( a4 ) )
+#   define THLA_PROBE5( name, a1, a2, a3, a4, a5 ) (void)( sizeof( a1 ) + sizeof( a2 ) + sizeof( a3 ) + sizeof( a4 ) + sizeof( a5 ) )
+
+#endif // THLA_USDT_PROBES_AVAILABLE
+
+#endif // TRICKHLA_PROBES_HH: Do NOT put anything after this line!
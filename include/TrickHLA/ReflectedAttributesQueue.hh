@@ -27,6 +27,7 @@ NASA, Johnson Space Center\n
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, Feb 2019, --, Initial implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Return the queue depth from push().}
 @revs_end
 
 */
@@ -88,8 +89,9 @@ class ReflectedAttributesQueue
    bool empty();
 
    /*! @brief Push the attributes onto the queue.
+    *  @return Number of items in the queue after the push.
     *  @param theAttributes The reflected attributes. */
-   void push( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+   size_t const push( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
 
    /*! @brief Pop the front value off the queue and the destructor for the
     * value will be called. */
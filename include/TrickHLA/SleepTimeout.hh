@@ -19,11 +19,15 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../source/TrickHLA/EvokedCallbacks.cpp}
 @trick_link_dependency{../source/TrickHLA/SleepTimeout.cpp}
+@trick_link_dependency{../source/TrickHLA/TSCTimeline.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Deliver the evoked RTI callbacks while waiting.}
 @revs_end
 
 */
@@ -82,12 +86,13 @@ class SleepTimeout
     *  @param sleep_micros Time to sleep in microseconds with a minimum value of 0. */
    void set( double const timeout_seconds, long const sleep_micros );
 
-   /*! @brief Sleep for the configured sleep time.
+   /*! @brief Sleep for the configured sleep time, or on the thread that
+    *  evokes the RTI callbacks wait up to that long for a callback instead.
     *  @return Integer value of 0 for success, otherwise non-zero for an error. */
    int const sleep() const;
 
-   /*! @brief Gets the wall clock time.
-    *  @return The wall clock time in microseconds. */
+   /*! @brief Gets the monotonic clock time.
+    *  @return The monotonic clock time in microseconds. */
    int64_t const time() const;
 
    /*! @brief Determine if we cumulatively slept for the configured timeout time.
@@ -0,0 +1,166 @@
+/*!
+@file TrickHLA/StringStorage.hh
+@ingroup TrickHLA
+@brief This class manages the Trick memory used for the strings decoded into
+the simulation variables of an attribute or parameter.
+
+Received strings are decoded directly into the users Trick allocated
+strings. The size of the existing Trick allocation is looked up for every
+string, because a user can free a string and allocate a shorter one that gets
+the same address. The existing allocation is reused when it is large enough,
+and grown geometrically when it is not, so a string that keeps getting longer
+settles after a few resizes.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/StringStorage.cpp}
+@trick_link_dependency{../../source/TrickHLA/Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Always look up the allocation size.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_STRING_STORAGE_HH
+#define TRICKHLA_STRING_STORAGE_HH
+
+// System include files.
+#include <cstddef>
+#include <string>
+
+namespace TrickHLA
+{
+
+class StringStorage
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__StringStorage();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA StringStorage class. */
+   StringStorage();
+   /*! @brief Destructor for the TrickHLA StringStorage class. */
+   virtual ~StringStorage();
+
+   /*! @brief Get memory for the string at the specified index that can hold
+    *  at least the specified number of bytes. The existing Trick allocation is
+    *  reused if it is large enough, otherwise it is grown geometrically or
+    *  allocated.
+    *  @return Pointer to the string memory, or NULL if it could not be allocated.
+    *  @param strings   Address of the users array of string pointers.
+    *  @param index     Index of the string in the array.
+    *  @param num_bytes Number of bytes needed, including the terminating null
+    *  character. */
+   char *get_string( char **strings, size_t const index, size_t const num_bytes );
+
+   /*! @brief Get memory for the data at the specified index that is exactly
+    *  the specified number of bytes, which is needed for HLAopaqueData where
+    *  the size of the Trick allocation is the size of the data.
+    *  @return Pointer to the data memory, or NULL if it could not be allocated.
+    *  @param strings   Address of the users array of data pointers.
+    *  @param index     Index of the data in the array.
+    *  @param num_bytes Exact number of bytes needed. */
+   char *get_exact( char **strings, size_t const index, size_t const num_bytes );
+
+   /*! @brief Copy the source bytes to the destination only if they differ.
+    *  @return True if the bytes were copied, false if they were the same.
+    *  @param dest      Destination.
+    *  @param src       Source.
+    *  @param num_bytes Number of bytes to compare and copy. */
+   static bool copy_if_changed( void *dest, void const *src, size_t const num_bytes );
+
+   /*! @brief Get the number of new Trick memory allocations made for strings. */
+   static unsigned long long const get_allocate_count()
+   {
+      return __atomic_load_n( &allocate_count, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of Trick memory resizes made for strings. */
+   static unsigned long long const get_resize_count()
+   {
+      return __atomic_load_n( &resize_count, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of Trick memory size lookups made for strings. */
+   static unsigned long long const get_lookup_count()
+   {
+      return __atomic_load_n( &lookup_count, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of times existing string memory was reused. */
+   static unsigned long long const get_reuse_count()
+   {
+      return __atomic_load_n( &reuse_count, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of string copies skipped because the contents
+    *  were unchanged. */
+   static unsigned long long const get_copy_skipped_count()
+   {
+      return __atomic_load_n( &copy_skipped_count, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Reset all the string storage counters to zero. */
+   static void reset_counters();
+
+   /*! @brief Get a summary of the string storage counters.
+    *  @return Counter summary. */
+   static std::string get_counters_summary();
+
+   /*! @brief Check that a string freed and allocated again with a shorter
+    *  length is not mistaken for the old allocation, even when the Trick
+    *  memory manager hands back the same address.
+    *  @return Test report, which starts with PASSED or FAILED. */
+   static std::string const self_test();
+
+  protected:
+   // The counters are updated with atomic operations because the objects of
+   // the Trick child threads are decoded on those threads.
+   static unsigned long long allocate_count;     ///< @trick_io{**} Number of TMM string allocations.
+   static unsigned long long resize_count;       ///< @trick_io{**} Number of TMM string resizes.
+   static unsigned long long lookup_count;       ///< @trick_io{**} Number of TMM string size lookups.
+   static unsigned long long reuse_count;        ///< @trick_io{**} Number of times the existing memory was reused.
+   static unsigned long long copy_skipped_count; ///< @trick_io{**} Number of copies skipped for unchanged data.
+
+  private:
+   /*! @brief Get the capacity of a string from the Trick memory manager.
+    *  @return Capacity of the string in bytes, or 0 if not Trick allocated.
+    *  @param s The string. */
+   static size_t get_capacity( char *s );
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for StringStorage class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StringStorage( StringStorage const &rhs );
+   /*! @brief Assignment operator for StringStorage class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StringStorage &operator=( StringStorage const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_STRING_STORAGE_HH: Do NOT put anything after this line!
@@ -0,0 +1,173 @@
+/*!
+@file TrickHLA/TSCTimeline.hh
+@ingroup TrickHLA
+@brief This class is a low overhead monotonic timeline read from the
+calibrated invariant Time Stamp Counter (TSC) of the CPU.
+
+\par<b>Assumptions and Limitations:</b>
+- The TSC is only used on x86_64 when the CPU reports an invariant TSC, which
+runs at a constant rate in all power states, and on Linux only when the kernel
+also uses the TSC as its clock source, which means the kernel found the TSC to
+be synchronized across the CPUs. Otherwise, or when built without
+THLA_TSC_CLOCK, the time is read with clock_gettime(CLOCK_MONOTONIC).
+- The TSC rate is calibrated against CLOCK_MONOTONIC on the first use. Every
+drift check interval a read also compares the TSC time to CLOCK_MONOTONIC and
+restarts the conversion from the clock, refining the rate. The time only steps
+back when the TSC time is ahead of the clock by more than the drift tolerance.
+- The real time (CLOCK_REALTIME) is the TSC time plus the offset between the
+two system clocks measured at the last drift check, so a clock adjustment by
+NTP is followed within one drift check interval.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TSCTimeline.cpp}
+@trick_link_dependency{../../source/TrickHLA/Timeline.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TSC_TIMELINE_HH
+#define TRICKHLA_TSC_TIMELINE_HH
+
+// System include files.
+#include <cstdint>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/Timeline.hh"
+
+namespace TrickHLA
+{
+
+class TSCTimeline : public Timeline
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TSCTimeline();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Initialization constructor for the TrickHLA TSCTimeline class.
+    *  @param t0 Epoch for the timeline. */
+   explicit TSCTimeline( double t0 = 0.0 );
+
+   /*! @brief Destructor for the TrickHLA TSCTimeline class. */
+   virtual ~TSCTimeline();
+
+   /*! @brief Get the current monotonic time in seconds.
+    *  @return Returns the current timeline time in seconds. */
+   virtual double get_time();
+
+   /*! @brief Calibrate the clock, which is otherwise done on the first read. */
+   static void initialize();
+
+   /*! @brief Is the time read from the TSC.
+    *  @return True if the TSC is used, false if clock_gettime is used. */
+   static bool const is_tsc_clock();
+
+   /*! @brief Get the monotonic time.
+    *  @return Monotonic time in nanoseconds. */
+   static int64_t const get_time_in_nanos();
+
+   /*! @brief Get the monotonic time.
+    *  @return Monotonic time in microseconds. */
+   static int64_t const get_time_in_micros()
+   {
+      return ( get_time_in_nanos() / 1000 );
+   }
+
+   /*! @brief Get the real (time of day) time.
+    *  @return Real time since the Unix epoch in nanoseconds. */
+   static int64_t const get_realtime_in_nanos();
+
+   /*! @brief Get the real (time of day) time.
+    *  @return Real time since the Unix epoch in seconds. */
+   static double const get_realtime_in_seconds();
+
+   /*! @brief Compare the TSC time to the system clock now instead of waiting
+    *  for the next drift check interval.
+    *  @return Difference of the TSC time from CLOCK_MONOTONIC in nanoseconds,
+    *  which is positive when the TSC time is ahead. */
+   static int64_t const check_drift();
+
+   /*! @brief Get a summary of the clock source and the drift checks.
+    *  @return Multi-line clock report. */
+   static std::string const to_string();
+
+   /*! @brief Measure the cost of reading this clock and the system clocks.
+    *  @param reads Number of reads to time for each clock.
+    *  @return Multi-line report of the mean read time of each clock. */
+   static std::string const benchmark( unsigned int const reads );
+
+  protected:
+   /*! @brief Determine the clock source and calibrate the TSC rate, which is
+    *  called only once through pthread_once(). */
+   static void calibrate();
+
+   /*! @brief Is the TSC invariant and trusted by the operating system.
+    *  @return True if the TSC can be used. */
+   static bool const is_tsc_usable();
+
+   /*! @brief Compare the TSC time to CLOCK_MONOTONIC and restart the
+    *  conversion from the clock, unless another thread is already doing it.
+    *  @return True if updated, false if another thread is updating.
+    *  @param drift Difference of the TSC time from CLOCK_MONOTONIC in nanoseconds. */
+   static bool const update_calibration( int64_t &drift );
+
+   static int tsc_clock; ///< @trick_io{**} 1 if the TSC is used, 0 if clock_gettime is used, -1 until calibrated.
+
+   static uint32_t seq_count;            ///< @trick_io{**} Odd while the calibration below is being changed.
+   static uint64_t base_tsc;             ///< @trick_io{**} TSC count at the last calibration.
+   static int64_t  base_ns;              ///< @trick_io{**} Monotonic time of base_tsc in nanoseconds.
+   static int64_t  base_lead_ns;         ///< @trick_io{**} Lead of base_ns over CLOCK_MONOTONIC kept to not go back in time.
+   static uint64_t ns_per_tick;          ///< @trick_io{**} Nanoseconds per TSC tick as a 32.32 fixed point number.
+   static int64_t  realtime_offset_ns;   ///< @trick_io{**} CLOCK_REALTIME minus CLOCK_MONOTONIC in nanoseconds.
+   static uint64_t check_interval_ticks; ///< @trick_io{**} TSC ticks between the drift checks.
+
+   static int                updating;               ///< @trick_io{**} 1 while a thread updates the calibration.
+   static int64_t            drift_tolerance;        ///< @trick_io{**} Lead over the system clock in nanoseconds that steps the time back.
+   static unsigned long long drift_checks;           ///< @trick_io{**} Number of drift checks.
+   static unsigned long long drift_steps;            ///< @trick_io{**} Number of drift checks that stepped the time back.
+   static int64_t            max_drift;              ///< @trick_io{**} Largest drift found in nanoseconds.
+   static int64_t            last_drift;             ///< @trick_io{**} Drift found by the last check in nanoseconds.
+   static uint64_t           calibrated_ns_per_tick; ///< @trick_io{**} ns_per_tick of the first calibration.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TSCTimeline class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TSCTimeline( TSCTimeline const &rhs );
+   /*! @brief Assignment operator for TSCTimeline class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TSCTimeline &operator=( TSCTimeline const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TSC_TIMELINE_HH: Do NOT put anything after this line!
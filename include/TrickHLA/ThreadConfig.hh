@@ -0,0 +1,130 @@
+/*!
+@file TrickHLA/ThreadConfig.hh
+@ingroup TrickHLA
+@brief This class holds the CPU affinity, real-time priority and name for a
+thread that TrickHLA creates or first sees in an RTI callback, and applies
+them from that thread.
+
+\par<b>Assumptions and Limitations:</b>
+- The settings are applied by the thread itself when it starts, or for the
+RTI callback thread on the first callback, so a change after that only
+applies to the threads started later.
+- A SCHED_FIFO priority needs the CAP_SYS_NICE capability or a large enough
+rtprio limit, otherwise a warning is printed and the thread keeps its policy.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ThreadConfig.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_THREAD_CONFIG_HH
+#define TRICKHLA_THREAD_CONFIG_HH
+
+// System include files.
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class ThreadConfig
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ThreadConfig();
+
+  public:
+   //
+   // Public data.
+   //
+   char *cpus; /**< @trick_units{--}
+      CPU cores the thread may run on, as a comma separated list of cores and
+      ranges such as "2,4-5", or NULL to keep the inherited affinity
+      (default: NULL). */
+
+   int priority; /**< @trick_units{--}
+      SCHED_FIFO real-time priority from 1 to 99, or 0 to keep the inherited
+      scheduling policy (default: 0). */
+
+   char *name; /**< @trick_units{--}
+      Thread name of up to 15 characters shown by top and ps, or NULL for the
+      TrickHLA name of the thread (default: NULL). */
+
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA ThreadConfig class. */
+   ThreadConfig();
+   /*! @brief Destructor for the TrickHLA ThreadConfig class. */
+   virtual ~ThreadConfig();
+
+   /*! @brief Is the CPU affinity or priority configured.
+    *  @return True if the cpus or priority are set. */
+   bool is_configured() const
+   {
+      return ( ( ( cpus != NULL ) && ( *cpus != '\0' ) ) || ( priority > 0 ) );
+   }
+
+   /*! @brief Apply the configuration to the calling thread and remember its
+    *  effective affinity and scheduling for the report.
+    *  @param default_name Thread name to use when the name is not set. */
+   void apply( char const *default_name );
+
+   /*! @brief Get the effective affinity and scheduling of the last thread
+    *  this configuration was applied to.
+    *  @return Description, or an empty string if not applied yet. */
+   std::string const get_effective();
+
+   /*! @brief Describe the effective affinity and scheduling of the calling
+    *  thread.
+    *  @return Thread id, name, scheduling policy, priority and CPU cores. */
+   static std::string const describe_current_thread();
+
+  protected:
+   MutexLock    mutex;        ///< @trick_io{**} Protects the effective description.
+   std::string  effective;    ///< @trick_io{**} Effective settings of the last thread applied to.
+   unsigned int thread_count; ///< @trick_io{**} Number of threads applied to.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ThreadConfig class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ThreadConfig( ThreadConfig const &rhs );
+   /*! @brief Assignment operator for ThreadConfig class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ThreadConfig &operator=( ThreadConfig const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_THREAD_CONFIG_HH: Do NOT put anything after this line!
@@ -0,0 +1,218 @@
+/*!
+@file TrickHLA/TimeStallProfiler.hh
+@ingroup TrickHLA
+@brief This class finds which federate holds back the Time Advance Grants of
+this federate.
+
+Every Time Advance Request to Grant wait is recorded in a histogram. A wait
+longer than the stall threshold is a stall, for which the Federate queries the
+Greatest Available Logical Time (GALT) and asks the RTI for the time state of
+every joined federate through the MOM HLAfederate object attributes
+HLAlogicalTime, HLAlookahead, HLAtimeRegulating and HLAtimeConstrained. The
+time regulating federate with the smallest logical time plus lookahead is
+the one that limits the GALT, so it is charged with the stall. The report
+lists the stall count and stall time of each federate found to be limiting.
+
+The MOM values arrive in RTI callbacks while the Federate waits for the
+grant, so the limiting federate of a stall is found from the latest values
+the RTI reported when the grant arrives.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TimeStallProfiler.cpp}
+@trick_link_dependency{../../source/TrickHLA/LatencyHistogram.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TIME_STALL_PROFILER_HH
+#define TRICKHLA_TIME_STALL_PROFILER_HH
+
+// System include files.
+#include <cstdint>
+#include <map>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/LatencyHistogram.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/StandardsSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+namespace TrickHLA
+{
+
+// Time state of a joined federate from its MOM HLAfederate object.
+typedef struct {
+   std::wstring       name;             ///< @trick_io{**} Federate name.
+   int64_t            logical_time;     ///< @trick_io{**} HLA logical time in microseconds, -1 if not known.
+   int64_t            lookahead;        ///< @trick_io{**} HLA lookahead in microseconds, -1 if not known.
+   bool               time_regulating;  ///< @trick_io{**} True if the federate is time regulating.
+   bool               time_constrained; ///< @trick_io{**} True if the federate is time constrained.
+   unsigned long long stall_count;      ///< @trick_io{**} Number of stalls this federate was limiting.
+   int64_t            stall_total_ns;   ///< @trick_io{**} Sum of the stalls this federate was limiting in nanoseconds.
+   int64_t            stall_max_ns;     ///< @trick_io{**} Longest stall this federate was limiting in nanoseconds.
+} FederateTimeState;
+
+typedef std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, FederateTimeState > FederateTimeStateMap;
+
+class TimeStallProfiler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TimeStallProfiler();
+
+  public:
+   /*! @brief Default constructor for the TrickHLA TimeStallProfiler class. */
+   TimeStallProfiler();
+   /*! @brief Destructor for the TrickHLA TimeStallProfiler class. */
+   virtual ~TimeStallProfiler();
+
+   /*! @brief Initialize the profiler.
+    *  @param own_name           Name of this federate, which is left out of the search.
+    *  @param stall_threshold_ns Wait in nanoseconds at or above which a wait is a stall.
+    *  @param name_handle        MOM HLAfederate HLAfederateName attribute handle.
+    *  @param time_handle        MOM HLAfederate HLAlogicalTime attribute handle.
+    *  @param lookahead_handle   MOM HLAfederate HLAlookahead attribute handle.
+    *  @param regulating_handle  MOM HLAfederate HLAtimeRegulating attribute handle.
+    *  @param constrained_handle MOM HLAfederate HLAtimeConstrained attribute handle. */
+   void initialize( std::wstring const                 &own_name,
+                    int64_t const                      stall_threshold_ns,
+                    RTI1516_NAMESPACE::AttributeHandle name_handle,
+                    RTI1516_NAMESPACE::AttributeHandle time_handle,
+                    RTI1516_NAMESPACE::AttributeHandle lookahead_handle,
+                    RTI1516_NAMESPACE::AttributeHandle regulating_handle,
+                    RTI1516_NAMESPACE::AttributeHandle constrained_handle );
+
+   /*! @brief Is the profiler initialized.
+    *  @return True if initialized. */
+   bool is_initialized() const
+   {
+      return this->initialized;
+   }
+
+   /*! @brief Get the wait at or above which a wait is a stall.
+    *  @return Stall threshold in nanoseconds. */
+   int64_t get_stall_threshold_ns() const
+   {
+      return this->stall_threshold_ns;
+   }
+
+   /*! @brief Is this a reflection of the MOM attributes we asked for.
+    *  @return True if the values hold the HLAlogicalTime attribute.
+    *  @param values The reflected attribute values. */
+   bool is_time_state_reflection( RTI1516_NAMESPACE::AttributeHandleValueMap const &values ) const;
+
+   /*! @brief Update the time state of a federate from its reflected MOM
+    *  HLAfederate attributes, which is called from the RTI callback.
+    *  @param id     MOM HLAfederate object instance handle.
+    *  @param values The reflected attribute values. */
+   void reflect_time_state( RTI1516_NAMESPACE::ObjectInstanceHandle const    &id,
+                            RTI1516_NAMESPACE::AttributeHandleValueMap const &values );
+
+   /*! @brief Forget a federate whose MOM HLAfederate object was removed.
+    *  @param id MOM HLAfederate object instance handle. */
+   void remove_federate( RTI1516_NAMESPACE::ObjectInstanceHandle const &id );
+
+   /*! @brief Record a Time Advance Request to Grant wait, and for a stall
+    *  find the limiting federate.
+    *  @param wait_ns           TAR to TAG wait in nanoseconds.
+    *  @param requested_micros  Requested HLA time in microseconds.
+    *  @param GALT_micros       GALT queried during the stall in microseconds,
+    *  or -1 if it was not queried or not defined. */
+   void record_wait( int64_t const wait_ns,
+                     int64_t const requested_micros,
+                     int64_t const GALT_micros );
+
+   /*! @brief Get the stall report.
+    *  @return Multi-line report of the waits, stalls and limiting federates. */
+   std::string const to_string();
+
+  protected:
+   bool    initialized;        ///< @trick_io{**} True once initialized.
+   int64_t stall_threshold_ns; ///< @trick_io{**} Wait at or above which a wait is a stall.
+
+   std::wstring own_name; ///< @trick_io{**} Name of this federate.
+
+   RTI1516_NAMESPACE::AttributeHandle name_handle;        ///< @trick_io{**} MOM HLAfederateName attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle time_handle;        ///< @trick_io{**} MOM HLAlogicalTime attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle lookahead_handle;   ///< @trick_io{**} MOM HLAlookahead attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle regulating_handle;  ///< @trick_io{**} MOM HLAtimeRegulating attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle constrained_handle; ///< @trick_io{**} MOM HLAtimeConstrained attribute handle.
+
+   MutexLock            mutex;     ///< @trick_io{**} Protects the federate time states.
+   FederateTimeStateMap federates; ///< @trick_io{**} Time state of each joined federate.
+
+   LatencyHistogram wait_stats;  ///< @trick_io{**} Every TAR to TAG wait.
+   LatencyHistogram stall_stats; ///< @trick_io{**} The waits at or above the stall threshold.
+
+   unsigned long long unattributed_stalls; ///< @trick_io{**} Stalls with no known limiting federate.
+
+   int64_t      last_stall_ns;        ///< @trick_io{**} Last stall in nanoseconds.
+   int64_t      last_stall_requested; ///< @trick_io{**} Requested time of the last stall in microseconds.
+   int64_t      last_stall_GALT;      ///< @trick_io{**} GALT of the last stall in microseconds, -1 if not known.
+   std::wstring last_stall_limiter;   ///< @trick_io{**} Limiting federate of the last stall.
+
+   /*! @brief Decode an HLAinteger64Time or HLAinteger64Interval MOM value,
+    *  which the RTIs send either as the 8 big endian bytes or as HLAopaqueData
+    *  with a 4 byte count in front.
+    *  @return True if the value was decoded.
+    *  @param data  The encoded value.
+    *  @param value The decoded value in microseconds. */
+   static bool decode_time( RTI1516_NAMESPACE::VariableLengthData const &data,
+                            int64_t                                     &value );
+
+   /*! @brief Decode an HLAboolean MOM value.
+    *  @return True if the value was decoded.
+    *  @param data  The encoded value.
+    *  @param value The decoded value. */
+   static bool decode_boolean( RTI1516_NAMESPACE::VariableLengthData const &data,
+                               bool                                        &value );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TimeStallProfiler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TimeStallProfiler( TimeStallProfiler const &rhs );
+   /*! @brief Assignment operator for TimeStallProfiler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TimeStallProfiler &operator=( TimeStallProfiler const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TIME_STALL_PROFILER_HH: Do NOT put anything after this line!
@@ -0,0 +1,193 @@
+/*!
+@file TrickHLA/TraceRecorder.hh
+@ingroup TrickHLA
+@brief This class records the begin and end times of the HLA frame phases and
+RTI callbacks and writes them out as a Chrome trace.
+
+Each thread records into its own fixed size ring buffer, so recording takes
+no locks and never allocates after the first event on a thread. When the
+ring is full the oldest events are overwritten. When recording is disabled
+a trace scope only costs a load and a branch, and defining
+NO_THLA_FRAME_TRACING in CompileConfig.hh removes the trace scopes from the
+build. The trace file is in the Chrome trace event JSON format, which can be
+viewed with chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/TraceRecorder.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRACE_RECORDER_HH
+#define TRICKHLA_TRACE_RECORDER_HH
+
+// System include files.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+
+#if defined( THLA_FRAME_TRACING )
+#   define THLA_TRACE_SCOPE( category, name, obj_id, attr_id ) \
+      TrickHLA::TraceScope thla_trace_scope( category, name, obj_id, attr_id )
+#else
+#   define THLA_TRACE_SCOPE( category, name, obj_id, attr_id )
+#endif
+
+namespace TrickHLA
+{
+
+class TraceRecorder
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TraceRecorder();
+
+  public:
+   /*! @brief Start recording events, which can be done at any time.
+    *  @param events_per_thread Size of the ring buffer for each thread that
+    *  has not recorded an event yet, rounded up to a power of two. */
+   static void enable( size_t const events_per_thread );
+
+   /*! @brief Stop recording events. The recorded events are kept. */
+   static void disable();
+
+   /*! @brief Is recording enabled.
+    *  @return True if recording is enabled. */
+   static bool is_enabled()
+   {
+      return __atomic_load_n( &enabled, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the monotonic clock time.
+    *  @return The time in nanoseconds. */
+   static int64_t now();
+
+   /*! @brief Record a completed event in the ring buffer of the calling
+    *  thread, or do nothing if recording is disabled.
+    *  @param category Event category, which must be a string literal.
+    *  @param name     Event name, which must be a string literal.
+    *  @param begin_ns Begin time in nanoseconds.
+    *  @param end_ns   End time in nanoseconds.
+    *  @param obj_id   Object index, or -1 for none.
+    *  @param attr_id  Attribute index, or -1 for none. */
+   static void record( char const   *category,
+                       char const   *name,
+                       int64_t const begin_ns,
+                       int64_t const end_ns,
+                       int const     obj_id,
+                       int const     attr_id );
+
+   /*! @brief Write the recorded events from all the threads to a file in the
+    *  Chrome trace event JSON format. Recording is disabled while writing.
+    *  @return True on success, false if the file could not be written.
+    *  @param file_name Name of the trace file. */
+   static bool write_chrome_trace( std::string const &file_name );
+
+  protected:
+   static bool   enabled;           ///< @trick_io{**} True if recording is enabled.
+   static size_t events_per_thread; ///< @trick_io{**} Ring buffer size for new threads.
+
+  private:
+   // Do not allow the constructor, copy constructor or assignment operator.
+   /*! @brief Constructor for TraceRecorder class, which only has static
+    *  functions. */
+   TraceRecorder();
+   /*! @brief Copy constructor for TraceRecorder class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TraceRecorder( TraceRecorder const &rhs );
+   /*! @brief Assignment operator for TraceRecorder class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TraceRecorder &operator=( TraceRecorder const &rhs );
+};
+
+/*!
+ * @brief Records an event from construction to destruction if recording is
+ * enabled. Use the THLA_TRACE_SCOPE macro so it can be compiled out.
+ */
+class TraceScope
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TraceScope();
+
+  public:
+   /*! @brief Constructor for the TrickHLA TraceScope class.
+    *  @param category Event category, which must be a string literal.
+    *  @param name     Event name, which must be a string literal.
+    *  @param obj_id   Object index, or -1 for none.
+    *  @param attr_id  Attribute index, or -1 for none. */
+   TraceScope( char const *category,
+               char const *name,
+               int const   obj_id,
+               int const   attr_id )
+      : category( category ),
+        name( name ),
+        obj_id( obj_id ),
+        attr_id( attr_id ),
+        begin_ns( TraceRecorder::is_enabled() ? TraceRecorder::now() : 0 )
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA TraceScope class. */
+   ~TraceScope()
+   {
+      if ( ( begin_ns != 0 ) && TraceRecorder::is_enabled() ) {
+         TraceRecorder::record( category, name, begin_ns, TraceRecorder::now(), obj_id, attr_id );
+      }
+   }
+
+  private:
+   char const   *category; ///< @trick_io{**} Event category.
+   char const   *name;     ///< @trick_io{**} Event name.
+   int const     obj_id;   ///< @trick_io{**} Object index.
+   int const     attr_id;  ///< @trick_io{**} Attribute index.
+   int64_t const begin_ns; ///< @trick_io{**} Begin time, or 0 if not recording.
+
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TraceScope class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TraceScope( TraceScope const &rhs );
+   /*! @brief Assignment operator for TraceScope class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TraceScope &operator=( TraceScope const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRACE_RECORDER_HH: Do NOT put anything after this line!
@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 @python_module{TrickHLA}
 
 @tldh
+@trick_link_dependency{../../source/TrickHLA/EventCount.cpp}
 @trick_link_dependency{../../source/TrickHLA/Federate.cpp}
 @trick_link_dependency{../../source/TrickHLA/Manager.cpp}
 @trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
@@ -28,6 +29,10 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, March 2023, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Atomic thread states with event count wakeups.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Track the thread associated to each object.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added is_any_child_thread_associated().}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added get_main_thread_data_cycle_time_micros().}
 @revs_end
 */
 
@@ -39,11 +44,32 @@ NASA, Johnson Space Center\n
 #include <string>
 
 // TrickHLA include files.
+#include "TrickHLA/EventCount.hh"
 #include "TrickHLA/MutexLock.hh"
 
+// Size of a CPU cache line in bytes.
+#define THLA_CACHE_LINE_SIZE 64
+
+// Number of times a thread checks the thread states, pausing the CPU between
+// checks, before it blocks.
+#define THLA_THREAD_COORDINATOR_SPIN_COUNT 1000
+
+// Longest time a thread blocks before checking the thread states and for a
+// shutdown again, in microseconds.
+#define THLA_THREAD_COORDINATOR_WAIT_IN_MICROS ( (long)1000 )
+
 namespace TrickHLA
 {
 
+/*!
+ * @brief The state of a Trick thread, padded out to a cache line so the
+ * threads updating their own state do not false share.
+ */
+typedef struct {
+   unsigned int  state;                                                  ///< trick_io{**} Thread state.
+   unsigned char padding[THLA_CACHE_LINE_SIZE - sizeof( unsigned int )]; ///< trick_io{**} Padding to a cache line.
+} TrickThreadState;
+
 // Forward Declared Classes: Since these classes are only used as references
 // through pointers, these classes are included as forward declarations. This
 // helps to limit issues with recursive includes.
@@ -110,6 +136,32 @@ class TrickThreadCoordinator
    int64_t const get_data_cycle_time_micros_for_obj( unsigned int const obj_index,
                                                      int64_t const      default_data_cycle_micros ) const;
 
+   /*! @brief Get the Trick main thread data cycle time.
+    *  @return The data cycle time in microseconds, or zero if the thread
+    *  state is not initialized yet. */
+   int64_t const get_main_thread_data_cycle_time_micros() const
+   {
+      return main_thread_data_cycle_micros;
+   }
+
+   /*! @brief Is any Trick child thread associated to TrickHLA.
+    *  @return True if at least one Trick child thread is associated. */
+   bool const is_any_child_thread_associated() const
+   {
+      return any_child_thread_associated;
+   }
+
+   /*! @brief Get the Trick thread-id the object instance is associated to.
+    *  @return The thread-id, which is 0 for the main thread or if the object
+    *  is not associated to a Trick child thread.
+    *  @param obj_index Object instance index. */
+   unsigned int const get_thread_id_for_obj( unsigned int const obj_index ) const;
+
+   /*! @brief Get a summary of how long the Trick main thread waited on the
+    *  Trick child threads, which is the coordination overhead.
+    *  @return Summary of the coordination statistics. */
+   std::string get_summary() const;
+
   protected:
    /*! @brief Wait to send data for Trick main thread. */
    void wait_to_send_data_for_main_thread();
@@ -117,21 +169,58 @@ class TrickThreadCoordinator
    /*! @brief Wait to send data for Trick child thread. */
    void wait_to_send_data_for_child_thread( unsigned int const thread_id );
 
+   /*! @brief Determine if all the associated Trick child threads on a data
+    *  cycle boundary are ready to send.
+    *  @return True if all the child threads are ready to send.
+    *  @param sim_time_micros Simulation time in microseconds.
+    *  @param id              Child thread-id to start checking from, which is
+    *  returned as the first thread-id that is not ready. */
+   bool const are_child_threads_ready_to_send( int64_t const sim_time_micros,
+                                               unsigned int &id ) const;
+
+   /*! @brief Get the state of a thread.
+    *  @return The thread state.
+    *  @param thread_id Trick thread-id. */
+   unsigned int const get_thread_state( unsigned int const thread_id ) const
+   {
+      return __atomic_load_n( &thread_state[thread_id].state, __ATOMIC_SEQ_CST );
+   }
+
+   /*! @brief Set the state of a thread.
+    *  @param thread_id Trick thread-id.
+    *  @param state     The thread state. */
+   void set_thread_state( unsigned int const thread_id,
+                          unsigned int const state )
+   {
+      __atomic_store_n( &thread_state[thread_id].state, state, __ATOMIC_SEQ_CST );
+   }
+
   protected:
    Federate *federate; ///< @trick_units{--} Associated TrickHLA::Federate.
    Manager  *manager;  ///< @trick_units{--} Associated TrickHLA::Manager.
 
    MutexLock mutex; ///< @trick_units{--} TrickHLA thread state mutex.
 
-   unsigned int *thread_state;     ///< @trick_units{--} TrickHLA state of trick child threads being used.
-   unsigned int  thread_state_cnt; ///< @trick_units{--} TrickHLA state of trick child threads being used count.
+   TrickThreadState *thread_state;     ///< @trick_io{**} TrickHLA state of trick child threads being used.
+   unsigned int      thread_state_cnt; ///< @trick_units{--} TrickHLA state of trick child threads being used count.
+
+   int send_pending_cnt; ///< @trick_io{**} Number of child threads the main thread is waiting on to send.
+
+   EventCount main_thread_event;  ///< @trick_io{**} Wakes the main thread when the last child thread is ready to send.
+   EventCount child_thread_event; ///< @trick_io{**} Wakes the child threads when the main thread state changes.
 
    long long *data_cycle_micros_per_thread; ///< @trick_units{--} Data cycle times per thread in microseconds.
    long long *data_cycle_micros_per_obj;    ///< @trick_units{--} Data cycle times per object instance in microseconds.
 
+   unsigned int *thread_id_per_obj; ///< @trick_units{--} Trick thread-id each object instance is associated to.
+
    bool any_child_thread_associated; ///< @trick_units{--} True if at least one Trick Child thread is associated to TrickHLA.
 
    long long main_thread_data_cycle_micros; ///< @trick_units{--} Trick main thread data cycle time in microseconds.
+
+   unsigned long long main_wait_count;        ///< @trick_units{--} Number of times the main thread waited on the child threads.
+   long long          main_wait_total_micros; ///< @trick_units{--} Total time the main thread waited on the child threads in microseconds.
+   long long          main_wait_max_micros;   ///< @trick_units{--} Longest time the main thread waited on the child threads in microseconds.
 };
 
 } // namespace TrickHLA
@@ -0,0 +1,101 @@
+/*!
+@file TrickHLA/TrickThreadCoordinatorBenchmark.hh
+@ingroup TrickHLA
+@brief This class measures the wait latency of the Trick main and child
+thread handshake that the TrickThreadCoordinator uses.
+
+The benchmark compares the original mutex and sleep polling to the spin and
+event count waits with its own threads, so it can be run from the input file
+without a federation.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/EventCount.cpp}
+@trick_link_dependency{../../source/TrickHLA/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/TSCTimeline.cpp}
+@trick_link_dependency{../../source/TrickHLA/TrickThreadCoordinatorBenchmark.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRICK_THREAD_COORDINATOR_BENCHMARK_HH
+#define TRICKHLA_TRICK_THREAD_COORDINATOR_BENCHMARK_HH
+
+// System include files.
+#include <string>
+
+// Largest number of Trick child threads the benchmark will emulate.
+#define THLA_THREAD_COORDINATOR_BENCHMARK_MAX_THREADS 32
+
+namespace TrickHLA
+{
+
+class TrickThreadCoordinatorBenchmark
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TrickThreadCoordinatorBenchmark();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA TrickThreadCoordinatorBenchmark class. */
+   TrickThreadCoordinatorBenchmark()
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA TrickThreadCoordinatorBenchmark class. */
+   virtual ~TrickThreadCoordinatorBenchmark()
+   {
+      return;
+   }
+
+  public:
+   /*! @brief Measure the wait latency of the Trick main and child thread
+    *  handshake, comparing the original mutex and sleep polling to the spin
+    *  and event count waits, for 1 up to the given number of child threads.
+    *  @return Multi-line report of the wake and frame latencies.
+    *  @param num_threads Largest number of child threads, limited to 32.
+    *  @param frames      Number of frames to run for each thread count. */
+   static std::string const run( unsigned int const num_threads,
+                                 unsigned int const frames );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TrickThreadCoordinatorBenchmark class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TrickThreadCoordinatorBenchmark( TrickThreadCoordinatorBenchmark const &rhs );
+   /*! @brief Assignment operator for TrickThreadCoordinatorBenchmark class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TrickThreadCoordinatorBenchmark &operator=( TrickThreadCoordinatorBenchmark const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRICK_THREAD_COORDINATOR_BENCHMARK_HH: Do NOT put anything after this line!
@@ -25,6 +25,9 @@ NASA, Johnson Space Center\n
 @revs_begin
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added BufferGrowthEnum.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added TimeAdvanceModeEnum.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added TIME_ADVANCE_MODE_BATCH.}
 @revs_end
 
 */
@@ -276,6 +279,30 @@ typedef enum {
 
 } TimeAdvanceStateEnum;
 
+/*!
+@enum BufferGrowthEnum
+@brief Define how the TrickHLA encode and decode buffers grow.
+*/
+typedef enum {
+
+   BUFFER_GROWTH_EXACT     = 0, ///< Grow to exactly the requested capacity.
+   BUFFER_GROWTH_GEOMETRIC = 1  ///< Grow to at least double the current capacity.
+
+} BufferGrowthEnum;
+
+/*!
+@enum TimeAdvanceModeEnum
+@brief Define how the federate asks the RTI to advance its HLA time.
+*/
+typedef enum {
+
+   TIME_ADVANCE_MODE_TAR   = 0, ///< Time Advance Request to the next frame.
+   TIME_ADVANCE_MODE_NMR   = 1, ///< Next Message Request to the next event, granted at the next message.
+   TIME_ADVANCE_MODE_NMRA  = 2, ///< Next Message Request Available, where more messages can arrive at the granted time.
+   TIME_ADVANCE_MODE_BATCH = 3  ///< Time Advance Request to the next frame with outgoing data, running the frames before it locally.
+
+} TimeAdvanceModeEnum;
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated"
 
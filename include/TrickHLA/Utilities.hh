@@ -30,6 +30,9 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA/ER7, TrickHLA, Sept 2010, --, Added Mac FPU control word support.}
 @rev_entry{Danny Strauss, L3, TrickHLA, June 2012, --, Add version to THLA simobject}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added UTF-16BE widen/narrow kernels.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added memory prefault.}
 @revs_end
 
 */
@@ -232,6 +235,39 @@ class Utilities
     *  @param  n The number to round up the value to the next positive multiple of. */
    static size_t next_positive_multiple_of_N( size_t const value, unsigned int const n );
 
+   /*! @brief Determine the new capacity of a buffer that must hold at least
+    *  the requested number of bytes.
+    *  @return The new buffer capacity, which is the current capacity if it is
+    *  already large enough.
+    *  @param current   The current buffer capacity in bytes.
+    *  @param requested The requested buffer capacity in bytes.
+    *  @param growth    How the buffer grows.
+    *  @param limit     High-water mark that geometric growth will not exceed
+    *  unless the requested capacity does, or zero for no limit. */
+   static size_t next_buffer_capacity( size_t const           current,
+                                       size_t const           requested,
+                                       BufferGrowthEnum const growth,
+                                       size_t const           limit );
+
+   /*! @brief Widen ASCII characters into HLAunicodeString UTF-16 Big Endian
+    *  characters. The loop is written so the compiler can vectorize it.
+    *  @param output Destination of 2 * length bytes, must not overlap input.
+    *  @param input  Source ASCII characters.
+    *  @param length Number of characters to widen. */
+   static void widen_ascii_to_utf16be( unsigned char       *output,
+                                       unsigned char const *input,
+                                       size_t const         length );
+
+   /*! @brief Narrow HLAunicodeString UTF-16 Big Endian characters into ASCII
+    *  characters by keeping the low byte of each character. The loop is
+    *  written so the compiler can vectorize it.
+    *  @param output Destination of length bytes, must not overlap input.
+    *  @param input  Source of 2 * length bytes of UTF-16BE characters.
+    *  @param length Number of characters to narrow. */
+   static void narrow_utf16be_to_ascii( unsigned char       *output,
+                                        unsigned char const *input,
+                                        size_t const         length );
+
    /*! @brief Sleep for the specified number of microseconds. The usleep() C
     *  function is obsolete (see CWE-676). Create a wrapper around nanosleep()
     *  to provide the same functionality as usleep().
@@ -239,6 +275,12 @@ class Utilities
     *  @param  usec Time to sleep in microseconds. */
    static int micro_sleep( long const usec );
 
+   /*! @brief Touch every page of the memory so that the page faults happen
+    *  now instead of on the first use. The contents are not changed.
+    *  @param address Start of the memory.
+    *  @param size    Size of the memory in bytes. */
+   static void prefault_memory( void *address, size_t const size );
+
    /*! @brief Return the current TrickHLA version string from the auto
     *  generated Version.hh header file.
     *  @return Byteswap value. */
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# @file trickhla_metrics.py
+# @brief This program displays the TrickHLA runtime metrics of a running federate.
+#
+# This is a Python program used to read the shared memory segment written by
+# a federate with the TrickHLA Federate runtime_metrics flag set, and print
+# the update, byte, queue and Time Advance Grant wait counters for each
+# object, attribute and interaction. The layout is defined in
+# include/TrickHLA/MetricsRegistry.hh.
+#
+# @revs_title
+# @revs_begin
+# @rev_entry{ TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial creation.}
+# @rev_entry{ TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Adaptive lookahead values.}
+# @revs_end
+#
+import sys
+import os
+import argparse
+import mmap
+import struct
+import time
+
+from trickhla_message import *
+
+# Must match MetricsHeader and MetricsEntry in MetricsRegistry.hh.
+METRICS_MAGIC = b'THLAMTR\0'
+METRICS_VERSION = 2
+HEADER_FORMAT = '=8sIIIIiI96sqQQQQqqQ'
+ENTRY_FORMAT = '=96sIi7Q'
+KIND_NAMES = { 0: 'Object', 1: 'Attribute', 2: 'Interaction' }
+
+
+def read_metrics( shm_path ):
+
+   with open( shm_path, 'rb' ) as shm_file:
+      data = mmap.mmap( shm_file.fileno(), 0, access = mmap.ACCESS_READ )
+   try:
+      header = struct.unpack_from( HEADER_FORMAT, data, 0 )
+      if header[0] != METRICS_MAGIC:
+         return None
+      if header[1] != METRICS_VERSION:
+         TrickHLAMessage.failure( 'Unsupported metrics version ' + str( header[1] ) + ' in ' + shm_path )
+
+      header_size = header[2]
+      entry_size = header[3]
+      entry_count = header[4]
+
+      entries = []
+      for i in range( entry_count ):
+         entries.append( struct.unpack_from( ENTRY_FORMAT, data, header_size + ( i * entry_size ) ) )
+   finally:
+      data.close()
+
+   return header, entries
+
+
+def print_metrics( header, entries ):
+
+   fed_name = header[7].split( b'\0', 1 )[0].decode( errors = 'replace' )
+   tag_count = header[9]
+   tag_mean_us = ( header[10] / tag_count / 1000.0 ) if tag_count > 0 else 0.0
+
+   print( 'Federate:' + fed_name + ' PID:' + str( header[5] ) \
+          +' Granted-Time:' + str( header[8] / 1.0e6 ) + ' seconds' )
+   print( 'TAR to TAG wait  count:' + str( tag_count ) \
+          +' last:' + '%.3f' % ( header[12] / 1000.0 ) \
+          +' mean:' + '%.3f' % tag_mean_us \
+          +' max:' + '%.3f' % ( header[11] / 1000.0 ) + ' microseconds' )
+   if header[13] > 0:
+      send_distance = ( '%.6f' % ( header[14] / 1.0e6 ) ) if header[14] >= 0 else 'none'
+      print( 'Adaptive lookahead:' + '%.6f' % ( header[13] / 1.0e6 ) + ' seconds' \
+             +' smallest-send-distance:' + send_distance \
+             +' changes:' + str( header[15] ) )
+   print( '%-40s %10s %10s %12s %12s %8s %9s %6s' % \
+          ( 'Name', 'Sent', 'Received', 'Bytes-Sent', 'Bytes-Recv', 'Queued', 'Coalesced', 'Depth' ) )
+
+   for entry in entries:
+      name = entry[0].split( b'\0', 1 )[0].decode( errors = 'replace' )
+      if entry[1] == 1:
+         name = '   ' + name
+      else:
+         name = KIND_NAMES.get( entry[1], '?' ) + ' ' + name
+      print( '%-40s %10d %10d %12d %12d %8d %9d %6d' % \
+             ( name[:40], entry[3], entry[4], entry[5], entry[6], entry[7], entry[8], entry[9] ) )
+
+
+# Main routine.
+def main():
+
+   parser = argparse.ArgumentParser( prog = 'trickhla_metrics', \
+                                     description = 'Display the runtime metrics of a running TrickHLA federate.' )
+   parser.add_argument( 'name', \
+                        help = 'Shared memory name of the metrics, such as /TrickHLA_MyFederate.' )
+   parser.add_argument( '-i', '--interval', type = float, default = 0.0, \
+                        help = 'Seconds between displays, where zero displays once.', \
+                        dest = 'interval' )
+
+   args = parser.parse_args()
+
+   shm_path = args.name
+   if not shm_path.startswith( '/dev/shm/' ):
+      shm_path = '/dev/shm/' + shm_path.lstrip( '/' )
+
+   while True:
+      if not os.path.exists( shm_path ):
+         TrickHLAMessage.failure( 'No runtime metrics found at ' + shm_path )
+
+      metrics = read_metrics( shm_path )
+      if metrics is None:
+         TrickHLAMessage.warning( 'The runtime metrics at ' + shm_path + ' are not ready yet.' )
+      else:
+         print_metrics( metrics[0], metrics[1] )
+
+      if args.interval <= 0.0:
+         break
+      sys.stdout.flush()
+      time.sleep( args.interval )
+      print( '' )
+
+
+if __name__ == '__main__':
+   main()
@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Sept 2006, --, Initial implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, SISO, Sept 2010, --, Smackdown implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Full attribute set with change tracking.}
 @revs_end
 
 */
@@ -36,15 +37,22 @@ NASA, Johnson Space Center\n
 #include <string>
 
 // Trick include files.
+#include "trick/MemoryManager.hh"
 #include "trick/exec_proto.hh"
 #include "trick/matrix_macros.h"
 #include "trick/message_proto.h"
 #include "trick/vector_macros.h"
 
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
+
 // SpaceFOM include files.
 #include "SpaceFOM/DynamicalEntity.hh"
 
 using namespace std;
+using namespace TrickHLA;
 using namespace SpaceFOM;
 
 /*!
@@ -52,12 +60,16 @@ using namespace SpaceFOM;
  */
 DynamicalEntity::DynamicalEntity() // RETURN: -- None.
    : mass( 0.0 ),
-     mass_rate( 0.0 )
+     mass_rate( 0.0 ),
+     prev_mass( 0.0 ),
+     prev_mass_rate( 0.0 )
 {
    V_INIT( force );
    V_INIT( torque );
    M_IDENT( inertia );
    M_IDENT( inertia_rate );
+   M_INIT( prev_inertia );
+   M_INIT( prev_inertia_rate );
 }
 
 /*!
@@ -68,11 +80,95 @@ DynamicalEntity::~DynamicalEntity() // RETURN: -- None.
    return;
 }
 
+/*!
+ * @details These can be overridden in the input file. This sets up the
+ * PhysicalEntity attributes and then adds the DynamicalEntity attributes.
+ * @job_class{default_data}
+ */
+void DynamicalEntity::default_data(
+   TrickHLA::Object *mngr_object,
+   char const       *sim_obj_name,
+   char const       *entity_obj_name,
+   char const       *entity_name,
+   char const       *parent_ref_frame_name,
+   bool              publishes )
+{
+   string entity_name_str = string( sim_obj_name ) + "." + string( entity_obj_name );
+
+   // Set the FOM name of the DynamicalEntity object before the base class
+   // sets up the PhysicalEntity attributes.
+   mngr_object->FOM_name = allocate_input_string( "PhysicalEntity.DynamicalEntity" );
+
+   PhysicalEntityBase::default_data( mngr_object,
+                                     sim_obj_name,
+                                     entity_obj_name,
+                                     entity_name,
+                                     parent_ref_frame_name,
+                                     publishes );
+
+   //
+   // Specify the DynamicalEntity attributes.
+   //
+   setup_attribute( object->attributes[9], "force",
+                    entity_name_str + ".force", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[10], "torque",
+                    entity_name_str + ".torque", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[11], "mass",
+                    entity_name_str + ".mass", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[12], "mass_rate",
+                    entity_name_str + ".mass_rate", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[13], "inertia",
+                    entity_name_str + ".inertia", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[14], "inertia_rate",
+                    entity_name_str + ".inertia_rate", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void DynamicalEntity::initialize_callback(
+   TrickHLA::Object *obj )
+{
+   PhysicalEntityBase::initialize_callback( obj );
+
+   track_attribute( PHYSICAL_ENTITY_TRACKED_MASS, "mass" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_MASS_RATE, "mass_rate" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_INERTIA, "inertia" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_INERTIA_RATE, "inertia_rate" );
+}
+
+/*!
+ * @details The force and torque are sent every cycle. The mass properties
+ * are only flagged as changed when modified, see PhysicalEntityBase::pack().
+ * @job_class{scheduled}
+ */
 void DynamicalEntity::pack()
 {
    PhysicalEntityBase::pack();
+
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_MASS,
+                             data_changed( &mass, &prev_mass, 1 ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_MASS_RATE,
+                             data_changed( &mass_rate, &prev_mass_rate, 1 ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_INERTIA,
+                             data_changed( &inertia[0][0], &prev_inertia[0][0], 9 ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_INERTIA_RATE,
+                             data_changed( &inertia_rate[0][0], &prev_inertia_rate[0][0], 9 ) );
 }
 
+/*!
+ * @details The DynamicalEntity attributes are mapped directly to the class
+ * data so there is nothing extra to decode.
+ * @job_class{scheduled}
+ */
 void DynamicalEntity::unpack()
 {
    PhysicalEntityBase::unpack();
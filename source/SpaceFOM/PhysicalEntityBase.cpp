@@ -16,6 +16,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../TrickHLA/CompileConfig.cpp}
+@trick_link_dependency{../TrickHLA/Conditional.cpp}
 @trick_link_dependency{../TrickHLA/Packing.cpp}
 @trick_link_dependency{PhysicalEntityBase.cpp}
 
@@ -25,12 +26,14 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Sept 2006, --, Initial implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, SISO, Sept 2010, --, Smackdown implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Full attribute set with change tracking.}
 @revs_end
 
 */
 
 // System include files.
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <math.h>
@@ -45,19 +48,27 @@ NASA, Johnson Space Center\n
 #include "trick/vector_macros.h"
 
 // TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
 
 // SpaceFOM include files.
 #include "SpaceFOM/PhysicalEntityBase.hh"
 
 using namespace std;
+using namespace TrickHLA;
 using namespace SpaceFOM;
 
 /*!
  * @job_class{initialization}
  */
 PhysicalEntityBase::PhysicalEntityBase() // RETURN: -- None.
-   : name( NULL ),
+   : send_on_change_only( true ),
+     state_attr( NULL ),
+     body_wrt_struct_attr( NULL ),
+     name( NULL ),
      type( NULL ),
      status( NULL ),
      parent_ref_frame( NULL ),
@@ -67,6 +78,16 @@ PhysicalEntityBase::PhysicalEntityBase() // RETURN: -- None.
    V_INIT( accel );
    V_INIT( rot_accel );
    V_INIT( cm );
+   V_INIT( prev_cm );
+
+   prev_body_wrt_struct.scalar = 0.0;
+   V_INIT( prev_body_wrt_struct.vector );
+
+   // Everything is considered changed until it has been sent once.
+   for ( int i = 0; i < PHYSICAL_ENTITY_TRACKED_COUNT; ++i ) {
+      tracked_attr[i]    = NULL;
+      tracked_changed[i] = true;
+   }
 }
 
 /*!
@@ -92,6 +113,106 @@ PhysicalEntityBase::~PhysicalEntityBase() // RETURN: -- None.
    }
 }
 
+/*!
+ * @details These can be overridden in the input file. The vector and matrix
+ * attributes are HLAfixedArray's of HLAfloat64LE in the FOM, which is the
+ * same memory layout as the double arrays in this class, so they are mapped
+ * directly to the class data with a little endian encoding instead of going
+ * through an intermediate encoder and buffer copy.
+ * @job_class{default_data}
+ */
+void PhysicalEntityBase::default_data(
+   TrickHLA::Object *mngr_object,
+   char const       *sim_obj_name,
+   char const       *entity_obj_name,
+   char const       *entity_name,
+   char const       *parent_ref_frame_name,
+   bool              publishes )
+{
+   string entity_name_str = string( sim_obj_name ) + "." + string( entity_obj_name );
+
+   // Associate the instantiated Manager object with this packing object.
+   this->object = mngr_object;
+
+   // Set the entity name and parent frame name.
+   if ( entity_name != NULL ) {
+      set_name( entity_name );
+   } else {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityBase::default_data():" << __LINE__
+             << " ERROR: Unexpected NULL federation instance entity name!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   set_parent_ref_frame( ( parent_ref_frame_name != NULL ) ? parent_ref_frame_name : "" );
+
+   //---------------------------------------------------------
+   // Set up the physical entity HLA object mappings.
+   //---------------------------------------------------------
+   // Set the FOM name of the PhysicalEntity object, unless a subclass has
+   // already set it to a more specific object class.
+   if ( object->FOM_name == NULL ) {
+      object->FOM_name = allocate_input_string( "PhysicalEntity" );
+   }
+   object->name                = allocate_input_string( entity_name );
+   object->create_HLA_instance = publishes;
+   object->packing             = this;
+   // Allocate the attributes for the HLA object.
+   object->attr_count = get_default_attribute_count();
+   object->attributes = (TrickHLA::Attribute *)trick_MM->declare_var( "TrickHLA::Attribute", object->attr_count );
+
+   //
+   // Specify the PhysicalEntity attributes.
+   //
+   setup_attribute( object->attributes[0], "name",
+                    entity_name_str + ".name", publishes,
+                    TrickHLA::ENCODING_UNICODE_STRING );
+   setup_attribute( object->attributes[1], "type",
+                    entity_name_str + ".type", publishes,
+                    TrickHLA::ENCODING_UNICODE_STRING );
+   setup_attribute( object->attributes[2], "status",
+                    entity_name_str + ".status", publishes,
+                    TrickHLA::ENCODING_UNICODE_STRING );
+   setup_attribute( object->attributes[3], "parent_reference_frame",
+                    entity_name_str + ".parent_ref_frame", publishes,
+                    TrickHLA::ENCODING_UNICODE_STRING );
+   setup_attribute( object->attributes[4], "state",
+                    entity_name_str + ".stc_encoder.buffer", publishes,
+                    TrickHLA::ENCODING_OPAQUE_DATA );
+   setup_attribute( object->attributes[5], "acceleration",
+                    entity_name_str + ".accel", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[6], "rotational_acceleration",
+                    entity_name_str + ".rot_accel", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[7], "center_of_mass",
+                    entity_name_str + ".cm", publishes,
+                    TrickHLA::ENCODING_LITTLE_ENDIAN );
+   setup_attribute( object->attributes[8], "body_wrt_structural",
+                    entity_name_str + ".quat_encoder.buffer", publishes,
+                    TrickHLA::ENCODING_OPAQUE_DATA );
+
+   return;
+}
+
+/*!
+ * @job_class{default_data}
+ */
+void PhysicalEntityBase::setup_attribute(
+   TrickHLA::Attribute   &attr,
+   char const            *FOM_name,
+   string const          &trick_name,
+   bool const             publishes,
+   TrickHLA::EncodingEnum encoding )
+{
+   attr.FOM_name      = allocate_input_string( FOM_name );
+   attr.trick_name    = allocate_input_string( trick_name );
+   attr.config        = ( TrickHLA::DataUpdateEnum )( (int)TrickHLA::CONFIG_INITIALIZE + (int)TrickHLA::CONFIG_CYCLIC );
+   attr.publish       = publishes;
+   attr.subscribe     = !publishes;
+   attr.locally_owned = publishes;
+   attr.rti_encoding  = encoding;
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -139,6 +260,109 @@ void PhysicalEntityBase::initialize()
    return;
 }
 
+/*!
+ * @details From the TrickHLA::Packing class. We override this function so
+ * that we can look up the TrickHLA::Attribute's once instead of every time
+ * the pack and unpack functions are called. The rarely changing attributes
+ * use this entity as their TrickHLA::Conditional, unless the user already
+ * configured a conditional for them, so that they are only sent when changed.
+ * @job_class{initialization}
+ */
+void PhysicalEntityBase::initialize_callback(
+   TrickHLA::Object *obj )
+{
+   // We must call the original function so that the callback is initialized.
+   this->TrickHLA::Packing::initialize_callback( obj );
+
+   state_attr           = get_attribute( "state" );
+   body_wrt_struct_attr = get_attribute( "body_wrt_structural" );
+
+   track_attribute( PHYSICAL_ENTITY_TRACKED_NAME, "name" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_TYPE, "type" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_STATUS, "status" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_PARENT_REF_FRAME, "parent_reference_frame" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_CENTER_OF_MASS, "center_of_mass" );
+   track_attribute( PHYSICAL_ENTITY_TRACKED_BODY_WRT_STRUCT, "body_wrt_structural" );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityBase::track_attribute(
+   PhysicalEntityTrackedEnum const index,
+   char const                     *FOM_name )
+{
+   // The attribute is optional, so it may not have been configured.
+   TrickHLA::Attribute *attr = get_attribute( FOM_name );
+   if ( ( attr != NULL ) && ( attr->conditional == NULL ) ) {
+      attr->conditional   = this;
+      tracked_attr[index] = attr;
+   } else {
+      tracked_attr[index] = NULL;
+   }
+   tracked_changed[index] = true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool PhysicalEntityBase::should_send(
+   TrickHLA::Attribute *attr )
+{
+   for ( int i = 0; i < PHYSICAL_ENTITY_TRACKED_COUNT; ++i ) {
+      if ( attr == tracked_attr[i] ) {
+         // The attribute is being sent now so clear the changed flag.
+         bool const changed = tracked_changed[i];
+         tracked_changed[i] = false;
+         return ( changed || !send_on_change_only );
+      }
+   }
+   return true;
+}
+
+void PhysicalEntityBase::mark_all_changed()
+{
+   for ( int i = 0; i < PHYSICAL_ENTITY_TRACKED_COUNT; ++i ) {
+      tracked_changed[i] = true;
+   }
+}
+
+bool PhysicalEntityBase::string_changed(
+   char const *value,
+   string     &previous )
+{
+   char const *str = ( value != NULL ) ? value : "";
+   if ( previous.compare( str ) != 0 ) {
+      previous.assign( str );
+      return true;
+   }
+   return false;
+}
+
+bool PhysicalEntityBase::data_changed(
+   double const      *value,
+   double            *previous,
+   unsigned int const count )
+{
+   if ( memcmp( value, previous, count * sizeof( double ) ) != 0 ) {
+      memcpy( previous, value, count * sizeof( double ) );
+      return true;
+   }
+   return false;
+}
+
+/*!
+ * @job_class{default_data}
+ */
+char *PhysicalEntityBase::allocate_input_string( // RETURN: -- None.
+   string const &cpp_string )                    // IN: -- String to allocate.
+{
+   char *new_c_str = (char *)TMM_declare_var_1d( "char", cpp_string.length() + 1 );
+   strncpy( new_c_str, cpp_string.c_str(), cpp_string.length() + 1 );
+
+   return new_c_str;
+}
+
 void PhysicalEntityBase::set_name( char const *new_name )
 {
    if ( this->name != NULL ) {
@@ -176,14 +400,49 @@ void PhysicalEntityBase::set_parent_ref_frame( char const *new_name )
    return;
 }
 
+/*!
+ * @details The entity state changes every cycle so it is always encoded. The
+ * other attributes are checked against the values last packed and flagged as
+ * changed so that should_send() only lets them through when modified.
+ * @job_class{scheduled}
+ */
 void PhysicalEntityBase::pack()
 {
    stc_encoder.encode();
-   quat_encoder.encode();
+
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_NAME,
+                             string_changed( name, prev_name ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_TYPE,
+                             string_changed( type, prev_type ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_STATUS,
+                             string_changed( status, prev_status ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_PARENT_REF_FRAME,
+                             string_changed( parent_ref_frame, prev_parent_ref_frame ) );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_CENTER_OF_MASS,
+                             data_changed( cm, prev_cm, 3 ) );
+
+   // Use a non-short-circuit OR so both parts of the previous value update.
+   bool const quat_changed = data_changed( &body_wrt_struct.scalar, &prev_body_wrt_struct.scalar, 1 )
+                             | data_changed( body_wrt_struct.vector, prev_body_wrt_struct.vector, 3 );
+   update_tracked_attribute( PHYSICAL_ENTITY_TRACKED_BODY_WRT_STRUCT, quat_changed );
+
+   // Only encode the attitude when it will be sent.
+   if ( tracked_changed[PHYSICAL_ENTITY_TRACKED_BODY_WRT_STRUCT] ) {
+      quat_encoder.encode();
+   }
 }
 
+/*!
+ * @job_class{scheduled}
+ */
 void PhysicalEntityBase::unpack()
 {
-   stc_encoder.decode();
-   quat_encoder.decode();
+   // Only decode the attributes we received data for. If the attributes were
+   // not configured then fall back to always decoding.
+   if ( ( state_attr == NULL ) || state_attr->is_received() ) {
+      stc_encoder.decode();
+   }
+   if ( ( body_wrt_struct_attr == NULL ) || body_wrt_struct_attr->is_received() ) {
+      quat_encoder.decode();
+   }
 }
@@ -0,0 +1,561 @@
+/*!
+@file SpaceFOM/PhysicalEntityBatchTransform.cpp
+@ingroup SpaceFOM
+@brief This class transforms a batch of SpaceFOM physical entity states into
+a common reference frame.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{PhysicalEntityBase.cpp}
+@trick_link_dependency{PhysicalEntityBatchTransform.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Batch entity frame transformation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/PhysicalEntityBatchTransform.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+/*!
+ * @brief Allocate or resize one of the structure-of-arrays members.
+ * @return Pointer to the resized array.
+ * @param array Array to resize, which can be NULL.
+ * @param size  New number of elements.
+ */
+static double *resize_array(
+   double            *array,
+   unsigned int const size )
+{
+   if ( array == NULL ) {
+      array = (double *)TMM_declare_var_1d( "double", (int)size );
+   } else {
+      array = (double *)TMM_resize_array_1d_a( array, (int)size );
+   }
+   if ( array == NULL ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityBatchTransform::ensure_capacity():" << __LINE__
+             << " ERROR: Could not allocate memory for requested capacity "
+             << size << "!" << THLA_ENDL;
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   return array;
+}
+
+/*!
+ * @brief Free one of the structure-of-arrays members.
+ * @param array Array to free.
+ */
+static void free_array(
+   double *&array )
+{
+   if ( array != NULL ) {
+      if ( TMM_is_alloced( (char *)array ) ) {
+         TMM_delete_var_a( array );
+      }
+      array = NULL;
+   }
+}
+
+/*!
+ * @brief Translational state kernel. The transport velocity (w x r) is added
+ * in the parent frame and then both the position and the velocity are rotated
+ * into the target frame and offset by the parent frame state.
+ * @details The loop has no dependencies between iterations and the arrays
+ * are passed as restrict qualified parameters, so the compiler can vectorize
+ * it for the target instruction set without runtime alias checks.
+ * @param n     Number of entity states.
+ * @param T     Transformation matrix from the target frame to the parent frame.
+ * @param frame State of the parent frame with respect to the target frame.
+ */
+static void transform_translational_kernel(
+   unsigned int const             n,
+   double const                   T[3][3],
+   SpaceTimeCoordinateData const &frame,
+   double *__restrict__           pos0,
+   double *__restrict__           pos1,
+   double *__restrict__           pos2,
+   double *__restrict__           vel0,
+   double *__restrict__           vel1,
+   double *__restrict__           vel2 )
+{
+   double const T00 = T[0][0], T01 = T[0][1], T02 = T[0][2];
+   double const T10 = T[1][0], T11 = T[1][1], T12 = T[1][2];
+   double const T20 = T[2][0], T21 = T[2][1], T22 = T[2][2];
+
+   double const rx = frame.pos[0];
+   double const ry = frame.pos[1];
+   double const rz = frame.pos[2];
+   double const vx = frame.vel[0];
+   double const vy = frame.vel[1];
+   double const vz = frame.vel[2];
+   double const wx = frame.ang_vel[0];
+   double const wy = frame.ang_vel[1];
+   double const wz = frame.ang_vel[2];
+
+   for ( unsigned int i = 0; i < n; ++i ) {
+      double const r0 = pos0[i];
+      double const r1 = pos1[i];
+      double const r2 = pos2[i];
+
+      double const u0 = vel0[i] + ( ( wy * r2 ) - ( wz * r1 ) );
+      double const u1 = vel1[i] + ( ( wz * r0 ) - ( wx * r2 ) );
+      double const u2 = vel2[i] + ( ( wx * r1 ) - ( wy * r0 ) );
+
+      pos0[i] = rx + ( T00 * r0 ) + ( T10 * r1 ) + ( T20 * r2 );
+      pos1[i] = ry + ( T01 * r0 ) + ( T11 * r1 ) + ( T21 * r2 );
+      pos2[i] = rz + ( T02 * r0 ) + ( T12 * r1 ) + ( T22 * r2 );
+
+      vel0[i] = vx + ( T00 * u0 ) + ( T10 * u1 ) + ( T20 * u2 );
+      vel1[i] = vy + ( T01 * u0 ) + ( T11 * u1 ) + ( T21 * u2 );
+      vel2[i] = vz + ( T02 * u0 ) + ( T12 * u1 ) + ( T22 * u2 );
+   }
+}
+
+/*!
+ * @brief Rotational state kernel. The parent frame angular velocity is
+ * transformed into each entity body frame and added to the entity angular
+ * velocity, then the entity attitude is composed with the parent attitude.
+ * @param n     Number of entity states.
+ * @param frame State of the parent frame with respect to the target frame.
+ */
+static void transform_rotational_kernel(
+   unsigned int const             n,
+   SpaceTimeCoordinateData const &frame,
+   double *__restrict__           qs,
+   double *__restrict__           qx,
+   double *__restrict__           qy,
+   double *__restrict__           qz,
+   double *__restrict__           wvel0,
+   double *__restrict__           wvel1,
+   double *__restrict__           wvel2 )
+{
+   double const ps = frame.quat_scalar;
+   double const px = frame.quat_vector[0];
+   double const py = frame.quat_vector[1];
+   double const pz = frame.quat_vector[2];
+   double const wx = frame.ang_vel[0];
+   double const wy = frame.ang_vel[1];
+   double const wz = frame.ang_vel[2];
+
+   for ( unsigned int i = 0; i < n; ++i ) {
+      double const es = qs[i];
+      double const ex = qx[i];
+      double const ey = qy[i];
+      double const ez = qz[i];
+
+      // T(q) w = (s^2 - v.v) w + 2 (v.w) v - 2 s (v x w)
+      double const e_ss_vv = ( es * es ) - ( ( ex * ex ) + ( ey * ey ) + ( ez * ez ) );
+      double const two_vw  = 2.0 * ( ( ex * wx ) + ( ey * wy ) + ( ez * wz ) );
+      double const two_s   = 2.0 * es;
+
+      wvel0[i] += ( e_ss_vv * wx ) + ( two_vw * ex ) - ( two_s * ( ( ey * wz ) - ( ez * wy ) ) );
+      wvel1[i] += ( e_ss_vv * wy ) + ( two_vw * ey ) - ( two_s * ( ( ez * wx ) - ( ex * wz ) ) );
+      wvel2[i] += ( e_ss_vv * wz ) + ( two_vw * ez ) - ( two_s * ( ( ex * wy ) - ( ey * wx ) ) );
+
+      // Q_target_entity = Q_target_parent * Q_parent_entity
+      qs[i] = ( ps * es ) - ( ( px * ex ) + ( py * ey ) + ( pz * ez ) );
+      qx[i] = ( ps * ex ) + ( es * px ) + ( ( py * ez ) - ( pz * ey ) );
+      qy[i] = ( ps * ey ) + ( es * py ) + ( ( pz * ex ) - ( px * ez ) );
+      qz[i] = ( ps * ez ) + ( es * pz ) + ( ( px * ey ) - ( py * ex ) );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityBatchTransform::PhysicalEntityBatchTransform() // RETURN: -- None.
+   : capacity( 0 ),
+     count( 0 ),
+     pos_x( NULL ),
+     pos_y( NULL ),
+     pos_z( NULL ),
+     vel_x( NULL ),
+     vel_y( NULL ),
+     vel_z( NULL ),
+     quat_s( NULL ),
+     quat_x( NULL ),
+     quat_y( NULL ),
+     quat_z( NULL ),
+     ang_vel_x( NULL ),
+     ang_vel_y( NULL ),
+     ang_vel_z( NULL ),
+     time( NULL )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityBatchTransform::~PhysicalEntityBatchTransform() // RETURN: -- None.
+{
+   free_arrays();
+}
+
+void PhysicalEntityBatchTransform::free_arrays()
+{
+   free_array( pos_x );
+   free_array( pos_y );
+   free_array( pos_z );
+   free_array( vel_x );
+   free_array( vel_y );
+   free_array( vel_z );
+   free_array( quat_s );
+   free_array( quat_x );
+   free_array( quat_y );
+   free_array( quat_z );
+   free_array( ang_vel_x );
+   free_array( ang_vel_y );
+   free_array( ang_vel_z );
+   free_array( time );
+
+   capacity = 0;
+   count    = 0;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void PhysicalEntityBatchTransform::ensure_capacity(
+   unsigned int const new_capacity )
+{
+   if ( new_capacity <= capacity ) {
+      return;
+   }
+
+   pos_x     = resize_array( pos_x, new_capacity );
+   pos_y     = resize_array( pos_y, new_capacity );
+   pos_z     = resize_array( pos_z, new_capacity );
+   vel_x     = resize_array( vel_x, new_capacity );
+   vel_y     = resize_array( vel_y, new_capacity );
+   vel_z     = resize_array( vel_z, new_capacity );
+   quat_s    = resize_array( quat_s, new_capacity );
+   quat_x    = resize_array( quat_x, new_capacity );
+   quat_y    = resize_array( quat_y, new_capacity );
+   quat_z    = resize_array( quat_z, new_capacity );
+   ang_vel_x = resize_array( ang_vel_x, new_capacity );
+   ang_vel_y = resize_array( ang_vel_y, new_capacity );
+   ang_vel_z = resize_array( ang_vel_z, new_capacity );
+   time      = resize_array( time, new_capacity );
+
+   capacity = new_capacity;
+}
+
+unsigned int const PhysicalEntityBatchTransform::add_state(
+   SpaceTimeCoordinateData const &state )
+{
+   if ( count >= capacity ) {
+      // Grow geometrically so that adding entities one at a time does not
+      // reallocate the arrays every time.
+      ensure_capacity( ( capacity < 8 ) ? 16 : ( 2 * capacity ) );
+   }
+   set_state( count, state );
+   return count++;
+}
+
+void PhysicalEntityBatchTransform::set_state(
+   unsigned int const             index,
+   SpaceTimeCoordinateData const &state )
+{
+   if ( index >= capacity ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityBatchTransform::set_state():" << __LINE__
+             << " ERROR: Index " << index << " is out of range for capacity "
+             << capacity << "!" << THLA_ENDL;
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   pos_x[index]     = state.pos[0];
+   pos_y[index]     = state.pos[1];
+   pos_z[index]     = state.pos[2];
+   vel_x[index]     = state.vel[0];
+   vel_y[index]     = state.vel[1];
+   vel_z[index]     = state.vel[2];
+   quat_s[index]    = state.quat_scalar;
+   quat_x[index]    = state.quat_vector[0];
+   quat_y[index]    = state.quat_vector[1];
+   quat_z[index]    = state.quat_vector[2];
+   ang_vel_x[index] = state.ang_vel[0];
+   ang_vel_y[index] = state.ang_vel[1];
+   ang_vel_z[index] = state.ang_vel[2];
+   time[index]      = state.time;
+}
+
+void PhysicalEntityBatchTransform::get_state(
+   unsigned int const       index,
+   SpaceTimeCoordinateData &state ) const
+{
+   if ( index >= count ) {
+      ostringstream errmsg;
+      errmsg << "SpaceFOM::PhysicalEntityBatchTransform::get_state():" << __LINE__
+             << " ERROR: Index " << index << " is out of range for count "
+             << count << "!" << THLA_ENDL;
+      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   state.pos[0]         = pos_x[index];
+   state.pos[1]         = pos_y[index];
+   state.pos[2]         = pos_z[index];
+   state.vel[0]         = vel_x[index];
+   state.vel[1]         = vel_y[index];
+   state.vel[2]         = vel_z[index];
+   state.quat_scalar    = quat_s[index];
+   state.quat_vector[0] = quat_x[index];
+   state.quat_vector[1] = quat_y[index];
+   state.quat_vector[2] = quat_z[index];
+   state.ang_vel[0]     = ang_vel_x[index];
+   state.ang_vel[1]     = ang_vel_y[index];
+   state.ang_vel[2]     = ang_vel_z[index];
+   state.time           = time[index];
+}
+
+/*!
+ * @details The parent frame attitude is converted to a 3x3 transformation
+ * matrix once for the whole batch and then the translational and rotational
+ * kernels are applied to the structure-of-arrays data.
+ * @job_class{scheduled}
+ */
+void PhysicalEntityBatchTransform::transform(
+   SpaceTimeCoordinateData const &parent_wrt_target )
+{
+   if ( count == 0 ) {
+      return;
+   }
+
+   // Parent frame attitude quaternion (target to parent transformation).
+   double const ps = parent_wrt_target.quat_scalar;
+   double const px = parent_wrt_target.quat_vector[0];
+   double const py = parent_wrt_target.quat_vector[1];
+   double const pz = parent_wrt_target.quat_vector[2];
+
+   // Transformation matrix from the target frame to the parent frame for the
+   // left transformation quaternion convention.
+   double const ss_vv = ( ps * ps ) - ( ( px * px ) + ( py * py ) + ( pz * pz ) );
+   double       T[3][3];
+   T[0][0] = ss_vv + ( 2.0 * px * px );
+   T[0][1] = 2.0 * ( ( px * py ) + ( ps * pz ) );
+   T[0][2] = 2.0 * ( ( px * pz ) - ( ps * py ) );
+   T[1][0] = 2.0 * ( ( px * py ) - ( ps * pz ) );
+   T[1][1] = ss_vv + ( 2.0 * py * py );
+   T[1][2] = 2.0 * ( ( py * pz ) + ( ps * px ) );
+   T[2][0] = 2.0 * ( ( px * pz ) + ( ps * py ) );
+   T[2][1] = 2.0 * ( ( py * pz ) - ( ps * px ) );
+   T[2][2] = ss_vv + ( 2.0 * pz * pz );
+
+   transform_translational_kernel( count, T, parent_wrt_target,
+                                   pos_x, pos_y, pos_z,
+                                   vel_x, vel_y, vel_z );
+
+   transform_rotational_kernel( count, parent_wrt_target,
+                                quat_s, quat_x, quat_y, quat_z,
+                                ang_vel_x, ang_vel_y, ang_vel_z );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityBatchTransform::transform_state(
+   SpaceTimeCoordinateData const &parent_wrt_target,
+   SpaceTimeCoordinateData const &entity_wrt_parent,
+   SpaceTimeCoordinateData       &entity_wrt_target )
+{
+   double const  ps = parent_wrt_target.quat_scalar;
+   double const *pv = parent_wrt_target.quat_vector;
+   double const *w  = parent_wrt_target.ang_vel;
+   double const  es = entity_wrt_parent.quat_scalar;
+   double const *ev = entity_wrt_parent.quat_vector;
+   double const *r  = entity_wrt_parent.pos;
+
+   // Transformation matrix from the target frame to the parent frame.
+   double const ss_vv = ( ps * ps ) - ( ( pv[0] * pv[0] ) + ( pv[1] * pv[1] ) + ( pv[2] * pv[2] ) );
+   double       T[3][3];
+   for ( int i = 0; i < 3; ++i ) {
+      for ( int j = 0; j < 3; ++j ) {
+         T[i][j] = 2.0 * pv[i] * pv[j];
+      }
+      T[i][i] += ss_vv;
+   }
+   T[0][1] += 2.0 * ps * pv[2];
+   T[0][2] -= 2.0 * ps * pv[1];
+   T[1][0] -= 2.0 * ps * pv[2];
+   T[1][2] += 2.0 * ps * pv[0];
+   T[2][0] += 2.0 * ps * pv[1];
+   T[2][1] -= 2.0 * ps * pv[0];
+
+   // Entity velocity plus the transport velocity in the parent frame.
+   double u[3];
+   u[0] = entity_wrt_parent.vel[0] + ( ( w[1] * r[2] ) - ( w[2] * r[1] ) );
+   u[1] = entity_wrt_parent.vel[1] + ( ( w[2] * r[0] ) - ( w[0] * r[2] ) );
+   u[2] = entity_wrt_parent.vel[2] + ( ( w[0] * r[1] ) - ( w[1] * r[0] ) );
+
+   // Rotate into the target frame (transpose transformation) and offset.
+   double pos[3];
+   double vel[3];
+   for ( int j = 0; j < 3; ++j ) {
+      pos[j] = parent_wrt_target.pos[j];
+      vel[j] = parent_wrt_target.vel[j];
+      for ( int i = 0; i < 3; ++i ) {
+         pos[j] += T[i][j] * r[i];
+         vel[j] += T[i][j] * u[i];
+      }
+   }
+
+   // Parent angular velocity transformed into the entity body frame.
+   double const e_ss_vv = ( es * es ) - ( ( ev[0] * ev[0] ) + ( ev[1] * ev[1] ) + ( ev[2] * ev[2] ) );
+   double const two_vw  = 2.0 * ( ( ev[0] * w[0] ) + ( ev[1] * w[1] ) + ( ev[2] * w[2] ) );
+   double       ang_vel[3];
+   ang_vel[0] = entity_wrt_parent.ang_vel[0] + ( e_ss_vv * w[0] ) + ( two_vw * ev[0] )
+                - ( 2.0 * es * ( ( ev[1] * w[2] ) - ( ev[2] * w[1] ) ) );
+   ang_vel[1] = entity_wrt_parent.ang_vel[1] + ( e_ss_vv * w[1] ) + ( two_vw * ev[1] )
+                - ( 2.0 * es * ( ( ev[2] * w[0] ) - ( ev[0] * w[2] ) ) );
+   ang_vel[2] = entity_wrt_parent.ang_vel[2] + ( e_ss_vv * w[2] ) + ( two_vw * ev[2] )
+                - ( 2.0 * es * ( ( ev[0] * w[1] ) - ( ev[1] * w[0] ) ) );
+
+   // Compose the attitude quaternions.
+   double const qs = ( ps * es ) - ( ( pv[0] * ev[0] ) + ( pv[1] * ev[1] ) + ( pv[2] * ev[2] ) );
+   double       qv[3];
+   qv[0] = ( ps * ev[0] ) + ( es * pv[0] ) + ( ( pv[1] * ev[2] ) - ( pv[2] * ev[1] ) );
+   qv[1] = ( ps * ev[1] ) + ( es * pv[1] ) + ( ( pv[2] * ev[0] ) - ( pv[0] * ev[2] ) );
+   qv[2] = ( ps * ev[2] ) + ( es * pv[2] ) + ( ( pv[0] * ev[1] ) - ( pv[1] * ev[0] ) );
+
+   // Write the output last so the input and output can be the same state.
+   for ( int i = 0; i < 3; ++i ) {
+      entity_wrt_target.pos[i]         = pos[i];
+      entity_wrt_target.vel[i]         = vel[i];
+      entity_wrt_target.ang_vel[i]     = ang_vel[i];
+      entity_wrt_target.quat_vector[i] = qv[i];
+   }
+   entity_wrt_target.quat_scalar = qs;
+   entity_wrt_target.time        = entity_wrt_parent.time;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+string PhysicalEntityBatchTransform::benchmark(
+   unsigned int const num_entities,
+   unsigned int const iterations )
+{
+   ostringstream msg;
+
+   if ( ( num_entities == 0 ) || ( iterations == 0 ) ) {
+      msg << "SpaceFOM::PhysicalEntityBatchTransform::benchmark():" << __LINE__
+          << " Nothing to do for " << num_entities << " entities and "
+          << iterations << " iterations." << THLA_ENDL;
+      return msg.str();
+   }
+
+   // Build a repeatable set of entity states with unit attitude quaternions.
+   vector< SpaceTimeCoordinateData > input( num_entities );
+   vector< SpaceTimeCoordinateData > output( num_entities );
+   for ( unsigned int k = 0; k < num_entities; ++k ) {
+      double const a = 0.001 * (double)( k + 1 );
+      for ( int i = 0; i < 3; ++i ) {
+         input[k].pos[i]     = 1000.0 * sin( a * (double)( i + 1 ) );
+         input[k].vel[i]     = 10.0 * cos( a * (double)( i + 2 ) );
+         input[k].ang_vel[i] = 0.01 * sin( a * (double)( i + 3 ) );
+      }
+      double const half_angle = 0.5 * a;
+      input[k].quat_scalar    = cos( half_angle );
+      input[k].quat_vector[0] = sin( half_angle ) * 0.6;
+      input[k].quat_vector[1] = sin( half_angle ) * 0.0;
+      input[k].quat_vector[2] = sin( half_angle ) * 0.8;
+      input[k].time           = 0.0;
+   }
+
+   SpaceTimeCoordinateData parent_wrt_target;
+   for ( int i = 0; i < 3; ++i ) {
+      parent_wrt_target.pos[i]     = 7.0e6 * (double)( i + 1 );
+      parent_wrt_target.vel[i]     = 7.5e3 * (double)( 3 - i );
+      parent_wrt_target.ang_vel[i] = 1.0e-3 * (double)( i + 1 );
+   }
+   parent_wrt_target.quat_scalar    = cos( 0.25 );
+   parent_wrt_target.quat_vector[0] = 0.0;
+   parent_wrt_target.quat_vector[1] = sin( 0.25 );
+   parent_wrt_target.quat_vector[2] = 0.0;
+   parent_wrt_target.time           = 0.0;
+
+   // Per-entity scalar transformations.
+   int64_t start_time = clock_wall_time(); // in microseconds
+   for ( unsigned int n = 0; n < iterations; ++n ) {
+      for ( unsigned int k = 0; k < num_entities; ++k ) {
+         transform_state( parent_wrt_target, input[k], output[k] );
+      }
+   }
+   int64_t const scalar_micros = clock_wall_time() - start_time;
+
+   // Batch transformations, including loading the entity states.
+   clear();
+   ensure_capacity( num_entities );
+   start_time = clock_wall_time();
+   for ( unsigned int n = 0; n < iterations; ++n ) {
+      count = 0;
+      for ( unsigned int k = 0; k < num_entities; ++k ) {
+         set_state( count++, input[k] );
+      }
+      transform( parent_wrt_target );
+   }
+   int64_t const batch_micros = clock_wall_time() - start_time;
+
+   // Largest difference between the two methods.
+   double                  max_diff = 0.0;
+   SpaceTimeCoordinateData batch_state;
+   for ( unsigned int k = 0; k < num_entities; ++k ) {
+      get_state( k, batch_state );
+      for ( int i = 0; i < 3; ++i ) {
+         max_diff = fmax( max_diff, fabs( batch_state.pos[i] - output[k].pos[i] ) );
+         max_diff = fmax( max_diff, fabs( batch_state.vel[i] - output[k].vel[i] ) );
+         max_diff = fmax( max_diff, fabs( batch_state.ang_vel[i] - output[k].ang_vel[i] ) );
+         max_diff = fmax( max_diff, fabs( batch_state.quat_vector[i] - output[k].quat_vector[i] ) );
+      }
+      max_diff = fmax( max_diff, fabs( batch_state.quat_scalar - output[k].quat_scalar ) );
+   }
+
+   double const total = (double)num_entities * (double)iterations;
+   msg << "SpaceFOM::PhysicalEntityBatchTransform::benchmark():" << __LINE__
+       << " Transformed " << num_entities << " entity states "
+       << iterations << " times." << THLA_ENDL
+       << "  Scalar: " << scalar_micros << " microseconds ("
+       << ( 1000.0 * (double)scalar_micros / total ) << " ns/entity)" << THLA_ENDL
+       << "   Batch: " << batch_micros << " microseconds ("
+       << ( 1000.0 * (double)batch_micros / total ) << " ns/entity)" << THLA_ENDL
+       << " Speedup: "
+       << ( ( batch_micros > 0 ) ? ( (double)scalar_micros / (double)batch_micros ) : 0.0 )
+       << THLA_ENDL
+       << "Max diff: " << max_diff << THLA_ENDL;
+
+   return msg.str();
+}
@@ -0,0 +1,269 @@
+/*!
+@file TrickHLA/AllocationGuard.cpp
+@ingroup TrickHLA
+@brief This class counts the heap allocations made inside the TrickHLA
+scheduled jobs, which is used to verify that the steady state real-time frames
+do not allocate.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AllocationGuard.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Count the aligned allocations and reset all the counts when armed.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/AllocationGuard.hh"
+#include "TrickHLA/CompileConfig.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+#define THLA_ALLOCATION_GUARD_MAX_SCOPES 16
+
+namespace
+{
+
+// Allocations counted for one guard scope. The name points to a string
+// literal and is claimed once with a compare and swap.
+typedef struct {
+   char const        *name;
+   unsigned long long count;
+   unsigned long long bytes;
+} AllocationScopeCount;
+
+// Everything here is zero initialized before any constructor runs, so the
+// allocation functions can use it at any time.
+AllocationScopeCount scope_counts[THLA_ALLOCATION_GUARD_MAX_SCOPES];
+unsigned long long   total_count    = 0;
+unsigned long long   total_bytes    = 0;
+unsigned long long   overflow_count = 0;
+char const          *last_scope     = NULL;
+size_t               last_size      = 0;
+
+// Guard scope of the calling thread, or NULL if not inside a scope.
+__thread char const *thread_scope = NULL;
+
+} // namespace
+
+#if defined( THLA_ALLOCATION_GUARD ) && defined( __GLIBC__ )
+
+// System include files.
+#   include <errno.h>
+#   include <sys/cdefs.h>
+
+// The glibc allocator, which the replacement functions below call.
+extern "C" void *__libc_malloc( size_t size );
+extern "C" void *__libc_calloc( size_t count, size_t size );
+extern "C" void *__libc_realloc( void *ptr, size_t size );
+extern "C" void *__libc_memalign( size_t alignment, size_t size );
+extern "C" void *__libc_valloc( size_t size );
+extern "C" void *__libc_pvalloc( size_t size );
+
+extern "C" void *malloc( size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( size );
+   return __libc_malloc( size );
+}
+
+extern "C" void *calloc( size_t count, size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( count * size );
+   return __libc_calloc( count, size );
+}
+
+extern "C" void *realloc( void *ptr, size_t size ) __THROW
+{
+   // A realloc() to zero bytes frees the memory.
+   if ( ( size > 0 ) || ( ptr == NULL ) ) {
+      AllocationGuard::record_allocation( size );
+   }
+   return __libc_realloc( ptr, size );
+}
+
+// The aligned allocators, which the aligned C++ new also ends up in. The
+// glibc allocator only exports memalign() for these.
+extern "C" int posix_memalign( void **memptr, size_t alignment, size_t size ) __THROW
+{
+   // The alignment must be a power of two multiple of sizeof( void * ).
+   if ( ( ( alignment % sizeof( void * ) ) != 0 )
+        || ( ( alignment & ( alignment - 1 ) ) != 0 )
+        || ( alignment == 0 ) ) {
+      return EINVAL;
+   }
+   AllocationGuard::record_allocation( size );
+   void *ptr = __libc_memalign( alignment, size );
+   if ( ptr == NULL ) {
+      return ENOMEM;
+   }
+   *memptr = ptr;
+   return 0;
+}
+
+extern "C" void *aligned_alloc( size_t alignment, size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( size );
+   return __libc_memalign( alignment, size );
+}
+
+extern "C" void *memalign( size_t alignment, size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( size );
+   return __libc_memalign( alignment, size );
+}
+
+extern "C" void *valloc( size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( size );
+   return __libc_valloc( size );
+}
+
+extern "C" void *pvalloc( size_t size ) __THROW
+{
+   AllocationGuard::record_allocation( size );
+   return __libc_pvalloc( size );
+}
+
+#endif // THLA_ALLOCATION_GUARD && __GLIBC__
+
+bool AllocationGuard::armed = false;
+
+/*!
+ * @details The scope names already claimed are kept, since another thread
+ * may be claiming a scope at the same time.
+ */
+void AllocationGuard::arm()
+{
+   __atomic_store_n( &total_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &total_bytes, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &overflow_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &last_scope, (char const *)NULL, __ATOMIC_RELAXED );
+   __atomic_store_n( &last_size, 0, __ATOMIC_RELAXED );
+   for ( int i = 0; i < THLA_ALLOCATION_GUARD_MAX_SCOPES; ++i ) {
+      __atomic_store_n( &scope_counts[i].count, 0, __ATOMIC_RELAXED );
+      __atomic_store_n( &scope_counts[i].bytes, 0, __ATOMIC_RELAXED );
+   }
+   __atomic_store_n( &armed, true, __ATOMIC_RELEASE );
+}
+
+void AllocationGuard::disarm()
+{
+   __atomic_store_n( &armed, false, __ATOMIC_RELEASE );
+}
+
+bool const AllocationGuard::is_built_in()
+{
+#if defined( THLA_ALLOCATION_GUARD ) && defined( __GLIBC__ )
+   return true;
+#else
+   return false;
+#endif
+}
+
+unsigned long long const AllocationGuard::get_allocation_count()
+{
+   return __atomic_load_n( &total_count, __ATOMIC_RELAXED );
+}
+
+char const *AllocationGuard::set_scope(
+   char const *name )
+{
+   char const *prev_name = thread_scope;
+   thread_scope          = name;
+   return prev_name;
+}
+
+/*!
+ * @details This is called from inside malloc(), so it must not allocate.
+ */
+void AllocationGuard::record_allocation(
+   size_t const size )
+{
+   char const *name = thread_scope;
+   if ( ( name == NULL ) || !is_armed() ) {
+      return;
+   }
+
+   __atomic_add_fetch( &total_count, 1, __ATOMIC_RELAXED );
+   __atomic_add_fetch( &total_bytes, size, __ATOMIC_RELAXED );
+   __atomic_store_n( &last_scope, name, __ATOMIC_RELAXED );
+   __atomic_store_n( &last_size, size, __ATOMIC_RELAXED );
+
+   for ( int i = 0; i < THLA_ALLOCATION_GUARD_MAX_SCOPES; ++i ) {
+      char const *entry_name = __atomic_load_n( &scope_counts[i].name, __ATOMIC_ACQUIRE );
+      if ( entry_name == NULL ) {
+         char const *expected = NULL;
+         if ( __atomic_compare_exchange_n( &scope_counts[i].name, &expected, name,
+                                           false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) ) {
+            entry_name = name;
+         } else {
+            entry_name = expected;
+         }
+      }
+      if ( entry_name == name ) {
+         __atomic_add_fetch( &scope_counts[i].count, 1, __ATOMIC_RELAXED );
+         __atomic_add_fetch( &scope_counts[i].bytes, size, __ATOMIC_RELAXED );
+         return;
+      }
+   }
+   __atomic_add_fetch( &overflow_count, 1, __ATOMIC_RELAXED );
+}
+
+string const AllocationGuard::to_string()
+{
+   // Do not count the allocations made building this report.
+   char const *prev_name = set_scope( NULL );
+
+   ostringstream msg;
+   if ( !is_built_in() ) {
+      msg << "  Allocation guard not built in, define THLA_ALLOCATION_GUARD in CompileConfig.hh." << endl;
+      (void)set_scope( prev_name );
+      return msg.str();
+   }
+
+   msg << "  Allocations in guarded jobs: " << get_allocation_count()
+       << " (" << __atomic_load_n( &total_bytes, __ATOMIC_RELAXED ) << " bytes total)"
+       << ( is_armed() ? "" : ", not armed" ) << endl;
+
+   char const *name = __atomic_load_n( &last_scope, __ATOMIC_RELAXED );
+   if ( name != NULL ) {
+      msg << "  Last allocation: " << __atomic_load_n( &last_size, __ATOMIC_RELAXED )
+          << " bytes in " << name << endl;
+   }
+   for ( int i = 0; i < THLA_ALLOCATION_GUARD_MAX_SCOPES; ++i ) {
+      name = __atomic_load_n( &scope_counts[i].name, __ATOMIC_ACQUIRE );
+      if ( name == NULL ) {
+         break;
+      }
+      msg << "  " << name << ": "
+          << __atomic_load_n( &scope_counts[i].count, __ATOMIC_RELAXED ) << " allocations, "
+          << __atomic_load_n( &scope_counts[i].bytes, __ATOMIC_RELAXED ) << " bytes" << endl;
+   }
+   unsigned long long const overflow = __atomic_load_n( &overflow_count, __ATOMIC_RELAXED );
+   if ( overflow > 0 ) {
+      msg << "  Allocations in other jobs: " << overflow << endl;
+   }
+
+   (void)set_scope( prev_name );
+   return msg.str();
+}
@@ -0,0 +1,842 @@
+/*!
+@file TrickHLA/AsyncLogger.cpp
+@ingroup TrickHLA
+@brief Asynchronous logger that moves the formatting and writing of the
+TrickHLA debug messages off of the calling threads.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AsyncLogger.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{ThreadConfig.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Queue the oversized messages in order and drain them all on stop.}
+@revs_end
+
+*/
+
+// System include files.
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/AsyncLogger.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/ThreadConfig.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Limits of a single record, where a message that does not fit is formatted
+// on the calling thread and queued as text over consecutive records.
+#define THLA_LOG_MAX_ARGS 24
+#define THLA_LOG_PAYLOAD_SIZE 768
+#define THLA_LOG_TEXT_SIZE 4096
+
+namespace
+{
+
+typedef enum {
+   LOG_ARG_INT         = 0,
+   LOG_ARG_LONG        = 1,
+   LOG_ARG_LONG_LONG   = 2,
+   LOG_ARG_DOUBLE      = 3,
+   LOG_ARG_LONG_DOUBLE = 4,
+   LOG_ARG_POINTER     = 5,
+   LOG_ARG_STRING      = 6
+} LogArgEnum;
+
+// A copy of one argument, where a string is an offset into the payload.
+typedef struct {
+   LogArgEnum type;
+   union {
+      long long   i;
+      double      d;
+      long double ld;
+      void const *p;
+      size_t      offset;
+   } value;
+} LogArg;
+
+// A message with its arguments, where the strings are copied into the payload.
+typedef struct {
+   int64_t      time_ns;
+   char const  *format;
+   FILE        *stream;
+   unsigned int arg_count;
+   LogArg       args[THLA_LOG_MAX_ARGS];
+   char         payload[THLA_LOG_PAYLOAD_SIZE];
+} LogRecord;
+
+// Single producer, single consumer ring of records for one thread. The owning
+// thread advances the head and the writer thread advances the tail.
+typedef struct {
+   LogRecord         *records;
+   unsigned long long mask;
+   unsigned long long head;
+   unsigned long long tail;
+   unsigned long long dropped;
+} LogRing;
+
+// The rings are kept after their thread exits, since the thread local pointer
+// of a running thread still refers to them.
+MutexLock                rings_mutex;
+std::vector< LogRing * > rings;
+
+// Ring of the calling thread, or NULL if it has not logged a message yet.
+__thread LogRing *thread_ring = NULL;
+
+pthread_t          writer_thread;
+ThreadConfig      *writer_thread_config = NULL;
+unsigned long long dropped_reported = 0;
+
+// Signaled by the writer thread once it applied its configuration, which
+// start() waits for under the rings_mutex.
+pthread_cond_t writer_ready_cond = PTHREAD_COND_INITIALIZER;
+bool           writer_ready      = false;
+
+// Number of threads between checking that the logger is running and
+// queuing their message, which stop() waits on before its final drain.
+int active_producers = 0;
+
+// Format of the records holding the text of a preformatted message.
+char const *const text_format = "%s";
+
+int64_t now_ns()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ( ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec );
+}
+
+LogRing *create_thread_ring(
+   size_t const records_per_thread )
+{
+   size_t capacity = 1;
+   while ( capacity < records_per_thread ) {
+      capacity <<= 1;
+   }
+
+   LogRing *ring = new LogRing();
+   ring->records = new LogRecord[capacity];
+   ring->mask    = capacity - 1;
+   ring->head    = 0;
+   ring->tail    = 0;
+   ring->dropped = 0;
+
+   MutexProtection auto_unlock_mutex( &rings_mutex );
+   rings.push_back( ring );
+   return ring;
+}
+
+/*!
+ * @brief Write a message on the calling thread.
+ */
+void write_now(
+   FILE       *stream,
+   char const *format,
+   va_list     args )
+{
+   char    text[THLA_LOG_TEXT_SIZE];
+   va_list args_copy;
+   va_copy( args_copy, args );
+   int const length = vsnprintf( text, sizeof( text ), format, args_copy );
+   va_end( args_copy );
+
+   if ( length < 0 ) {
+      return;
+   }
+   if ( (size_t)length < sizeof( text ) ) {
+      send_hs( stream, "%s", text );
+   } else {
+      char *long_text = (char *)malloc( (size_t)length + 1 );
+      if ( long_text != NULL ) {
+         va_copy( args_copy, args );
+         vsnprintf( long_text, (size_t)length + 1, format, args_copy );
+         va_end( args_copy );
+         send_hs( stream, "%s", long_text );
+         free( long_text );
+      }
+   }
+}
+
+/*!
+ * @brief Copy a string into the payload of the record.
+ * @return False if the payload is full.
+ */
+bool copy_string(
+   LogRecord  *record,
+   size_t     &payload_used,
+   LogArg     &arg,
+   char const *str )
+{
+   if ( str == NULL ) {
+      str = "(null)";
+   }
+   size_t const length = strlen( str );
+   if ( ( payload_used + length + 1 ) > THLA_LOG_PAYLOAD_SIZE ) {
+      return false;
+   }
+   memcpy( record->payload + payload_used, str, length + 1 );
+   arg.type         = LOG_ARG_STRING;
+   arg.value.offset = payload_used;
+   payload_used += length + 1;
+   return true;
+}
+
+/*!
+ * @brief Copy a wide string into the payload of the record as a multibyte
+ * string, which is then formatted with %s.
+ * @return False if the payload is full or the string can not be converted.
+ */
+bool copy_wide_string(
+   LogRecord     *record,
+   size_t        &payload_used,
+   LogArg        &arg,
+   wchar_t const *wstr )
+{
+   if ( wstr == NULL ) {
+      return copy_string( record, payload_used, arg, NULL );
+   }
+   size_t const room   = THLA_LOG_PAYLOAD_SIZE - payload_used;
+   size_t const length = wcstombs( record->payload + payload_used, wstr, room );
+   if ( ( length == (size_t)-1 ) || ( length >= room ) ) {
+      return false;
+   }
+   record->payload[payload_used + length] = '\0';
+   arg.type                               = LOG_ARG_STRING;
+   arg.value.offset                       = payload_used;
+   payload_used += length + 1;
+   return true;
+}
+
+/*!
+ * @brief Skip the flags, width, precision and length of a conversion.
+ * @return The conversion character, or the terminating null character.
+ * @param p          Points to the character after the '%', and is left on
+ * the conversion character.
+ * @param star_count Number of '*' width and precision arguments.
+ * @param length     Length modifier: 0 none, 'h', 'H' for hh, 'l', 'q' for
+ * ll, 'L', 'z', 'j' or 't'. */
+char parse_conversion(
+   char const  *&p,
+   unsigned int &star_count,
+   char         &length )
+{
+   star_count = 0;
+   length     = 0;
+
+   while ( ( *p != '\0' ) && ( strchr( "-+ #0'", *p ) != NULL ) ) {
+      ++p;
+   }
+   if ( *p == '*' ) {
+      ++star_count;
+      ++p;
+   } else {
+      while ( ( *p >= '0' ) && ( *p <= '9' ) ) {
+         ++p;
+      }
+   }
+   if ( *p == '.' ) {
+      ++p;
+      if ( *p == '*' ) {
+         ++star_count;
+         ++p;
+      } else {
+         while ( ( *p >= '0' ) && ( *p <= '9' ) ) {
+            ++p;
+         }
+      }
+   }
+   switch ( *p ) {
+      case 'h':
+         ++p;
+         length = 'h';
+         if ( *p == 'h' ) {
+            ++p;
+            length = 'H';
+         }
+         break;
+      case 'l':
+         ++p;
+         length = 'l';
+         if ( *p == 'l' ) {
+            ++p;
+            length = 'q';
+         }
+         break;
+      case 'L':
+      case 'z':
+      case 'j':
+      case 't':
+         length = *p;
+         ++p;
+         break;
+      default:
+         break;
+   }
+   return *p;
+}
+
+/*!
+ * @brief Copy the arguments of the message into the record.
+ * @return False if the message does not fit in a record or uses a
+ * conversion that can not be deferred, such as %n.
+ */
+bool capture_args(
+   LogRecord  *record,
+   char const *format,
+   va_list     args )
+{
+   size_t payload_used = 0;
+   record->arg_count   = 0;
+
+   for ( char const *p = format; *p != '\0'; ++p ) {
+      if ( *p != '%' ) {
+         continue;
+      }
+      ++p;
+      if ( *p == '%' ) {
+         continue;
+      }
+
+      unsigned int star_count;
+      char         length;
+      char const   conversion = parse_conversion( p, star_count, length );
+
+      if ( ( record->arg_count + star_count + 1 ) > THLA_LOG_MAX_ARGS ) {
+         return false;
+      }
+      for ( unsigned int i = 0; i < star_count; ++i ) {
+         LogArg &star   = record->args[record->arg_count++];
+         star.type      = LOG_ARG_INT;
+         star.value.i   = va_arg( args, int );
+      }
+
+      LogArg &arg = record->args[record->arg_count++];
+      switch ( conversion ) {
+         case 'd':
+         case 'i':
+         case 'u':
+         case 'o':
+         case 'x':
+         case 'X':
+            if ( length == 'q' ) {
+               arg.type    = LOG_ARG_LONG_LONG;
+               arg.value.i = va_arg( args, long long );
+            } else if ( ( length == 'l' ) || ( length == 'z' ) || ( length == 'j' ) || ( length == 't' ) ) {
+               arg.type    = LOG_ARG_LONG;
+               arg.value.i = va_arg( args, long );
+            } else {
+               arg.type    = LOG_ARG_INT;
+               arg.value.i = va_arg( args, int );
+            }
+            break;
+         case 'c':
+            arg.type    = LOG_ARG_INT;
+            arg.value.i = va_arg( args, int );
+            break;
+         case 'e':
+         case 'E':
+         case 'f':
+         case 'F':
+         case 'g':
+         case 'G':
+         case 'a':
+         case 'A':
+            if ( length == 'L' ) {
+               arg.type     = LOG_ARG_LONG_DOUBLE;
+               arg.value.ld = va_arg( args, long double );
+            } else {
+               arg.type    = LOG_ARG_DOUBLE;
+               arg.value.d = va_arg( args, double );
+            }
+            break;
+         case 'p':
+            arg.type    = LOG_ARG_POINTER;
+            arg.value.p = va_arg( args, void * );
+            break;
+         case 's':
+            if ( length == 'l' ) {
+               if ( !copy_wide_string( record, payload_used, arg, va_arg( args, wchar_t * ) ) ) {
+                  return false;
+               }
+            } else if ( !copy_string( record, payload_used, arg, va_arg( args, char * ) ) ) {
+               return false;
+            }
+            break;
+         default:
+            // Includes %n and a format that ends in the middle of a conversion.
+            return false;
+      }
+   }
+   return true;
+}
+
+template < typename T >
+int format_value(
+   char              *text,
+   size_t const       size,
+   char const        *spec,
+   LogArg const      *stars,
+   unsigned int const star_count,
+   T const            value )
+{
+   switch ( star_count ) {
+      case 0:
+         return snprintf( text, size, spec, value );
+      case 1:
+         return snprintf( text, size, spec, (int)stars[0].value.i, value );
+      default:
+         return snprintf( text, size, spec, (int)stars[0].value.i, (int)stars[1].value.i, value );
+   }
+}
+
+/*!
+ * @brief Format a record into the text buffer.
+ */
+void format_record(
+   LogRecord const *record,
+   char            *text,
+   size_t const     size )
+{
+   size_t       used    = 0;
+   unsigned int arg_idx = 0;
+   for ( char const *p = record->format; ( *p != '\0' ) && ( used < ( size - 1 ) ); ++p ) {
+      if ( *p != '%' ) {
+         text[used++] = *p;
+         continue;
+      }
+      if ( *( p + 1 ) == '%' ) {
+         text[used++] = '%';
+         ++p;
+         continue;
+      }
+
+      // Copy the conversion specification, without the 'l' of a wide string
+      // since it has already been converted to a multibyte string.
+      char const  *begin = p++;
+      unsigned int star_count;
+      char         length;
+      char const   conversion = parse_conversion( p, star_count, length );
+      char         spec[32];
+      size_t       spec_length = (size_t)( p - begin ) + 1;
+      if ( spec_length >= sizeof( spec ) ) {
+         return;
+      }
+      memcpy( spec, begin, spec_length );
+      spec[spec_length] = '\0';
+      if ( ( conversion == 's' ) && ( length == 'l' ) ) {
+         spec[spec_length - 2] = 's';
+         spec[spec_length - 1] = '\0';
+      }
+
+      LogArg const *stars = &record->args[arg_idx];
+      LogArg const &arg   = record->args[arg_idx + star_count];
+      arg_idx += star_count + 1;
+
+      char  *out  = text + used;
+      size_t room = size - used;
+      int    count;
+      switch ( arg.type ) {
+         case LOG_ARG_INT:
+            count = format_value( out, room, spec, stars, star_count, (int)arg.value.i );
+            break;
+         case LOG_ARG_LONG:
+            count = format_value( out, room, spec, stars, star_count, (long)arg.value.i );
+            break;
+         case LOG_ARG_LONG_LONG:
+            count = format_value( out, room, spec, stars, star_count, arg.value.i );
+            break;
+         case LOG_ARG_DOUBLE:
+            count = format_value( out, room, spec, stars, star_count, arg.value.d );
+            break;
+         case LOG_ARG_LONG_DOUBLE:
+            count = format_value( out, room, spec, stars, star_count, arg.value.ld );
+            break;
+         case LOG_ARG_POINTER:
+            count = format_value( out, room, spec, stars, star_count, arg.value.p );
+            break;
+         default:
+            count = format_value( out, room, spec, stars, star_count,
+                                  (char const *)( record->payload + arg.value.offset ) );
+            break;
+      }
+      if ( count > 0 ) {
+         used += ( (size_t)count < room ) ? (size_t)count : ( room - 1 );
+      }
+   }
+   text[used] = '\0';
+}
+
+/*!
+ * @brief Format a message that does not fit in a record on the calling thread
+ * and queue the text split over consecutive records of the ring, so it is
+ * written in order with the messages queued before it. The message is
+ * dropped if the ring does not have room for all of its records.
+ */
+void enqueue_text(
+   LogRing      *ring,
+   int64_t const time_ns,
+   FILE         *stream,
+   char const   *format,
+   va_list       args )
+{
+   char    text[THLA_LOG_TEXT_SIZE];
+   char   *message = text;
+   va_list args_copy;
+   va_copy( args_copy, args );
+   int const length = vsnprintf( text, sizeof( text ), format, args_copy );
+   va_end( args_copy );
+
+   if ( length < 0 ) {
+      return;
+   }
+   if ( (size_t)length >= sizeof( text ) ) {
+      message = (char *)malloc( (size_t)length + 1 );
+      if ( message == NULL ) {
+         __atomic_add_fetch( &ring->dropped, 1, __ATOMIC_RELAXED );
+         return;
+      }
+      va_copy( args_copy, args );
+      vsnprintf( message, (size_t)length + 1, format, args_copy );
+      va_end( args_copy );
+   }
+
+   size_t const             chunk_size   = THLA_LOG_PAYLOAD_SIZE - 1;
+   size_t const             record_count = ( length > 0 ) ? ( ( (size_t)length + chunk_size - 1 ) / chunk_size ) : 1;
+   unsigned long long const head         = ring->head;
+   unsigned long long const used         = head - __atomic_load_n( &ring->tail, __ATOMIC_ACQUIRE );
+
+   if ( ( used + record_count ) > ( ring->mask + 1 ) ) {
+      __atomic_add_fetch( &ring->dropped, 1, __ATOMIC_RELAXED );
+   } else {
+      for ( size_t k = 0; k < record_count; ++k ) {
+         size_t const offset = k * chunk_size;
+         size_t const count  = ( ( (size_t)length - offset ) < chunk_size ) ? ( (size_t)length - offset ) : chunk_size;
+
+         LogRecord *record = &ring->records[( head + k ) & ring->mask];
+         record->time_ns   = time_ns;
+         record->stream    = stream;
+         record->format    = text_format;
+         record->arg_count = 1;
+
+         record->args[0].type         = LOG_ARG_STRING;
+         record->args[0].value.offset = 0;
+         memcpy( record->payload, message + offset, count );
+         record->payload[count] = '\0';
+      }
+      __atomic_store_n( &ring->head, head + record_count, __ATOMIC_RELEASE );
+   }
+
+   if ( message != text ) {
+      free( message );
+   }
+}
+
+/*!
+ * @brief Queue a message in the ring of the calling thread.
+ */
+void enqueue(
+   size_t const records_per_thread,
+   FILE        *stream,
+   char const  *format,
+   va_list      args )
+{
+   LogRing *ring = thread_ring;
+   if ( ring == NULL ) {
+      thread_ring = ring = create_thread_ring( records_per_thread );
+   }
+
+   unsigned long long const head = ring->head;
+   if ( ( head - __atomic_load_n( &ring->tail, __ATOMIC_ACQUIRE ) ) > ring->mask ) {
+      __atomic_add_fetch( &ring->dropped, 1, __ATOMIC_RELAXED );
+      return;
+   }
+
+   LogRecord *record = &ring->records[head & ring->mask];
+   record->time_ns   = now_ns();
+   record->stream    = stream;
+   record->format    = format;
+
+   va_list args_copy;
+   va_copy( args_copy, args );
+   bool const captured = capture_args( record, format, args_copy );
+   va_end( args_copy );
+
+   if ( captured ) {
+      __atomic_store_n( &ring->head, head + 1, __ATOMIC_RELEASE );
+   } else {
+      enqueue_text( ring, record->time_ns, stream, format, args );
+   }
+}
+
+/*!
+ * @brief Queue the message if the writer thread is running, otherwise write
+ * it now. The producer count makes stop() wait for a thread that found the
+ * logger running until its message is queued.
+ */
+void dispatch(
+   size_t const records_per_thread,
+   FILE        *stream,
+   char const  *format,
+   va_list      args )
+{
+   __atomic_add_fetch( &active_producers, 1, __ATOMIC_SEQ_CST );
+   __atomic_thread_fence( __ATOMIC_SEQ_CST );
+   if ( AsyncLogger::is_running() ) {
+      enqueue( records_per_thread, stream, format, args );
+   } else {
+      write_now( stream, format, args );
+   }
+   __atomic_sub_fetch( &active_producers, 1, __ATOMIC_RELEASE );
+}
+
+typedef struct {
+   int64_t          time_ns;
+   LogRecord const *record;
+} PendingRecord;
+
+bool is_earlier(
+   PendingRecord const &a,
+   PendingRecord const &b )
+{
+   return ( a.time_ns < b.time_ns );
+}
+
+/*!
+ * @brief Write the queued records from all the rings in timestamp order.
+ * @return Number of records written.
+ */
+size_t drain()
+{
+   std::vector< LogRing * > current_rings;
+   {
+      MutexProtection auto_unlock_mutex( &rings_mutex );
+      current_rings = rings;
+   }
+
+   std::vector< unsigned long long > heads( current_rings.size() );
+   std::vector< PendingRecord >      pending;
+   unsigned long long                dropped = 0;
+
+   for ( size_t r = 0; r < current_rings.size(); ++r ) {
+      LogRing *ring = current_rings[r];
+      heads[r]      = __atomic_load_n( &ring->head, __ATOMIC_ACQUIRE );
+      for ( unsigned long long i = ring->tail; i < heads[r]; ++i ) {
+         PendingRecord entry;
+         entry.record  = &ring->records[i & ring->mask];
+         entry.time_ns = entry.record->time_ns;
+         pending.push_back( entry );
+      }
+      dropped += __atomic_load_n( &ring->dropped, __ATOMIC_RELAXED );
+   }
+
+   std::stable_sort( pending.begin(), pending.end(), is_earlier );
+
+   static char text[THLA_LOG_TEXT_SIZE];
+   for ( size_t i = 0; i < pending.size(); ++i ) {
+      format_record( pending[i].record, text, sizeof( text ) );
+      send_hs( pending[i].record->stream, "%s", text );
+   }
+
+   // Give the records back to the threads.
+   for ( size_t r = 0; r < current_rings.size(); ++r ) {
+      __atomic_store_n( &current_rings[r]->tail, heads[r], __ATOMIC_RELEASE );
+   }
+
+   if ( dropped > dropped_reported ) {
+      send_hs( stderr, "AsyncLogger::drain():%d WARNING: Dropped %llu log \
+messages because the log ring of a thread was full, consider increasing the \
+federate async_log_records_per_thread setting.%c",
+               __LINE__, ( dropped - dropped_reported ), THLA_NEWLINE );
+      dropped_reported = dropped;
+   }
+
+   return pending.size();
+}
+
+/*!
+ * @brief Queue the message if the writer thread is running, otherwise write
+ * it now.
+ */
+void emit(
+   size_t const records_per_thread,
+   FILE        *stream,
+   char const  *format,
+   ... )
+{
+   va_list args;
+   va_start( args, format );
+   dispatch( records_per_thread, stream, format, args );
+   va_end( args );
+}
+
+void *writer_main(
+   void * )
+{
+   if ( writer_thread_config != NULL ) {
+      writer_thread_config->apply( "THLA_logger" );
+   } else {
+      pthread_setname_np( pthread_self(), "THLA_logger" );
+   }
+
+   rings_mutex.lock();
+   writer_ready = true;
+   pthread_cond_broadcast( &writer_ready_cond );
+   rings_mutex.unlock();
+
+   while ( AsyncLogger::is_running() ) {
+      if ( drain() == 0 ) {
+         usleep( 1000 );
+      }
+   }
+   return NULL;
+}
+
+} // namespace
+
+// Initialize the static data.
+bool         AsyncLogger::running            = false;
+size_t       AsyncLogger::records_per_thread = 1024;
+unsigned int AsyncLogger::rate_limit         = 0;
+
+/*!
+ * @details The writer thread is only started once, so calling this again
+ * while it is running does nothing.
+ * @job_class{initialization}
+ */
+bool AsyncLogger::start(
+   size_t const  records_per_thread,
+   ThreadConfig *thread_config )
+{
+   if ( is_running() ) {
+      return true;
+   }
+   AsyncLogger::records_per_thread = ( records_per_thread > 0 ) ? records_per_thread : 1;
+   writer_thread_config            = thread_config;
+   writer_ready                    = false;
+
+   __atomic_store_n( &running, true, __ATOMIC_RELEASE );
+   if ( pthread_create( &writer_thread, NULL, writer_main, NULL ) != 0 ) {
+      __atomic_store_n( &running, false, __ATOMIC_RELEASE );
+      send_hs( stderr, "AsyncLogger::start():%d WARNING: Could not create the \
+log writer thread, so messages will be written by the calling threads.%c",
+               __LINE__, THLA_NEWLINE );
+      return false;
+   }
+
+   // Wait for the writer thread to apply its configuration, so that the
+   // startup thread report shows its effective affinity and scheduling.
+   rings_mutex.lock();
+   while ( !writer_ready ) {
+      pthread_cond_wait( &writer_ready_cond, &rings_mutex.mutex );
+   }
+   rings_mutex.unlock();
+
+   return true;
+}
+
+/*!
+ * @details New messages are written on the calling threads from the moment
+ * the logger is marked as stopped. The final drain waits for the threads that
+ * were still queuing a message, so no queued message is left behind.
+ * @job_class{shutdown}
+ */
+void AsyncLogger::stop()
+{
+   if ( !is_running() ) {
+      return;
+   }
+   __atomic_store_n( &running, false, __ATOMIC_SEQ_CST );
+   pthread_join( writer_thread, NULL );
+
+   while ( __atomic_load_n( &active_producers, __ATOMIC_SEQ_CST ) != 0 ) {
+      sched_yield();
+   }
+   drain();
+}
+
+void AsyncLogger::set_rate_limit(
+   unsigned int const messages_per_second )
+{
+   __atomic_store_n( &rate_limit, messages_per_second, __ATOMIC_RELAXED );
+}
+
+unsigned long long AsyncLogger::get_dropped_count()
+{
+   MutexProtection    auto_unlock_mutex( &rings_mutex );
+   unsigned long long dropped = 0;
+   for ( size_t r = 0; r < rings.size(); ++r ) {
+      dropped += __atomic_load_n( &rings[r]->dropped, __ATOMIC_RELAXED );
+   }
+   return dropped;
+}
+
+/*!
+ * @details The rate limit counts the messages of the call site in one second
+ * windows. The messages over the limit are only counted, and the count is
+ * reported with the first message of the next window.
+ */
+void AsyncLogger::log(
+   LogCallSite &site,
+   FILE        *stream,
+   char const  *format,
+   ... )
+{
+   unsigned int const limit = __atomic_load_n( &rate_limit, __ATOMIC_RELAXED );
+   if ( limit > 0 ) {
+      int64_t const now          = now_ns();
+      int64_t       window_begin = __atomic_load_n( &site.window_begin_ns, __ATOMIC_RELAXED );
+      if ( ( ( now - window_begin ) >= 1000000000LL )
+           && __atomic_compare_exchange_n( &site.window_begin_ns, &window_begin, now,
+                                           false, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+         __atomic_store_n( &site.window_count, 0, __ATOMIC_RELAXED );
+         unsigned int const suppressed = __atomic_exchange_n( &site.suppressed, 0, __ATOMIC_RELAXED );
+         if ( suppressed > 0 ) {
+            emit( records_per_thread, stream,
+                  "AsyncLogger::log():%d Suppressed %u messages over the rate \
+limit of %u per second from: %.80s%c",
+                  __LINE__, suppressed, limit, format, THLA_NEWLINE );
+         }
+      }
+      if ( __atomic_add_fetch( &site.window_count, 1, __ATOMIC_RELAXED ) > limit ) {
+         __atomic_add_fetch( &site.suppressed, 1, __ATOMIC_RELAXED );
+         return;
+      }
+   }
+
+   va_list args;
+   va_start( args, format );
+   dispatch( records_per_thread, stream, format, args );
+   va_end( args );
+}
@@ -0,0 +1,398 @@
+/*!
+@file TrickHLA/AsyncPublisher.cpp
+@ingroup TrickHLA
+@brief This class issues the RTI attribute updates for the cyclic and
+requested object data from a dedicated publisher thread.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{AsyncPublisher.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Int64Time.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{ThreadConfig.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Atomic running flag.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/AsyncPublisher.hh"
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/Utilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include RTI1516_HEADER
+#pragma GCC diagnostic pop
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @brief The function that runs in the publisher P-thread.
+ * @details This function is local to this file and is NOT part of the class.
+ * @return Void pointer and is always NULL.
+ * @param arg Arguments list.
+ * @job_class{scheduled}
+ */
+static void *async_publisher_pthread_function(
+   void *arg )
+{
+   AsyncPublisher *publisher = static_cast< AsyncPublisher * >( arg );
+   publisher->run();
+   pthread_exit( NULL );
+   return ( NULL );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+AsyncPublisher::AsyncPublisher()
+   : rti_ambassador( NULL ),
+     publisher_thread(),
+     thread_config( NULL ),
+     running( false ),
+     stop_requested( false ),
+     thread_ready( false ),
+     queue_mutex(),
+     queue(),
+     free_records(),
+     publishing( false ),
+     queued_count( 0 ),
+     published_count( 0 ),
+     error_count( 0 ),
+     flush_count( 0 ),
+     max_queue_depth( 0 ),
+     flush_wait_max( 0 )
+{
+   pthread_cond_init( &queue_cond, NULL );
+   pthread_cond_init( &flush_cond, NULL );
+   pthread_cond_init( &ready_cond, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+AsyncPublisher::~AsyncPublisher()
+{
+   stop();
+
+   while ( !queue.empty() ) {
+      delete queue.front();
+      queue.pop_front();
+   }
+   for ( size_t i = 0; i < free_records.size(); ++i ) {
+      delete free_records[i];
+   }
+   free_records.clear();
+
+   pthread_cond_destroy( &queue_cond );
+   pthread_cond_destroy( &flush_cond );
+   pthread_cond_destroy( &ready_cond );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void AsyncPublisher::start(
+   RTIambassador *rti_amb,
+   ThreadConfig  *thread_config )
+{
+   if ( is_running() ) {
+      return;
+   }
+
+   if ( rti_amb == NULL ) {
+      ostringstream errmsg;
+      errmsg << "AsyncPublisher::start():" << __LINE__
+             << " ERROR: Unexpected NULL RTI Ambassador!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   this->rti_ambassador = rti_amb;
+   this->thread_config  = thread_config;
+   this->stop_requested = false;
+   this->thread_ready   = false;
+
+   int ret = pthread_create( &publisher_thread, NULL, async_publisher_pthread_function, this );
+   if ( ret != 0 ) {
+      ostringstream errmsg;
+      errmsg << "AsyncPublisher::start():" << __LINE__
+             << " ERROR: Failed to create the publisher thread, error code:"
+             << ret << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Wait for the thread to apply its configuration, so that the startup
+   // thread report shows its effective affinity and scheduling.
+   queue_mutex.lock();
+   while ( !thread_ready ) {
+      pthread_cond_wait( &ready_cond, &queue_mutex.mutex );
+   }
+   queue_mutex.unlock();
+
+   __atomic_store_n( &running, true, __ATOMIC_RELEASE );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stdout, "AsyncPublisher::start():%d Started the attribute update publisher thread.%c",
+               __LINE__, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void AsyncPublisher::stop()
+{
+   if ( !is_running() ) {
+      return;
+   }
+
+   // Send anything still queued before we stop.
+   flush();
+
+   queue_mutex.lock();
+   this->stop_requested = true;
+   pthread_cond_signal( &queue_cond );
+   queue_mutex.unlock();
+
+   pthread_join( publisher_thread, NULL );
+   __atomic_store_n( &running, false, __ATOMIC_RELEASE );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+      send_hs( stdout, "AsyncPublisher::stop():%d %s%c",
+               __LINE__, get_summary().c_str(), THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details Only the records are preallocated. The queue is a deque, which
+ * allocates a new block of 512 bytes each time the queued pointers cross a
+ * block boundary, so it still allocates once every 64 updates.
+ * @job_class{initialization}
+ */
+void AsyncPublisher::reserve_records(
+   size_t const count )
+{
+   queue_mutex.lock();
+
+   size_t const total = queue.size() + free_records.size();
+   if ( total < count ) {
+      free_records.reserve( count );
+      for ( size_t i = total; i < count; ++i ) {
+         free_records.push_back( new AsyncPublishRecord() );
+      }
+   }
+
+   queue_mutex.unlock();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void AsyncPublisher::publish(
+   Object                     *obj,
+   ObjectInstanceHandle const &instance_handle,
+   AttributeHandleValueMap    &attribute_values,
+   bool const                  timestamp_order,
+   Int64Time const            &update_time )
+{
+   queue_mutex.lock();
+
+   AsyncPublishRecord *record;
+   if ( free_records.empty() ) {
+      record = new AsyncPublishRecord();
+   } else {
+      record = free_records.back();
+      free_records.pop_back();
+   }
+
+   // Swap the maps instead of copying them. The caller gets back the empty
+   // map the record was last recycled with.
+   record->object          = obj;
+   record->instance_handle = instance_handle;
+   record->timestamp_order = timestamp_order;
+   record->update_time     = update_time;
+   record->attribute_values.swap( attribute_values );
+
+   queue.push_back( record );
+   ++queued_count;
+   if ( queue.size() > max_queue_depth ) {
+      max_queue_depth = queue.size();
+   }
+
+   pthread_cond_signal( &queue_cond );
+   queue_mutex.unlock();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void AsyncPublisher::flush()
+{
+   if ( !is_running() ) {
+      return;
+   }
+
+   queue_mutex.lock();
+   if ( !queue.empty() || publishing ) {
+      int64_t const start_time = clock_wall_time();
+
+      while ( !queue.empty() || publishing ) {
+         pthread_cond_wait( &flush_cond, &queue_mutex.mutex );
+      }
+
+      int64_t const wait_time = clock_wall_time() - start_time;
+      if ( wait_time > flush_wait_max ) {
+         flush_wait_max = wait_time;
+      }
+      ++flush_count;
+   }
+   queue_mutex.unlock();
+}
+
+void AsyncPublisher::run()
+{
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   if ( thread_config != NULL ) {
+      thread_config->apply( "THLA_publisher" );
+   }
+
+   queue_mutex.lock();
+
+   // Let start() return now that the thread configuration is applied.
+   this->thread_ready = true;
+   pthread_cond_broadcast( &ready_cond );
+
+   while ( true ) {
+      while ( queue.empty() && !stop_requested ) {
+         pthread_cond_wait( &queue_cond, &queue_mutex.mutex );
+      }
+      if ( queue.empty() ) {
+         // Stop was requested and there is nothing left to send.
+         break;
+      }
+
+      AsyncPublishRecord *record = queue.front();
+      queue.pop_front();
+      this->publishing = true;
+
+      // Do not hold the lock while we are in the RTI so the Trick main thread
+      // can keep queuing updates.
+      queue_mutex.unlock();
+
+      send_record( *record );
+      record->attribute_values.clear();
+
+      queue_mutex.lock();
+      free_records.push_back( record );
+      this->publishing = false;
+      if ( queue.empty() ) {
+         pthread_cond_broadcast( &flush_cond );
+      }
+   }
+   queue_mutex.unlock();
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+/*!
+ * @details Only the publisher thread updates the published and error counts.
+ */
+void AsyncPublisher::send_record(
+   AsyncPublishRecord &record )
+{
+   try {
+      if ( record.timestamp_order ) {
+         // Send as Timestamp Order
+         (void)rti_ambassador->updateAttributeValues( record.instance_handle,
+                                                      record.attribute_values,
+                                                      RTI1516_USERDATA( 0, 0 ),
+                                                      record.update_time.get() );
+      } else {
+         // Send as Receive Order (i.e. with no timestamp).
+         (void)rti_ambassador->updateAttributeValues( record.instance_handle,
+                                                      record.attribute_values,
+                                                      RTI1516_USERDATA( 0, 0 ) );
+      }
+      ++published_count;
+   } catch ( InvalidLogicalTime const &e ) {
+      ++error_count;
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "AsyncPublisher::send_record():%d invalid logical time \
+exception for '%s', update_time=%f seconds, with error message '%s'.%c",
+               __LINE__, record.object->get_name(),
+               record.update_time.get_time_in_seconds(), rti_err_msg.c_str(),
+               THLA_NEWLINE );
+   } catch ( AttributeNotOwned const &e ) {
+      ++error_count;
+      send_hs( stderr, "AsyncPublisher::send_record():%d detected remote ownership for '%s'%c",
+               __LINE__, record.object->get_name(), THLA_NEWLINE );
+   } catch ( ObjectInstanceNotKnown const &e ) {
+      ++error_count;
+      send_hs( stderr, "AsyncPublisher::send_record():%d object instance not known for '%s'%c",
+               __LINE__, record.object->get_name(), THLA_NEWLINE );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      ++error_count;
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "AsyncPublisher::send_record():%d For object '%s', Exception: '%s'%c",
+               __LINE__, record.object->get_name(), rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+}
+
+string AsyncPublisher::get_summary()
+{
+   queue_mutex.lock();
+   ostringstream msg;
+   msg << "AsyncPublisher: queued:" << queued_count
+       << " published:" << published_count
+       << " errors:" << error_count
+       << " max queue depth:" << max_queue_depth
+       << " flush waits:" << flush_count
+       << " max flush wait:" << flush_wait_max << " microseconds";
+   queue_mutex.unlock();
+   return msg.str();
+}
@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AsyncLogger.cpp}
 @trick_link_dependency{Attribute.cpp}
 @trick_link_dependency{Conditional.cpp}
 @trick_link_dependency{DebugHandler.cpp}
@@ -32,6 +33,14 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, May 2006, --, Initial version.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse the encoded buffer for unchanged strings.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse string memory when decoding.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional front/back encode buffers.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Debug messages through the asynchronous logger.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Exact string change detection.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Swap the encode buffers once per frame with a string cache per slot.}
 @revs_end
 
 */
@@ -51,11 +60,13 @@ NASA, Johnson Space Center\n
 #include "trick/trick_byteswap.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AsyncLogger.hh"
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/Conditional.hh"
 #include "TrickHLA/Constants.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Int64Interval.hh"
+#include "TrickHLA/StringStorage.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 
@@ -79,9 +90,24 @@ Attribute::Attribute()
      rti_encoding( ENCODING_UNKNOWN ),
      cycle_time( -std::numeric_limits< double >::max() ),
      conditional( NULL ),
+     buffer_growth( BUFFER_GROWTH_GEOMETRIC ),
+     buffer_capacity_limit( 0 ),
+     max_buffer_size( 0 ),
      buffer( NULL ),
      buffer_capacity( 0 ),
+     buffer_slots( 1 ),
+     slot_buffer( NULL ),
+     slot_capacity( NULL ),
+     slot_size( NULL ),
+     back_slot( 0 ),
+     front_slot( 0 ),
+     back_packed( false ),
      size_is_static( true ),
+     string_cache_slots( 0 ),
+     string_cache_encoding( ENCODING_UNKNOWN ),
+     string_cache_items( 0 ),
+     string_cache_data(),
+     string_cache_size( 0 ),
      size( 0 ),
      num_items( 0 ),
      value_changed( false ),
@@ -106,6 +132,34 @@ Attribute::Attribute()
  */
 Attribute::~Attribute()
 {
+   if ( slot_buffer != NULL ) {
+      // The buffer is the back slot, so only free the other slots here.
+      for ( unsigned int i = 0; i < buffer_slots; ++i ) {
+         if ( ( i != back_slot ) && ( slot_buffer[i] != NULL ) ) {
+            if ( TMM_is_alloced( (char *)slot_buffer[i] ) ) {
+               TMM_delete_var_a( slot_buffer[i] );
+            }
+         }
+      }
+      if ( TMM_is_alloced( (char *)slot_buffer ) ) {
+         TMM_delete_var_a( slot_buffer );
+      }
+      slot_buffer = NULL;
+   }
+   if ( slot_capacity != NULL ) {
+      if ( TMM_is_alloced( (char *)slot_capacity ) ) {
+         TMM_delete_var_a( slot_capacity );
+      }
+      slot_capacity = NULL;
+   }
+   if ( slot_size != NULL ) {
+      if ( TMM_is_alloced( (char *)slot_size ) ) {
+         TMM_delete_var_a( slot_size );
+      }
+      slot_size = NULL;
+   }
+   buffer_slots = 1;
+
    if ( buffer != NULL ) {
       if ( TMM_is_alloced( (char *)buffer ) ) {
          TMM_delete_var_a( buffer );
@@ -631,6 +685,7 @@ void Attribute::determine_cycle_ratio(
 
 VariableLengthData Attribute::get_attribute_value()
 {
+   // The packed value is in the back buffer until the end of the frame swap.
    if ( rti_encoding == ENCODING_BOOLEAN ) {
       // The size is the number of 1-byte bool values in c++ and we need to
       // map to a 4-byte HLAboolean type. The buffer already holds the
@@ -647,6 +702,9 @@ void Attribute::extract_data(       // RETURN: -- None
       return;
    }
 
+   // The received data replaces whatever strings we last encoded.
+   invalidate_string_cache();
+
    // Keep track of the attribute FOM size and ensure enough buffer capacity.
    size_t attr_size = attr_value->size();
 
@@ -816,8 +874,8 @@ void Attribute::extract_data(       // RETURN: -- None
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      send_hs( stdout, "Attribute::extract_data():%d Decoded '%s' (trick_name '%s') from attribute map.%c",
-               __LINE__, get_FOM_name(), get_trick_name(), THLA_NEWLINE );
+      THLA_LOG( stdout, "Attribute::extract_data():%d Decoded '%s' (trick_name '%s') from attribute map.%c",
+                __LINE__, get_FOM_name(), get_trick_name(), THLA_NEWLINE );
    }
    if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
       print_buffer();
@@ -831,7 +889,8 @@ void Attribute::ensure_buffer_capacity(
    size_t capacity )
 {
    if ( capacity > buffer_capacity ) {
-      buffer_capacity = capacity;
+      buffer_capacity = Utilities::next_buffer_capacity( buffer_capacity, capacity,
+                                                         buffer_growth, buffer_capacity_limit );
       if ( buffer == NULL ) {
          buffer = (unsigned char *)TMM_declare_var_1d( "unsigned char", (int)buffer_capacity );
       } else {
@@ -856,6 +915,181 @@ void Attribute::ensure_buffer_capacity(
    }
 }
 
+/*!
+ * @details The buffer keeps at least one byte so that it is always allocated.
+ * The encoded data in the buffer is preserved, where a boolean is encoded
+ * as a 4 byte HLAboolean.
+ */
+void Attribute::shrink_to_fit()
+{
+   size_t const encoded_size = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+   size_t const fit_capacity = ( encoded_size > 0 ) ? encoded_size : 1;
+
+   if ( ( buffer != NULL ) && ( buffer_capacity > fit_capacity ) ) {
+      unsigned char *new_buffer = (unsigned char *)TMM_resize_array_1d_a( buffer, (int)fit_capacity );
+      if ( new_buffer == NULL ) {
+         send_hs( stderr, "Attribute::shrink_to_fit():%d WARNING: Could not shrink the buffer for attribute '%s' to %d bytes.%c",
+                  __LINE__, FOM_name, (int)fit_capacity, THLA_NEWLINE );
+         return;
+      }
+      buffer          = new_buffer;
+      buffer_capacity = fit_capacity;
+   }
+}
+
+/*!
+ * @details The other buffer slots are grown to the same capacity, since the
+ * back buffer moves through all of them.
+ * @job_class{initialization}
+ */
+void Attribute::prepare_buffers_for_real_time()
+{
+   size_t capacity = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+   if ( max_buffer_size > capacity ) {
+      capacity = max_buffer_size;
+   }
+   ensure_buffer_capacity( capacity );
+   Utilities::prefault_memory( buffer, buffer_capacity );
+
+   if ( buffer_slots <= 1 ) {
+      return;
+   }
+   for ( unsigned int i = 0; i < buffer_slots; ++i ) {
+      if ( i == back_slot ) {
+         slot_buffer[i]   = buffer;
+         slot_capacity[i] = buffer_capacity;
+         continue;
+      }
+      if ( slot_capacity[i] < buffer_capacity ) {
+         unsigned char *new_buffer = (unsigned char *)TMM_resize_array_1d_a( slot_buffer[i], (int)buffer_capacity );
+         if ( new_buffer == NULL ) {
+            ostringstream errmsg;
+            errmsg << "Attribute::prepare_buffers_for_real_time():" << __LINE__
+                   << " ERROR: Could not allocate memory for buffer slot " << i
+                   << " for Attribute '" << FOM_name << "' with Trick name '"
+                   << trick_name << "'!" << THLA_ENDL;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
+         slot_buffer[i]   = new_buffer;
+         slot_capacity[i] = buffer_capacity;
+      }
+      Utilities::prefault_memory( slot_buffer[i], slot_capacity[i] );
+   }
+}
+
+size_t Attribute::get_buffer_capacity() const
+{
+   if ( buffer_slots <= 1 ) {
+      return buffer_capacity;
+   }
+
+   // The back slot capacity is in buffer_capacity since it may have grown.
+   size_t capacity = buffer_capacity;
+   for ( unsigned int i = 0; i < buffer_slots; ++i ) {
+      if ( i != back_slot ) {
+         capacity += slot_capacity[i];
+      }
+   }
+   return capacity;
+}
+
+/*!
+ * @details The current buffer becomes the first slot and the other slots are
+ * allocated with the same capacity so that the steady state swaps do not
+ * allocate memory. The number of slots can only be set once.
+ * @job_class{initialization}
+ */
+void Attribute::set_buffer_slots(
+   unsigned int const requested_slots )
+{
+   if ( ( requested_slots <= 1 ) || ( slot_buffer != NULL ) ) {
+      return;
+   }
+
+   unsigned int const slots = ( requested_slots > THLA_MAX_BUFFER_SLOTS ) ? THLA_MAX_BUFFER_SLOTS
+                                                                          : requested_slots;
+   if ( slots < requested_slots ) {
+      send_hs( stderr, "Attribute::set_buffer_slots():%d WARNING: Limiting the %u buffer slots for attribute '%s' to %u.%c",
+               __LINE__, requested_slots, FOM_name, slots, THLA_NEWLINE );
+   }
+
+   // Make sure the first slot has a buffer.
+   ensure_buffer_capacity( size );
+
+   slot_buffer   = (unsigned char **)TMM_declare_var_1d( "unsigned char *", (int)slots );
+   slot_capacity = (unsigned long *)TMM_declare_var_1d( "unsigned long", (int)slots );
+   slot_size     = (unsigned long *)TMM_declare_var_1d( "unsigned long", (int)slots );
+
+   if ( ( slot_buffer == NULL ) || ( slot_capacity == NULL ) || ( slot_size == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::set_buffer_slots():" << __LINE__
+             << " ERROR: Could not allocate memory for " << slots
+             << " buffer slots for Attribute '" << FOM_name
+             << "' with Trick name '" << trick_name << "'!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   slot_buffer[0]   = buffer;
+   slot_capacity[0] = buffer_capacity;
+   slot_size[0]     = 0;
+   for ( unsigned int i = 1; i < slots; ++i ) {
+      slot_buffer[i]   = (unsigned char *)TMM_declare_var_1d( "unsigned char", (int)buffer_capacity );
+      slot_capacity[i] = buffer_capacity;
+      slot_size[i]     = 0;
+
+      if ( slot_buffer[i] == NULL ) {
+         ostringstream errmsg;
+         errmsg << "Attribute::set_buffer_slots():" << __LINE__
+                << " ERROR: Could not allocate memory for buffer slot " << i
+                << " for Attribute '" << FOM_name << "' with Trick name '"
+                << trick_name << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   buffer_slots = slots;
+   back_slot    = 0;
+   front_slot   = 0;
+}
+
+/*!
+ * @details The back slot is published with a release store so a reader on
+ * another thread that loads the front slot with an acquire load sees all the
+ * bytes that were packed into it.
+ */
+void Attribute::swap_buffers()
+{
+   if ( ( buffer_slots <= 1 ) || !back_packed ) {
+      return;
+   }
+   back_packed = false;
+
+   // The buffer may have been reallocated while packing.
+   slot_buffer[back_slot]   = buffer;
+   slot_capacity[back_slot] = buffer_capacity;
+   slot_size[back_slot]     = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+
+   __atomic_store_n( &front_slot, back_slot, __ATOMIC_RELEASE );
+
+   back_slot       = ( back_slot + 1 ) % buffer_slots;
+   buffer          = slot_buffer[back_slot];
+   buffer_capacity = slot_capacity[back_slot];
+}
+
+unsigned char const *Attribute::get_front_buffer(
+   size_t &num_bytes ) const
+{
+   if ( buffer_slots <= 1 ) {
+      num_bytes = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+      return buffer;
+   }
+
+   unsigned int const front = __atomic_load_n( &front_slot, __ATOMIC_ACQUIRE );
+
+   num_bytes = slot_size[front];
+   return slot_buffer[front];
+}
+
 void Attribute::calculate_size_and_number_of_items()
 {
    size_t num_bytes = 0;
@@ -938,36 +1172,7 @@ void Attribute::calculate_size_and_number_of_items()
    this->size = num_bytes;
 
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      ostringstream msg;
-      msg << "Attribute::calculate_size_and_number_of_items():" << __LINE__ << endl
-          << "========================================================" << endl
-          << "  FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-          << "  trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-          << "  ref2->attr->name:'" << ref2->attr->name << "'" << endl
-          << "  ref2->attr->type_name:'" << ref2->attr->type_name << "'" << endl
-          << "  ref2->attr->type:" << ref2->attr->type << endl
-          << "  ref2->attr->units:" << ref2->attr->units << endl
-          << "  size:" << size << endl
-          << "  num_items:" << num_items << endl
-          // TODO: Figure out get_size_from_attributes() API in Trick 10.
-          //   << "  get_size_from_attributes():" << get_size_from_attributes(ref2->attr, ref2->attr->name) << endl
-          << "  ref2->attr->size:" << ref2->attr->size << endl
-          << "  ref2->attr->num_index:" << ref2->attr->num_index << endl
-          << "  ref2->attr->index[0].size:" << ( ref2->attr->num_index >= 1 ? ref2->attr->index[0].size : 0 ) << endl
-          << "  publish:" << publish << endl
-          << "  subscribe:" << subscribe << endl
-          << "  locally_owned:" << locally_owned << endl
-          << "  byteswap:" << ( is_byteswap() ? "Yes" : "No" ) << endl
-          << "  buffer_capacity:" << buffer_capacity << endl
-          << "  size_is_static:" << ( size_is_static ? "Yes" : "No" ) << endl
-          << "  rti_encoding:" << rti_encoding << endl;
-      if ( ( ref2->attr->type == TRICK_STRING )
-           || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
-                && ( ref2->attr->num_index > 0 )
-                && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
-         msg << "  value:\"" << ( *(char **)ref2->address ) << "\"" << endl;
-      }
-      send_hs( stdout, (char *)msg.str().c_str() );
+      print_state( "calculate_size_and_number_of_items", __LINE__, "========================================================" );
    }
 
    return;
@@ -1027,48 +1232,16 @@ void Attribute::calculate_static_number_of_items()
 void Attribute::pack_attribute_buffer()
 {
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      ostringstream msg;
-      msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-          << "================== BEFORE PACK ==================================" << endl
-          << "  FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-          << "  trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-          << "  ref2->attr->name:'" << ref2->attr->name << "'" << endl
-          << "  ref2->attr->type_name:'" << ref2->attr->type_name << "'" << endl
-          << "  ref2->attr->type:" << ref2->attr->type << endl
-          << "  ref2->attr->units:" << ref2->attr->units << endl
-          << "  size:" << size << endl
-          << "  num_items:" << num_items << endl
-          // TODO: Figure out get_size_from_attributes() API in Trick 10.
-          //   << "  get_size_from_attributes():" << get_size_from_attributes(ref2->attr, ref2->attr->name) << endl
-          << "  ref2->attr->size:" << ref2->attr->size << endl
-          << "  ref2->attr->num_index:" << ref2->attr->num_index << endl
-          << "  ref2->attr->index[0].size:" << ( ref2->attr->num_index >= 1 ? ref2->attr->index[0].size : 0 ) << endl
-          << "  publish:" << publish << endl
-          << "  subscribe:" << subscribe << endl
-          << "  locally_owned:" << locally_owned << endl
-          << "  byteswap:" << ( is_byteswap() ? "Yes" : "No" ) << endl
-          << "  buffer_capacity:" << buffer_capacity << endl
-          << "  size_is_static:" << ( size_is_static ? "Yes" : "No" ) << endl
-          << "  rti_encoding:" << rti_encoding << endl;
-      if ( ( ref2->attr->type == TRICK_STRING )
-           || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
-                && ( ref2->attr->num_index > 0 )
-                && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
-         msg << "  value:\"" << ( *(char **)ref2->address ) << "\"" << endl;
-      }
-      send_hs( stdout, (char *)msg.str().c_str() );
+      print_state( "pack_attribute_buffer", __LINE__, "================== BEFORE PACK ==================================" );
    }
 
    // Don't pack the buffer if the attribute is not locally owned. Otherwise this will
    // corrupt the buffer for the data we received for this attribute from another federate.
    if ( !is_locally_owned() ) {
       if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-         ostringstream msg;
-         msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-             << " FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-             << " trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-             << " Skipping pack because attribute is not locally owned!" << endl;
-         send_hs( stdout, (char *)msg.str().c_str() );
+         THLA_LOG( stdout, "Attribute::pack_attribute_buffer():%d%c FOM_name:'%s'%c trick_name:'%s'%c Skipping pack because attribute is not locally owned!%c",
+                   __LINE__, THLA_NEWLINE, ( ( FOM_name != NULL ) ? FOM_name : "NULL" ), THLA_NEWLINE,
+                   ( ( trick_name != NULL ) ? trick_name : "NULL" ), THLA_NEWLINE, THLA_NEWLINE );
       }
       return;
    }
@@ -1098,12 +1271,8 @@ void Attribute::pack_attribute_buffer()
          encode_boolean_to_buffer();
 
          if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-            ostringstream msg;
-            msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-                << "================== ATTRIBUTE ENCODE ==================================" << endl
-                << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                << "')" << endl;
-            send_hs( stdout, (char *)msg.str().c_str() );
+            THLA_LOG( stdout, "Attribute::pack_attribute_buffer():%d%c================== ATTRIBUTE ENCODE ==================================%c attribute '%s' (trick name '%s')%c",
+                      __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
             print_buffer();
          }
          break;
@@ -1119,12 +1288,8 @@ void Attribute::pack_attribute_buffer()
          encode_opaque_data_to_buffer();
 
          if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-            ostringstream msg;
-            msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-                << "================== ATTRIBUTE ENCODE ==================================" << endl
-                << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                << "')" << endl;
-            send_hs( stdout, (char *)msg.str().c_str() );
+            THLA_LOG( stdout, "Attribute::pack_attribute_buffer():%d%c================== ATTRIBUTE ENCODE ==================================%c attribute '%s' (trick name '%s')%c",
+                      __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
             print_buffer();
          }
          break;
@@ -1135,22 +1300,13 @@ void Attribute::pack_attribute_buffer()
               || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
                    && ( ref2->attr->num_index > 0 )
                    && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
-            // NOTE: For now we must calculate size every time because on a
-            // receive, the 'size' is adjusted to the number of bytes received
-            // and does not reflect what we are sending. We only have this
-            // problem for variable length types such as strings which is the
-            // only variable length type we support right now. DDexter
-            calculate_size_and_number_of_items();
-
-            encode_string_to_buffer();
+            // Reuses the previously encoded buffer if the strings have not
+            // changed, otherwise the size is calculated and they are encoded.
+            encode_string_to_buffer_if_changed();
 
             if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-               ostringstream msg;
-               msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-                   << "================== ATTRIBUTE ENCODE ==================================" << endl
-                   << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                   << "')" << endl;
-               send_hs( stdout, (char *)msg.str().c_str() );
+               THLA_LOG( stdout, "Attribute::pack_attribute_buffer():%d%c================== ATTRIBUTE ENCODE ==================================%c attribute '%s' (trick name '%s')%c",
+                         __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
                print_buffer();
             }
          } else {
@@ -1186,12 +1342,8 @@ void Attribute::pack_attribute_buffer()
             }
 
             if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-               ostringstream msg;
-               msg << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-                   << "================== ATTRIBUTE ENCODE ==================================" << endl
-                   << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                   << "')" << endl;
-               send_hs( stdout, (char *)msg.str().c_str() );
+               THLA_LOG( stdout, "Attribute::pack_attribute_buffer():%d%c================== ATTRIBUTE ENCODE ==================================%c attribute '%s' (trick name '%s')%c",
+                         __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
                print_buffer();
             }
          }
@@ -1200,37 +1352,12 @@ void Attribute::pack_attribute_buffer()
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      ostringstream msg2;
-      msg2 << "Attribute::pack_attribute_buffer():" << __LINE__ << endl
-           << "================== AFTER PACK ==================================" << endl
-           << "  FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-           << "  trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-           << "  ref2->attr->name:'" << ref2->attr->name << "'" << endl
-           << "  ref2->attr->type_name:'" << ref2->attr->type_name << "'" << endl
-           << "  ref2->attr->type:" << ref2->attr->type << endl
-           << "  ref2->attr->units:" << ref2->attr->units << endl
-           << "  size:" << size << endl
-           << "  num_items:" << num_items << endl
-           // TODO: Figure out get_size_from_attributes() API in Trick 10.
-           //    << "  get_size_from_attributes():" << get_size_from_attributes(ref2->attr, ref2->attr->name) << endl
-           << "  ref2->attr->size:" << ref2->attr->size << endl
-           << "  ref2->attr->num_index:" << ref2->attr->num_index << endl
-           << "  ref2->attr->index[0].size:" << ( ref2->attr->num_index >= 1 ? ref2->attr->index[0].size : 0 ) << endl
-           << "  publish:" << publish << endl
-           << "  subscribe:" << subscribe << endl
-           << "  locally_owned:" << locally_owned << endl
-           << "  byteswap:" << ( is_byteswap() ? "Yes" : "No" ) << endl
-           << "  buffer_capacity:" << buffer_capacity << endl
-           << "  size_is_static:" << ( size_is_static ? "Yes" : "No" ) << endl
-           << "  rti_encoding:" << rti_encoding << endl;
-      if ( ( ref2->attr->type == TRICK_STRING )
-           || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
-                && ( ref2->attr->num_index > 0 )
-                && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
-         msg2 << "  value:\"" << ( *(char **)ref2->address ) << "\"" << endl;
-      }
-      send_hs( stdout, (char *)msg2.str().c_str() );
+      print_state( "pack_attribute_buffer", __LINE__, "================== AFTER PACK ==================================" );
    }
+
+   // The packed value is published as the front buffer by swap_buffers()
+   // once all the packs of the frame are done.
+   back_packed = true;
 }
 
 void Attribute::unpack_attribute_buffer()
@@ -1239,12 +1366,9 @@ void Attribute::unpack_attribute_buffer()
    // means we did not receive data from another federate for this attribute.
    if ( is_locally_owned() ) {
       if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-         ostringstream msg;
-         msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-             << " FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-             << " trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-             << " Skipping unpack of attribute buffer because the attribute is locally owned." << endl;
-         send_hs( stdout, (char *)msg.str().c_str() );
+         THLA_LOG( stdout, "Attribute::unpack_attribute_buffer():%d%c FOM_name:'%s'%c trick_name:'%s'%c Skipping unpack of attribute buffer because the attribute is locally owned.%c",
+                   __LINE__, THLA_NEWLINE, ( ( FOM_name != NULL ) ? FOM_name : "NULL" ), THLA_NEWLINE,
+                   ( ( trick_name != NULL ) ? trick_name : "NULL" ), THLA_NEWLINE, THLA_NEWLINE );
       }
       return;
    }
@@ -1270,12 +1394,8 @@ void Attribute::unpack_attribute_buffer()
          decode_boolean_from_buffer();
 
          if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-            ostringstream msg;
-            msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-                << "================== ATTRIBUTE DECODE ==================================" << endl
-                << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                << "')" << endl;
-            send_hs( stdout, (char *)msg.str().c_str() );
+            THLA_LOG( stdout, "Attribute::unpack_attribute_buffer():%d%c================== ATTRIBUTE DECODE ==================================%c attribute '%s' (trick name '%s')%c",
+                      __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
             print_buffer();
          }
          break;
@@ -1289,12 +1409,8 @@ void Attribute::unpack_attribute_buffer()
          decode_opaque_data_from_buffer();
 
          if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-            ostringstream msg;
-            msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-                << "================== ATTRIBUTE DECODE =============================" << endl
-                << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                << "')" << endl;
-            send_hs( stdout, (char *)msg.str().c_str() );
+            THLA_LOG( stdout, "Attribute::unpack_attribute_buffer():%d%c================== ATTRIBUTE DECODE =============================%c attribute '%s' (trick name '%s')%c",
+                      __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
             print_buffer();
          }
          break;
@@ -1317,12 +1433,9 @@ void Attribute::unpack_attribute_buffer()
             decode_string_from_buffer();
 
             if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-               ostringstream msg;
-               msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-                   << "================== ATTRIBUTE DECODE ==================================" << endl
-                   << " attribute '" << FOM_name << "' (trick name '" << trick_name << "')"
-                   << " value:\"" << ( *(char **)ref2->address ) << "\"" << endl;
-               send_hs( stdout, (char *)msg.str().c_str() );
+               THLA_LOG( stdout, "Attribute::unpack_attribute_buffer():%d%c================== ATTRIBUTE DECODE ==================================%c attribute '%s' (trick name '%s') value:\"%s\"%c",
+                         __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name,
+                         *(char **)ref2->address, THLA_NEWLINE );
                print_buffer();
             }
 
@@ -1354,12 +1467,8 @@ void Attribute::unpack_attribute_buffer()
                                      size );
 
                if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-                  ostringstream msg;
-                  msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-                      << "================== ATTRIBUTE DECODE ==================================" << endl
-                      << " attribute '" << FOM_name << "' (trick name '" << trick_name
-                      << "')" << endl;
-                  send_hs( stdout, (char *)msg.str().c_str() );
+                  THLA_LOG( stdout, "Attribute::unpack_attribute_buffer():%d%c================== ATTRIBUTE DECODE ==================================%c attribute '%s' (trick name '%s')%c",
+                            __LINE__, THLA_NEWLINE, THLA_NEWLINE, FOM_name, trick_name, THLA_NEWLINE );
                   print_buffer();
                }
             }
@@ -1369,36 +1478,7 @@ void Attribute::unpack_attribute_buffer()
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_10_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      ostringstream msg;
-      msg << "Attribute::unpack_attribute_buffer():" << __LINE__ << endl
-          << "========================================================" << endl
-          << "  FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << endl
-          << "  trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << endl
-          << "  ref2->attr->name:'" << ref2->attr->name << "'" << endl
-          << "  ref2->attr->type_name:'" << ref2->attr->type_name << "'" << endl
-          << "  ref2->attr->type:" << ref2->attr->type << endl
-          << "  ref2->attr->units:" << ref2->attr->units << endl
-          << "  size:" << size << endl
-          << "  num_items:" << num_items << endl
-          // TODO: Figure out get_size_from_attributes() API in Trick 10.
-          //   << "  get_size_from_attributes():" << get_size_from_attributes(ref2->attr, ref2->attr->name) << endl
-          << "  ref2->attr->size:" << ref2->attr->size << endl
-          << "  ref2->attr->num_index:" << ref2->attr->num_index << endl
-          << "  ref2->attr->index[0].size:" << ( ref2->attr->num_index >= 1 ? ref2->attr->index[0].size : 0 ) << endl
-          << "  publish:" << publish << endl
-          << "  subscribe:" << subscribe << endl
-          << "  locally_owned:" << locally_owned << endl
-          << "  byteswap:" << ( is_byteswap() ? "Yes" : "No" ) << endl
-          << "  buffer_capacity:" << buffer_capacity << endl
-          << "  size_is_static:" << ( size_is_static ? "Yes" : "No" ) << endl
-          << "  rti_encoding:" << rti_encoding << endl;
-      if ( ( ref2->attr->type == TRICK_STRING )
-           || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
-                && ( ref2->attr->num_index > 0 )
-                && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) ) ) {
-         msg << "  value:\"" << ( *(char **)ref2->address ) << "\"" << endl;
-      }
-      send_hs( stdout, (char *)msg.str().c_str() );
+      print_state( "unpack_attribute_buffer", __LINE__, "========================================================" );
    }
 }
 
@@ -1805,6 +1885,102 @@ size %d, will use the data buffer size instead.%c",
    }
 }
 
+/*!
+ * @details Strings such as names, types, and status rarely change, so the
+ * encoded bytes are kept in the buffer along with a copy of the strings they
+ * were encoded from. Each string is compared to the copy, length first, in
+ * the same pass that takes the place of the strlen() pass in
+ * calculate_size_and_number_of_items(). If all the strings match, the buffer
+ * is sent as is without encoding the strings again.
+ */
+void Attribute::encode_string_to_buffer_if_changed()
+{
+   switch ( rti_encoding ) {
+      case ENCODING_UNICODE_STRING:
+      case ENCODING_ASCII_STRING:
+      case ENCODING_C_STRING: {
+         calculate_static_number_of_items();
+
+         // The copy holds each string followed by its null character, so
+         // the string boundaries are part of the comparison. A NULL string
+         // is encoded the same as an empty one.
+         bool   unchanged    = ( string_cache_encoding == rti_encoding )
+                               && ( string_cache_items == num_items );
+         size_t offset       = 0;
+         size_t total_length = 0;
+         for ( size_t i = 0; i < num_items; ++i ) {
+            char const  *s      = *( (char **)ref2->address + i );
+            size_t const length = ( s != NULL ) ? strlen( s ) : 0;
+
+            if ( unchanged ) {
+               unchanged = ( ( offset + length ) < string_cache_data.size() )
+                           && ( string_cache_data[offset + length] == '\0' )
+                           && ( ( length == 0 )
+                                || ( memcmp( string_cache_data.data() + offset, s, length ) == 0 ) );
+            }
+            offset += length + 1;
+            total_length += length;
+         }
+         unchanged = unchanged && ( offset == string_cache_data.size() );
+
+         // Each buffer slot is encoded once for the same strings.
+         unsigned long long const back_slot_bit = ( 1ULL << back_slot );
+
+         if ( unchanged && ( ( string_cache_slots & back_slot_bit ) != 0 ) ) {
+
+            // The buffer already holds the encoded strings.
+            size = string_cache_size;
+
+            if ( DebugHandler::show( DEBUG_LEVEL_11_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+               ostringstream msg;
+               msg << "Attribute::encode_string_to_buffer_if_changed():" << __LINE__
+                   << " Reusing encoded strings for attribute '" << FOM_name
+                   << "' (trick name '" << trick_name << "')" << endl;
+               send_hs( stdout, (char *)msg.str().c_str() );
+            }
+         } else {
+            // Total number of characters, which is what
+            // calculate_size_and_number_of_items() would have determined.
+            size = total_length;
+
+            encode_string_to_buffer();
+
+            if ( unchanged ) {
+               // The other slots already hold these strings.
+               string_cache_slots |= back_slot_bit;
+            } else {
+               // Keep a copy of the strings to compare against next time,
+               // which reuses the memory of the copy unless the strings grew.
+               string_cache_data.clear();
+               for ( size_t i = 0; i < num_items; ++i ) {
+                  char const *s = *( (char **)ref2->address + i );
+                  if ( s != NULL ) {
+                     string_cache_data.append( s );
+                  }
+                  string_cache_data.push_back( '\0' );
+               }
+               string_cache_slots = back_slot_bit;
+            }
+            string_cache_encoding = rti_encoding;
+            string_cache_items    = num_items;
+            string_cache_size     = size;
+         }
+         break;
+      }
+      default: {
+         // NOTE: For now we must calculate size every time because on a
+         // receive, the 'size' is adjusted to the number of bytes received
+         // and does not reflect what we are sending. We only have this
+         // problem for variable length types such as strings which is the
+         // only variable length type we support right now. DDexter
+         calculate_size_and_number_of_items();
+
+         encode_string_to_buffer();
+         break;
+      }
+   }
+}
+
 void Attribute::encode_string_to_buffer() // RETURN: -- None.
 {
    unsigned char *output;       // Cast the buffer to be a character array.
@@ -1856,10 +2032,8 @@ void Attribute::encode_string_to_buffer() // RETURN: -- None.
                size_t length = strlen( s );
 
                // Encode as UTF-16 characters in Big Endian
-               for ( size_t k = 0; k < length; ++k ) {
-                  *( output++ ) = '\0';
-                  *( output++ ) = (unsigned char)*( s++ );
-               }
+               Utilities::widen_ascii_to_utf16be( output, (unsigned char *)s, length );
+               output += 2 * length;
                byte_count += 2 * length;
             }
 
@@ -1937,10 +2111,8 @@ void Attribute::encode_string_to_buffer() // RETURN: -- None.
 
                if ( s != NULL ) {
                   // Encode as UTF-16 characters in Big Endian
-                  for ( size_t k = 0; k < length; ++k ) {
-                     *( output++ ) = '\0';
-                     *( output++ ) = (unsigned char)*( s++ );
-                  }
+                  Utilities::widen_ascii_to_utf16be( output, (unsigned char *)s, length );
+                  output += 2 * length;
                   byte_count += (size_t)( 2 * length );
                }
 
@@ -2419,35 +2591,9 @@ size %d, will use the data buffer size instead.%c",
             }
 
             // UTF-16 character encoding of the string.
-            output = *( (unsigned char **)ref2->address );
-
-            if ( output != NULL ) {
-
-               // TODO: If the users Trick simulation variable is static in size
-               // should we be reallocating memory for it below?
-
-               // Determine if we need to allocate more memory for the sim string.
-               // If it is larger than the existing string and larger than the
-               // memory allocated for the string then reallocate more memory.
-               if ( (int)length >= get_size( (char *)output ) ) {
-
-                  // Make sure to make room for the terminating null character,
-                  // and add a few more bytes to give us a little more space
-                  // for next time.
-                  int array_size              = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)ref2->address ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address ), array_size );
-
-                  output = *( (unsigned char **)ref2->address );
-               }
-            } else {
-               // Allocate memory for the sim string and include room for the
-               // terminating null character and add a few more bytes to give
-               // us a little more space for next time.
-               int array_size              = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)ref2->address ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-               output = *( (unsigned char **)ref2->address );
-            }
+            // Reuse the memory for the sim string if it can hold the string and
+            // the terminating null character, otherwise grow it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)ref2->address, 0, length + 1 );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2460,10 +2606,8 @@ size %d, will use the data buffer size instead.%c",
             } else {
 
                // Decode the UTF-16 characters.
-               for ( size_t k = 0; k < length; ++k ) {
-                  input++; // skip the high-character of the UTF-16 encoding
-                  output[k] = *( input++ );
-               }
+               Utilities::narrow_utf16be_to_ascii( output, input, length );
+               input += 2 * length;
 
                // Add the terminating null character '\0';
                output[length] = '\0';
@@ -2567,32 +2711,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // UTF-16 character encoding of the string.
-               output = *( (unsigned char **)ref2->address + i );
-
-               if ( output != NULL ) {
-
-                  // Determine if we need to allocate more memory for the sim string.
-                  // If it is larger than the existing string and larger than the
-                  // memory allocated for the string then reallocate more memory.
-                  if ( (int)length >= get_size( (char *)output ) ) {
-
-                     // Make sure to make room for the terminating null character,
-                     // and add a few more bytes to give us a little more space
-                     // for next time.
-                     int array_size                  = Utilities::next_positive_multiple_of_8( length );
-                     *( (char **)ref2->address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address + i ), array_size );
-
-                     output = *( (unsigned char **)ref2->address + i );
-                  }
-               } else {
-                  // Allocate memory for the sim string and include room for the
-                  // terminating null character and add a few more bytes to give
-                  // us a little more space for next time.
-                  int array_size                  = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)ref2->address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-                  output = *( (unsigned char **)ref2->address + i );
-               }
+               // Reuse the memory for the sim string if it can hold the string and
+               // the terminating null character, otherwise grow it geometrically.
+               output = (unsigned char *)string_storage.get_string( (char **)ref2->address, i, length + 1 );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -2606,10 +2727,8 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                } else {
 
                   // Decode the UTF-16 characters.
-                  for ( size_t k = 0; k < length; ++k ) {
-                     input++; // skip the high-character of the UTF-16 encoding
-                     output[k] = *( input++ );
-                  }
+                  Utilities::narrow_utf16be_to_ascii( output, input, length );
+                  input += 2 * length;
 
                   // Add the terminating null character '\0';
                   output[length] = '\0';
@@ -2684,32 +2803,9 @@ WARNING: For ENCODING_TYPE_ASCII_STRING attribute '%s', decoded length %d > data
             }
 
             // ASCII character encoding of the string.
-            output = *( (unsigned char **)ref2->address );
-
-            if ( output != NULL ) {
-
-               // Determine if we need to allocate more memory for the sim string.
-               // If it is larger than the existing string and larger than the
-               // memory allocated for the string then reallocate more memory.
-               if ( (int)length >= get_size( (char *)output ) ) {
-
-                  // Make sure to make room for the terminating null character,
-                  // and add a few more bytes to give us a little more space
-                  // for next time.
-                  int array_size              = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)ref2->address ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address ), array_size );
-
-                  output = *( (unsigned char **)ref2->address );
-               }
-            } else {
-               // Allocate memory for the sim string and include room for the
-               // terminating null character and add a few more bytes to give
-               // us a little more space for next time.
-               int array_size              = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)ref2->address ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-               output = *( (unsigned char **)ref2->address );
-            }
+            // Reuse the memory for the sim string if it can hold the string and
+            // the terminating null character, otherwise grow it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)ref2->address, 0, length + 1 );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2723,7 +2819,7 @@ WARNING: For ENCODING_TYPE_ASCII_STRING attribute '%s', decoded length %d > data
 
                // Copy the ASCII characters over.
                if ( length > 0 ) {
-                  memcpy( output, input, (size_t)length );
+                  StringStorage::copy_if_changed( output, input, (size_t)length );
                }
 
                // Add the terminating null character '\0';
@@ -2819,32 +2915,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // ASCII character encoding of the string.
-               output = *( (unsigned char **)ref2->address + i );
-
-               if ( output != NULL ) {
-
-                  // Determine if we need to allocate more memory for the sim string.
-                  // If it is larger than the existing string and larger than the
-                  // memory allocated for the string then reallocate more memory.
-                  if ( (int)length >= get_size( (char *)output ) ) {
-
-                     // Make sure to make room for the terminating null character,
-                     // and add a few more bytes to give us a little more space
-                     // for next time.
-                     int array_size                  = Utilities::next_positive_multiple_of_8( length );
-                     *( (char **)ref2->address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address + i ), array_size );
-
-                     output = *( (unsigned char **)ref2->address + i );
-                  }
-               } else {
-                  // Allocate memory for the sim string and include room for the
-                  // terminating null character and add a few more bytes to give
-                  // us a little more space for next time.
-                  int array_size                  = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)ref2->address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-                  output = *( (unsigned char **)ref2->address + i );
-               }
+               // Reuse the memory for the sim string if it can hold the string and
+               // the terminating null character, otherwise grow it geometrically.
+               output = (unsigned char *)string_storage.get_string( (char **)ref2->address, i, length + 1 );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -2859,7 +2932,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
                   // Copy the ASCII characters over.
                   if ( length > 0 ) {
-                     memcpy( output, input, length );
+                     StringStorage::copy_if_changed( output, input, (size_t)length );
                      input += length;
                   }
 
@@ -2934,29 +3007,9 @@ WARNING: For ENCODING_TYPE_OPAQUE_DATA attribute '%s', decoded length %d > data
             }
 
             // Get a pointer to the output.
-            output = *( (unsigned char **)ref2->address );
-
-            if ( output != NULL ) {
-               // The output array size must exactly match the incoming data
-               // size for opaque data.
-               if ( (int)length != get_size( (char *)output ) ) {
-                  // WORKAROUND: Trick 10 can't handle a length of zero so to
-                  // workaround the memory manager problem use a size of 1 in
-                  // the allocation.
-                  *( (char **)ref2->address ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address ),
-                                                                               (int)( ( length > 0 ) ? length : 1 ) );
-
-                  output = *( (unsigned char **)ref2->address );
-               }
-            } else {
-               // Allocate memory for the output array.
-               // WORKAROUND: Trick 10 can't handle a length of zero so to
-               // workaround the memory manager problem use a size of 1 in
-               // the allocation.
-               *( (char **)ref2->address ) = (char *)TMM_declare_var_1d( "char", (int)( ( length > 0 ) ? length : 1 ) );
-
-               output = *( (unsigned char **)ref2->address );
-            }
+            // The output array size must exactly match the incoming data
+            // size for opaque data.
+            output = (unsigned char *)string_storage.get_exact( (char **)ref2->address, 0, length );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2969,7 +3022,7 @@ WARNING: For ENCODING_TYPE_OPAQUE_DATA attribute '%s', decoded length %d > data
 
             // Copy the characters over.
             if ( length > 0 ) {
-               memcpy( output, input, length );
+               StringStorage::copy_if_changed( output, input, (size_t)length );
             }
 
          } else if ( num_items > 1 ) {
@@ -3063,29 +3116,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // 8-bit characters
-               output = *( (unsigned char **)ref2->address + i );
-
-               if ( output != NULL ) {
-                  // The output array size must exactly match the incoming data
-                  // size for opaque data.
-                  if ( (int)length != get_size( (char *)output ) ) {
-                     // WORKAROUND: Trick 10 can't handle a length of zero so to
-                     // workaround the memory manager problem use a size of 1 in
-                     // the allocation.
-                     *( (char **)ref2->address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address + i ),
-                                                                                      (int)( ( length > 0 ) ? length : 1 ) );
-
-                     output = *( (unsigned char **)ref2->address + i );
-                  }
-               } else {
-                  // Allocate memory for the output array.
-                  // WORKAROUND: Trick 10 can't handle a length of zero so to
-                  // workaround the memory manager problem use a size of 1 in
-                  // the allocation.
-                  *( (char **)ref2->address + i ) = (char *)TMM_declare_var_1d( "char", (int)( ( length > 0 ) ? length : 1 ) );
-
-                  output = *( (unsigned char **)ref2->address + i );
-               }
+               // The output array size must exactly match the incoming data
+               // size for opaque data.
+               output = (unsigned char *)string_storage.get_exact( (char **)ref2->address, i, length );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -3098,7 +3131,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
                // Copy the characters over.
                if ( length > 0 ) {
-                  memcpy( output, input, length );
+                  StringStorage::copy_if_changed( output, input, (size_t)length );
                   input += length;
                }
 
@@ -3169,26 +3202,10 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
             int length = ( end_index - start_index ) + 1;
 
-            output = *( (unsigned char **)ref2->address + i );
-
-            if ( output != NULL ) {
-
-               // Determine if we need to allocate more memory for the sim string.
-               // TODO: Find a more efficient way to determine if we need to
-               // reallocate memory for the string.
-               if ( length >= get_size( (char *)output ) ) {
-                  int array_size                  = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)ref2->address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)ref2->address + i ), array_size );
-
-                  output = *( (unsigned char **)ref2->address + i );
-               }
-            } else {
-               // Allocate memory for the sim string.
-               int array_size                  = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)ref2->address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-               output = *( (unsigned char **)ref2->address + i );
-            }
+            // Reuse the memory for the sim string if it can hold the string,
+            // which includes the terminating null character, otherwise grow
+            // it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)ref2->address, i, (size_t)length );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -3200,7 +3217,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                DebugHandler::terminate_with_message( errmsg.str() );
             } else {
 
-               memcpy( output, ( input + start_index ), (size_t)length );
+               StringStorage::copy_if_changed( output, ( input + start_index ), (size_t)length );
 
                // Move to the next encoded string in the input.
                end_index++;
@@ -3477,6 +3494,46 @@ bool Attribute::is_supported_attribute_type() const // RETURN: -- True if suppor
    return false; // If we made it to here then the type is not supported.
 }
 
+/*!
+ * @details The string value is only shown for the string types.
+ */
+void Attribute::print_state(
+   char const *function,
+   int const   line,
+   char const *banner ) const
+{
+   bool const is_string = ( ref2->attr->type == TRICK_STRING )
+                          || ( ( ( ref2->attr->type == TRICK_CHARACTER ) || ( ref2->attr->type == TRICK_UNSIGNED_CHARACTER ) )
+                               && ( ref2->attr->num_index > 0 )
+                               && ( ref2->attr->index[ref2->attr->num_index - 1].size == 0 ) );
+
+   ostringstream msg;
+   msg << "Attribute::" << function << "():" << line << THLA_NEWLINE
+       << banner << THLA_NEWLINE
+       << "  FOM_name:'" << ( ( FOM_name != NULL ) ? FOM_name : "NULL" ) << "'" << THLA_NEWLINE
+       << "  trick_name:'" << ( ( trick_name != NULL ) ? trick_name : "NULL" ) << "'" << THLA_NEWLINE
+       << "  ref2->attr->name:'" << ref2->attr->name << "'" << THLA_NEWLINE
+       << "  ref2->attr->type_name:'" << ref2->attr->type_name << "'" << THLA_NEWLINE
+       << "  ref2->attr->type:" << ref2->attr->type << THLA_NEWLINE
+       << "  ref2->attr->units:" << ref2->attr->units << THLA_NEWLINE
+       << "  size:" << size << THLA_NEWLINE
+       << "  num_items:" << num_items << THLA_NEWLINE
+       << "  ref2->attr->size:" << ref2->attr->size << THLA_NEWLINE
+       << "  ref2->attr->num_index:" << ref2->attr->num_index << THLA_NEWLINE
+       << "  ref2->attr->index[0].size:" << ( ref2->attr->num_index >= 1 ? ref2->attr->index[0].size : 0 ) << THLA_NEWLINE
+       << "  publish:" << publish << THLA_NEWLINE
+       << "  subscribe:" << subscribe << THLA_NEWLINE
+       << "  locally_owned:" << locally_owned << THLA_NEWLINE
+       << "  byteswap:" << ( is_byteswap() ? "Yes" : "No" ) << THLA_NEWLINE
+       << "  buffer_capacity:" << buffer_capacity << THLA_NEWLINE
+       << "  size_is_static:" << ( size_is_static ? "Yes" : "No" ) << THLA_NEWLINE
+       << "  rti_encoding:" << rti_encoding << THLA_NEWLINE;
+   if ( is_string ) {
+      msg << "  value:\"" << ( *(char **)ref2->address ) << "\"" << THLA_NEWLINE;
+   }
+   THLA_LOG( stdout, "%s", msg.str().c_str() );
+}
+
 void Attribute::print_buffer() const
 {
    ostringstream msg;
@@ -3523,5 +3580,5 @@ void Attribute::print_buffer() const
          msg << endl;
       }
    }
-   send_hs( stdout, (char *)msg.str().c_str() );
+   THLA_LOG( stdout, "%s", msg.str().c_str() );
 }
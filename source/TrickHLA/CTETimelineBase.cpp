@@ -29,11 +29,13 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{Timeline.cpp}
 @trick_link_dependency{CTETimelineBase.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, June 2016, --, Initial version.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
 @revs_end
 
 */
@@ -44,6 +46,7 @@ NASA, Johnson Space Center\n
 
 // TrickHLA include files.
 #include "TrickHLA/CTETimelineBase.hh"
+#include "TrickHLA/TSCTimeline.hh"
 
 using namespace Trick;
 using namespace TrickHLA;
@@ -76,13 +79,12 @@ int CTETimelineBase::clock_init()
 }
 
 /*!
- * @details Get the global time base on the CTE.
+ * @details Get the global time base on the CTE, which is the system real time
+ * read through the TSCTimeline.
  */
 double CTETimelineBase::get_time()
 {
-   struct timespec ts;
-   clock_gettime( CLOCK_REALTIME, &ts );
-   return ( (double)ts.tv_sec + ( (double)ts.tv_nsec * 0.000000001 ) );
+   return TSCTimeline::get_realtime_in_seconds();
 }
 
 /*!
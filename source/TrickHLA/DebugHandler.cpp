@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Tony Varesic, L3 Titan Group, IMSim, Jan 2010, --, Initial version.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, July 2020, --, Rewrite to use static data and functions.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Limit the debug level to the compile time maximum.}
 @revs_end
 
 */
@@ -36,6 +37,7 @@ NASA, Johnson Space Center\n
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Types.hh"
 
@@ -62,13 +64,6 @@ DebugHandler::~DebugHandler() // RETURN: -- None.
    return;
 }
 
-bool const DebugHandler::show(
-   DebugLevelEnum const  level,
-   DebugSourceEnum const code )
-{
-   return ( ( debug_level >= level ) && ( ( code_section & code ) != 0 ) );
-}
-
 void DebugHandler::set(
    DebugLevelEnum const  level,
    DebugSourceEnum const code )
@@ -80,6 +75,13 @@ void DebugHandler::set(
    } else {
       debug_level = level;
    }
+   if ( debug_level > THLA_MAX_DEBUG_LEVEL ) {
+      send_hs( stderr, "DebugHandler::set():%d WARNING: Debug level %d is above \
+the THLA_MAX_DEBUG_LEVEL of %d built into TrickHLA, using %d instead.%c",
+               __LINE__, (int)debug_level, THLA_MAX_DEBUG_LEVEL,
+               THLA_MAX_DEBUG_LEVEL, THLA_NEWLINE );
+      debug_level = (DebugLevelEnum)THLA_MAX_DEBUG_LEVEL;
+   }
    if ( code < DEBUG_SOURCE_NO_MODULES ) {
       code_section = DEBUG_SOURCE_NO_MODULES;
    } else if ( code > DEBUG_SOURCE_ALL_MODULES ) {
@@ -17,10 +17,12 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{ElapsedTimeStats.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, Sept 2020, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
 @revs_end
 
 */
@@ -31,11 +33,9 @@ NASA, Johnson Space Center\n
 #include <sstream>
 #include <string>
 
-// Trick include files.
-#include "trick/clock_proto.h"
-
 // TrickHLA include files.
 #include "TrickHLA/ElapsedTimeStats.hh"
+#include "TrickHLA/TSCTimeline.hh"
 
 using namespace std;
 using namespace TrickHLA;
@@ -69,7 +69,7 @@ ElapsedTimeStats::~ElapsedTimeStats()
  */
 void ElapsedTimeStats::measure()
 {
-   int64_t time = clock_wall_time(); // in microseconds
+   int64_t time = TSCTimeline::get_time_in_micros(); // in microseconds
    if ( first_pass ) {
       first_pass = false;
    } else {
@@ -0,0 +1,125 @@
+/*!
+@file TrickHLA/EventCount.cpp
+@ingroup TrickHLA
+@brief An event count lets a thread wait for a condition that other threads
+change with lock-free atomic stores.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{EventCount.cpp}
+@trick_link_dependency{MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <pthread.h>
+#include <time.h>
+
+// TrickHLA include files.
+#include "TrickHLA/EventCount.hh"
+#include "TrickHLA/MutexLock.hh"
+
+using namespace TrickHLA;
+
+/*!
+ * @details The condition variable uses the monotonic clock so the timeouts
+ * are not affected by changes to the system time.
+ * @job_class{initialization}
+ */
+EventCount::EventCount()
+   : mutex(),
+     sequence( 0 ),
+     waiters( 0 ),
+     block_count( 0 )
+{
+   pthread_condattr_t attr;
+   pthread_condattr_init( &attr );
+   pthread_condattr_setclock( &attr, CLOCK_MONOTONIC );
+   pthread_cond_init( &cond, &attr );
+   pthread_condattr_destroy( &attr );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+EventCount::~EventCount()
+{
+   pthread_cond_destroy( &cond );
+}
+
+unsigned int const EventCount::prepare_wait()
+{
+   // Registering before reading the key means a notify that happens after
+   // the key was read will see the waiter and signal the condition.
+   __atomic_add_fetch( &waiters, 1, __ATOMIC_SEQ_CST );
+   return __atomic_load_n( &sequence, __ATOMIC_SEQ_CST );
+}
+
+void EventCount::cancel_wait()
+{
+   __atomic_sub_fetch( &waiters, 1, __ATOMIC_SEQ_CST );
+}
+
+bool const EventCount::wait(
+   unsigned int const key,
+   long const         timeout_micros )
+{
+   struct timespec abs_time;
+   clock_gettime( CLOCK_MONOTONIC, &abs_time );
+   abs_time.tv_sec += timeout_micros / 1000000L;
+   abs_time.tv_nsec += ( timeout_micros % 1000000L ) * 1000L;
+   if ( abs_time.tv_nsec >= 1000000000L ) {
+      abs_time.tv_nsec -= 1000000000L;
+      ++abs_time.tv_sec;
+   }
+
+   bool notified = true;
+
+   mutex.lock();
+   if ( __atomic_load_n( &sequence, __ATOMIC_SEQ_CST ) == key ) {
+      ++block_count;
+      do {
+         if ( pthread_cond_timedwait( &cond, &mutex.mutex, &abs_time ) != 0 ) {
+            notified = ( __atomic_load_n( &sequence, __ATOMIC_SEQ_CST ) != key );
+            break;
+         }
+      } while ( __atomic_load_n( &sequence, __ATOMIC_SEQ_CST ) == key );
+   }
+   mutex.unlock();
+
+   cancel_wait();
+
+   return notified;
+}
+
+void EventCount::notify_all()
+{
+   __atomic_add_fetch( &sequence, 1, __ATOMIC_SEQ_CST );
+
+   // Only make the system call if someone is waiting.
+   if ( __atomic_load_n( &waiters, __ATOMIC_SEQ_CST ) > 0 ) {
+      mutex.lock();
+      pthread_cond_broadcast( &cond );
+      mutex.unlock();
+   }
+}
+
+unsigned long long const EventCount::get_block_count() const
+{
+   return block_count;
+}
@@ -0,0 +1,205 @@
+/*!
+@file TrickHLA/EvokedCallbacks.cpp
+@ingroup TrickHLA
+@brief This class delivers the RTI callbacks on the Trick main thread when the
+federate is connected with the HLA_EVOKED callback model.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{EvokedCallbacks.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/EvokedCallbacks.hh"
+#include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TSCTimeline.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+namespace
+{
+
+// True while the calling thread is inside an evoke call, which means any
+// wait is inside a callback.
+__thread bool in_evoke = false;
+
+// Clears the in_evoke flag even if a callback terminates the simulation with
+// an exception.
+class EvokeScope
+{
+  public:
+   EvokeScope()
+   {
+      in_evoke = true;
+   }
+   ~EvokeScope()
+   {
+      in_evoke = false;
+   }
+};
+
+} // namespace
+
+bool EvokedCallbacks::enabled = false;
+
+RTIambassador *EvokedCallbacks::rti_ambassador = NULL;
+
+pthread_t EvokedCallbacks::evoking_thread;
+
+unsigned long long EvokedCallbacks::wait_count    = 0;
+unsigned long long EvokedCallbacks::deliver_count = 0;
+unsigned long long EvokedCallbacks::overrun_count = 0;
+unsigned long long EvokedCallbacks::error_count   = 0;
+int64_t            EvokedCallbacks::deliver_total = 0;
+int64_t            EvokedCallbacks::deliver_max   = 0;
+
+/*!
+ * @job_class{initialization}
+ */
+void EvokedCallbacks::enable(
+   RTIambassador *rti_amb )
+{
+   if ( rti_amb == NULL ) {
+      return;
+   }
+   rti_ambassador = rti_amb;
+   evoking_thread = pthread_self();
+   __atomic_store_n( &enabled, true, __ATOMIC_RELEASE );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void EvokedCallbacks::disable()
+{
+   __atomic_store_n( &enabled, false, __ATOMIC_RELEASE );
+}
+
+bool const EvokedCallbacks::wait(
+   double const wait_seconds )
+{
+   if ( !is_enabled() || in_evoke || !pthread_equal( pthread_self(), evoking_thread ) ) {
+      return false;
+   }
+
+   bool evoked = true;
+   {
+      EvokeScope evoke_scope;
+
+      // Macro to save the FPU Control Word register value.
+      TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+      try {
+         (void)rti_ambassador->evokeCallback( wait_seconds );
+      } catch ( RTI1516_EXCEPTION const &e ) {
+         record_error( "wait", e.what() );
+         evoked = false;
+      }
+
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+   }
+
+   if ( evoked ) {
+      ++wait_count;
+   }
+   return evoked;
+}
+
+bool const EvokedCallbacks::deliver(
+   double const budget_seconds )
+{
+   if ( !is_enabled() || in_evoke || !pthread_equal( pthread_self(), evoking_thread ) ) {
+      return false;
+   }
+
+   bool          pending = false;
+   int64_t const begin   = TSCTimeline::get_time_in_micros();
+   {
+      EvokeScope evoke_scope;
+
+      // Macro to save the FPU Control Word register value.
+      TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+      try {
+         // With no minimum time the RTI returns as soon as there are no more
+         // callbacks to deliver, or once the budget is used up.
+         pending = rti_ambassador->evokeMultipleCallbacks( 0.0, budget_seconds );
+      } catch ( RTI1516_EXCEPTION const &e ) {
+         record_error( "deliver", e.what() );
+      }
+
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+   }
+   int64_t const elapsed = TSCTimeline::get_time_in_micros() - begin;
+
+   ++deliver_count;
+   deliver_total += elapsed;
+   if ( elapsed > deliver_max ) {
+      deliver_max = elapsed;
+   }
+   if ( pending ) {
+      ++overrun_count;
+   }
+   return pending;
+}
+
+string const EvokedCallbacks::get_summary()
+{
+   ostringstream msg;
+   msg << "Evoked callbacks: " << ( is_enabled() ? "enabled" : "disabled" )
+       << ", frame point deliveries:" << deliver_count
+       << " mean:" << ( ( deliver_count > 0 ) ? ( deliver_total / (int64_t)deliver_count ) : 0 ) << "us"
+       << " max:" << deliver_max << "us"
+       << " over budget:" << overrun_count
+       << ", waits:" << wait_count
+       << ", errors:" << error_count;
+   return msg.str();
+}
+
+void EvokedCallbacks::record_error(
+   char const    *function,
+   wstring const &what )
+{
+   if ( error_count++ == 0 ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, what );
+      send_hs( stderr, "EvokedCallbacks::%s():%d WARNING: Unexpected RTI exception \
+while evoking callbacks, further exceptions are only counted!\nRTI Exception: '%s'%c",
+               function, __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+}
@@ -28,12 +28,16 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AsyncLogger.cpp}
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{EvokedCallbacks.cpp}
 @trick_link_dependency{FedAmb.cpp}
 @trick_link_dependency{Federate.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{Probes.cpp}
+@trick_link_dependency{TraceRecorder.cpp}
 @trick_link_dependency{Types.cpp}
 
 @revs_title
@@ -42,6 +46,12 @@ NASA, Johnson Space Center\n
 @rev_entry{Edwin Z. Crues, Titan Systems Corp., DIS, Feb 2002, --, HLA Ball Sim.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, USDT probes.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Callback traces through the asynchronous logger.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Accept early grants of a Next Message Request.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Time advance stall profiler.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Callback thread configuration.}
 @revs_end
 
 */
@@ -56,19 +66,80 @@ NASA, Johnson Space Center\n
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AsyncLogger.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/EvokedCallbacks.hh"
 #include "TrickHLA/FedAmb.hh"
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/Probes.hh"
+#include "TrickHLA/TraceRecorder.hh"
 #include "TrickHLA/Types.hh"
 
 using namespace std;
 using namespace RTI1516_NAMESPACE;
 using namespace TrickHLA;
 
+namespace
+{
+
+// True once a callback has been seen on the calling thread.
+__thread bool callback_thread_seen = false;
+
+} // namespace
+
+/*!
+ * @brief Fire the reflect_attributes probe and the reflect_attribute probe
+ * for each attribute, which is only called while a tracer is attached.
+ * @param obj_index       Index of the object in the Manager objects array.
+ * @param theObject       Object instance handle.
+ * @param attribute_map   Reflected attribute values.
+ * @param time_in_micros  Logical time of the reflection or -1 for receive order.
+ */
+static inline void fire_reflect_probes(
+   int const                      obj_index,
+   ObjectInstanceHandle const    &theObject,
+   AttributeHandleValueMap const &attribute_map,
+   int64_t const                  time_in_micros )
+{
+   size_t bytes = 0;
+
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attribute_map.begin(); iter != attribute_map.end(); ++iter ) {
+      bytes += iter->second.size();
+      if ( THLA_PROBE_ENABLED( reflect_attribute ) ) {
+         THLA_PROBE3( reflect_attribute, obj_index, (long)iter->first.hash(), iter->second.size() );
+      }
+   }
+   THLA_PROBE5( reflect_attributes, obj_index, (long)theObject.hash(),
+                attribute_map.size(), bytes, time_in_micros );
+}
+
+/*!
+ * @brief Fire the receive_interaction probe, which is only called while a
+ * tracer is attached.
+ * @param theInteraction  Interaction class handle.
+ * @param parameter_map   Received parameter values.
+ * @param time_in_micros  Logical time of the interaction or -1 for receive order.
+ */
+static inline void fire_receive_interaction_probe(
+   InteractionClassHandle const  &theInteraction,
+   ParameterHandleValueMap const &parameter_map,
+   int64_t const                  time_in_micros )
+{
+   size_t bytes = 0;
+
+   ParameterHandleValueMap::const_iterator iter;
+   for ( iter = parameter_map.begin(); iter != parameter_map.end(); ++iter ) {
+      bytes += iter->second.size();
+   }
+   THLA_PROBE4( receive_interaction, (long)theInteraction.hash(),
+                parameter_map.size(), bytes, time_in_micros );
+}
+
 /*!
  * @details In most cases, we would allocate and set default names in the
  * constructor. However, since we want this class to be Input
@@ -150,6 +221,28 @@ void FedAmb::initialize()
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
+/*!
+ * @details Evoked callbacks run on the Trick main thread, which keeps its
+ * Trick configuration.
+ */
+void FedAmb::check_callback_thread()
+{
+   if ( callback_thread_seen ) {
+      return;
+   }
+   callback_thread_seen = true;
+
+   if ( ( federate != NULL ) && !EvokedCallbacks::is_enabled() ) {
+      federate->callback_thread.apply( "THLA_callback" );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
+         send_hs( stdout, "FedAmb::check_callback_thread():%d RTI callback \
+thread %s%c",
+                  __LINE__, federate->callback_thread.get_effective().c_str(), THLA_NEWLINE );
+      }
+   }
+}
+
 ////////////////////////////////////
 // Federation Management Services //
 ////////////////////////////////////
@@ -163,6 +256,8 @@ void FedAmb::initialize()
 void FedAmb::connectionLost(
    wstring const &faultDescription ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    string faultMsg;
    StringUtilities::to_string( faultMsg, faultDescription );
    ostringstream errmsg;
@@ -176,6 +271,8 @@ void FedAmb::connectionLost(
 void FedAmb::reportFederationExecutions(
    RTI1516_NAMESPACE::FederationExecutionInformationVector const &theFederationExecutionInformationList ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::reportFederationExecutions():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -184,11 +281,19 @@ FedAmb::reportFederationExecutions():%d %c",
 void FedAmb::synchronizationPointRegistrationSucceeded(
    wstring const &label ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::synchronizationPointRegistrationSucceeded():%d Label:'%ls'%c",
                __LINE__, label.c_str(), THLA_NEWLINE );
    }
 
+   if ( THLA_PROBE_ENABLED( sync_point_registered ) ) {
+      string label_str;
+      StringUtilities::to_string( label_str, label );
+      THLA_PROBE2( sync_point_registered, label_str.c_str(), 1 );
+   }
+
    federate->sync_point_registration_succeeded( label );
 }
 
@@ -196,11 +301,19 @@ void FedAmb::synchronizationPointRegistrationFailed(
    wstring const                                       &label,
    RTI1516_NAMESPACE::SynchronizationPointFailureReason reason ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::synchronizationPointRegistrationFailed():%d Label:'%ls'%c",
                __LINE__, label.c_str(), THLA_NEWLINE );
    }
 
+   if ( THLA_PROBE_ENABLED( sync_point_registered ) ) {
+      string label_str;
+      StringUtilities::to_string( label_str, label );
+      THLA_PROBE2( sync_point_registered, label_str.c_str(), 0 );
+   }
+
    bool not_unique = ( reason == RTI1516_NAMESPACE::SYNCHRONIZATION_POINT_LABEL_NOT_UNIQUE );
 
    federate->sync_point_registration_failed( label, not_unique );
@@ -210,6 +323,14 @@ void FedAmb::announceSynchronizationPoint(
    wstring const                               &label,
    RTI1516_NAMESPACE::VariableLengthData const &theUserSuppliedTag ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
+   if ( THLA_PROBE_ENABLED( sync_point_announced ) ) {
+      string label_str;
+      StringUtilities::to_string( label_str, label );
+      THLA_PROBE1( sync_point_announced, label_str.c_str() );
+   }
+
    federate->announce_sync_point( label, theUserSuppliedTag );
 }
 
@@ -217,11 +338,19 @@ void FedAmb::federationSynchronized(
    wstring const                              &label,
    RTI1516_NAMESPACE::FederateHandleSet const &failedToSyncSet ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationSynchronized():%d Label:'%ls'%c",
                __LINE__, label.c_str(), THLA_NEWLINE );
    }
 
+   if ( THLA_PROBE_ENABLED( federation_synchronized ) ) {
+      string label_str;
+      StringUtilities::to_string( label_str, label );
+      THLA_PROBE2( federation_synchronized, label_str.c_str(), failedToSyncSet.size() );
+   }
+
    federate->federation_synchronized( label );
 
    if ( !failedToSyncSet.empty() ) {
@@ -241,6 +370,8 @@ federate handles failed to synchronize on sync-point '%ls': %s%c",
 void FedAmb::initiateFederateSave(
    wstring const &label ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::initiateFederateSave():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -253,6 +384,8 @@ void FedAmb::initiateFederateSave(
    wstring const                        &label,
    RTI1516_NAMESPACE::LogicalTime const &theTime ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::initiateFederateSave():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -263,6 +396,8 @@ void FedAmb::initiateFederateSave(
 
 void FedAmb::federationSaved() throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationSaved():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -275,6 +410,8 @@ void FedAmb::federationSaved() throw( RTI1516_NAMESPACE::FederateInternalError )
 void FedAmb::federationNotSaved(
    RTI1516_NAMESPACE::SaveFailureReason theSaveFailureReason ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationNotSaved():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -291,6 +428,8 @@ void FedAmb::federationNotSaved(
 void FedAmb::federationSaveStatusResponse(
    RTI1516_NAMESPACE::FederateHandleSaveStatusPairVector const &theFederateStatusVector ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationSaveStatusResponse():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -301,6 +440,8 @@ void FedAmb::federationSaveStatusResponse(
 void FedAmb::requestFederationRestoreSucceeded(
    wstring const &label ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::requestFederationRestoreSucceeded():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -312,6 +453,8 @@ void FedAmb::requestFederationRestoreSucceeded(
 void FedAmb::requestFederationRestoreFailed(
    wstring const &label ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::requestFederationRestoreFailed():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -322,6 +465,8 @@ void FedAmb::requestFederationRestoreFailed(
 
 void FedAmb::federationRestoreBegun() throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationRestoreBegun():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -334,6 +479,8 @@ void FedAmb::initiateFederateRestore(
    wstring const                    &federateName,
    RTI1516_NAMESPACE::FederateHandle handle ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string name;
       StringUtilities::to_string( name, federateName );
@@ -346,6 +493,8 @@ void FedAmb::initiateFederateRestore(
 
 void FedAmb::federationRestored() throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationRestored():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -356,6 +505,8 @@ void FedAmb::federationRestored() throw( RTI1516_NAMESPACE::FederateInternalErro
 void FedAmb::federationNotRestored(
    RTI1516_NAMESPACE::RestoreFailureReason theRestoreFailureReason ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationNotRestored():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -367,6 +518,8 @@ void FedAmb::federationNotRestored(
 void FedAmb::federationRestoreStatusResponse(
    RTI1516_NAMESPACE::FederateRestoreStatusVector const &theFederateStatusVector ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::federationRestoreStatusResponse():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -387,6 +540,8 @@ void FedAmb::federationRestoreStatusResponse(
 void FedAmb::startRegistrationForObjectClass(
    RTI1516_NAMESPACE::ObjectClassHandle theClass ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::startRegistrationForObjectClass():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -395,6 +550,8 @@ FedAmb::startRegistrationForObjectClass():%d %c",
 void FedAmb::stopRegistrationForObjectClass(
    RTI1516_NAMESPACE::ObjectClassHandle theClass ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::stopRegistrationForObjectClass():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -403,6 +560,8 @@ FedAmb::stopRegistrationForObjectClass():%d %c",
 void FedAmb::turnInteractionsOn(
    RTI1516_NAMESPACE::InteractionClassHandle theHandle ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::turnInteractionsOn():%d %c",
             federate->get_federate_name(),
@@ -412,6 +571,8 @@ FedAmb::turnInteractionsOn():%d %c",
 void FedAmb::turnInteractionsOff(
    RTI1516_NAMESPACE::InteractionClassHandle theHandle ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::turnInteractionsOff():%d %c",
             federate->get_federate_name(),
@@ -426,6 +587,8 @@ FedAmb::turnInteractionsOff():%d %c",
 void FedAmb::objectInstanceNameReservationSucceeded(
    wstring const &theObjectInstanceName ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager != NULL ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string instance_name;
@@ -442,6 +605,8 @@ void FedAmb::objectInstanceNameReservationSucceeded(
 void FedAmb::objectInstanceNameReservationFailed(
    wstring const &theObjectInstanceName ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager != NULL ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string instance_name;
@@ -458,6 +623,8 @@ void FedAmb::objectInstanceNameReservationFailed(
 void FedAmb::multipleObjectInstanceNameReservationSucceeded(
    set< wstring > const &theObjectInstanceNames ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager != NULL ) {
 
       set< wstring >::const_iterator iter;
@@ -478,6 +645,8 @@ void FedAmb::multipleObjectInstanceNameReservationSucceeded(
 void FedAmb::multipleObjectInstanceNameReservationFailed(
    set< wstring > const &theObjectInstanceNames ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager != NULL ) {
 
       set< wstring >::const_iterator iter;
@@ -501,6 +670,8 @@ void FedAmb::discoverObjectInstance(
    RTI1516_NAMESPACE::ObjectClassHandle    theObjectClass,
    wstring const                          &theObjectInstanceName ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string id_str, name_str;
       StringUtilities::to_string( id_str, theObject );
@@ -535,6 +706,8 @@ void FedAmb::discoverObjectInstance(
    wstring const                          &theObjectInstanceName,
    RTI1516_NAMESPACE::FederateHandle       producingFederate ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string fed_id;
       StringUtilities::to_string( fed_id, producingFederate );
@@ -555,13 +728,21 @@ void FedAmb::reflectAttributeValues(
    RTI1516_NAMESPACE::TransportationType             theType,
    RTI1516_NAMESPACE::SupplementalReflectInfo        theReflectInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    // Get the TrickHLA object for the given Object Instance Handle.
    Object *trickhla_obj = ( manager != NULL ) ? manager->get_trickhla_object( theObject ) : NULL;
 
    if ( trickhla_obj != NULL ) {
+      THLA_TRACE_SCOPE( "callback", "reflectAttributeValues", manager->get_object_index( trickhla_obj ), -1 );
+
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         send_hs( stdout, "FedAmb:reflectAttributeValues():%d '%s'%c",
-                  __LINE__, trickhla_obj->get_name(), THLA_NEWLINE );
+         THLA_LOG( stdout, "FedAmb:reflectAttributeValues():%d '%s'%c",
+                   __LINE__, trickhla_obj->get_name(), THLA_NEWLINE );
+      }
+
+      if ( THLA_PROBE_ENABLED( reflect_attributes ) || THLA_PROBE_ENABLED( reflect_attribute ) ) {
+         fire_reflect_probes( manager->get_object_index( trickhla_obj ), theObject, theAttributeValues, -1 );
       }
 
       // Pass the attribute values off to the object.
@@ -573,6 +754,9 @@ void FedAmb::reflectAttributeValues(
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
       ++trickhla_obj->receive_count;
 #endif
+   } else if ( ( federate != NULL ) && federate->is_time_stall_reflection( theAttributeValues ) ) {
+      // MOM HLAfederate time state the time stall profiler asked for.
+      federate->reflect_time_stall_state( theObject, theAttributeValues );
    } else if ( ( federate != NULL ) && federate->is_federate_instance_id( theObject ) ) {
 
       if ( federation_restored_rebuild_federate_handle_set ) {
@@ -606,8 +790,8 @@ void FedAmb::reflectAttributeValues(
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string id_str;
          StringUtilities::to_string( id_str, theObject );
-         send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
+                   __LINE__, id_str.c_str(), THLA_NEWLINE );
       }
    }
 }
@@ -622,17 +806,27 @@ void FedAmb::reflectAttributeValues(
    RTI1516_NAMESPACE::OrderType                      receivedOrder,
    RTI1516_NAMESPACE::SupplementalReflectInfo        theReflectInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    // Get the TrickHLA object for the given Object Instance Handle.
    Object *trickhla_obj = ( manager != NULL ) ? manager->get_trickhla_object( theObject ) : NULL;
 
    if ( trickhla_obj != NULL ) {
+      THLA_TRACE_SCOPE( "callback", "reflectAttributeValues", manager->get_object_index( trickhla_obj ), -1 );
 
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          Int64Time time;
          time.set( theTime );
-         send_hs( stdout, "FedAmb:reflectAttributeValues():%d '%s' time:%f %c",
-                  __LINE__, trickhla_obj->get_name(), time.get_time_in_seconds(),
-                  THLA_NEWLINE );
+         THLA_LOG( stdout, "FedAmb:reflectAttributeValues():%d '%s' time:%f %c",
+                   __LINE__, trickhla_obj->get_name(), time.get_time_in_seconds(),
+                   THLA_NEWLINE );
+      }
+
+      if ( THLA_PROBE_ENABLED( reflect_attributes ) || THLA_PROBE_ENABLED( reflect_attribute ) ) {
+         fire_reflect_probes( manager->get_object_index( trickhla_obj ), theObject, theAttributeValues,
+                              ( receivedOrder == RTI1516_NAMESPACE::TIMESTAMP )
+                                 ? Int64Time( theTime ).get_time_in_micros()
+                                 : -1 );
       }
 
       // Pass the attribute values off to the object.
@@ -648,8 +842,8 @@ void FedAmb::reflectAttributeValues(
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string id_str;
          StringUtilities::to_string( id_str, theObject );
-         send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
+                   __LINE__, id_str.c_str(), THLA_NEWLINE );
       }
    }
 }
@@ -665,16 +859,26 @@ void FedAmb::reflectAttributeValues(
    RTI1516_NAMESPACE::MessageRetractionHandle        theHandle,
    RTI1516_NAMESPACE::SupplementalReflectInfo        theReflectInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    // Get the TrickHLA object for the given Object Instance Handle.
    Object *trickhla_obj = ( manager != NULL ) ? manager->get_trickhla_object( theObject ) : NULL;
 
    if ( trickhla_obj != NULL ) {
+      THLA_TRACE_SCOPE( "callback", "reflectAttributeValues", manager->get_object_index( trickhla_obj ), -1 );
 
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          Int64Time time;
          time.set( theTime );
-         send_hs( stdout, "FedAmb:reflectAttributeValues():%d '%s' time:%f %c",
-                  __LINE__, trickhla_obj->get_name(), time.get_time_in_seconds(), THLA_NEWLINE );
+         THLA_LOG( stdout, "FedAmb:reflectAttributeValues():%d '%s' time:%f %c",
+                   __LINE__, trickhla_obj->get_name(), time.get_time_in_seconds(), THLA_NEWLINE );
+      }
+
+      if ( THLA_PROBE_ENABLED( reflect_attributes ) || THLA_PROBE_ENABLED( reflect_attribute ) ) {
+         fire_reflect_probes( manager->get_object_index( trickhla_obj ), theObject, theAttributeValues,
+                              ( receivedOrder == RTI1516_NAMESPACE::TIMESTAMP )
+                                 ? Int64Time( theTime ).get_time_in_micros()
+                                 : -1 );
       }
 
       // Pass the attribute values off to the object.
@@ -690,8 +894,8 @@ void FedAmb::reflectAttributeValues(
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string id_str;
          StringUtilities::to_string( id_str, theObject );
-         send_hs( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
-                  __LINE__, id_str.c_str(), THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::reflectAttributeValues():%d Received update to Unknown Object Instance, ID:%s%c",
+                   __LINE__, id_str.c_str(), THLA_NEWLINE );
       }
    }
 }
@@ -704,15 +908,23 @@ void FedAmb::receiveInteraction(
    RTI1516_NAMESPACE::TransportationType             theType,
    RTI1516_NAMESPACE::SupplementalReceiveInfo        theReceiveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager == NULL ) {
       send_hs( stderr, "FedAmb::receiveInteraction():%d NULL Manager!%c",
                __LINE__, THLA_NEWLINE );
    } else {
+      THLA_TRACE_SCOPE( "callback", "receiveInteraction", -1, -1 );
+
       Int64Time dummyTime;
 
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         send_hs( stderr, "FedAmb::receiveInteraction():%d %c",
-                  __LINE__, THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::receiveInteraction():%d %c",
+                   __LINE__, THLA_NEWLINE );
+      }
+
+      if ( THLA_PROBE_ENABLED( receive_interaction ) ) {
+         fire_receive_interaction_probe( theInteraction, theParameterValues, -1 );
       }
 
       // Process the interaction.
@@ -734,14 +946,25 @@ void FedAmb::receiveInteraction(
    RTI1516_NAMESPACE::OrderType                      receivedOrder,
    RTI1516_NAMESPACE::SupplementalReceiveInfo        theReceiveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager == NULL ) {
       send_hs( stderr, "FedAmb::receiveInteraction():%d NULL Manager!%c",
                __LINE__, THLA_NEWLINE );
    } else {
+      THLA_TRACE_SCOPE( "callback", "receiveInteraction", -1, -1 );
+
       // Process the interaction.
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         send_hs( stderr, "FedAmb::receiveInteraction():%d %c",
-                  __LINE__, THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::receiveInteraction():%d %c",
+                   __LINE__, THLA_NEWLINE );
+      }
+
+      if ( THLA_PROBE_ENABLED( receive_interaction ) ) {
+         fire_receive_interaction_probe( theInteraction, theParameterValues,
+                                         ( receivedOrder == RTI1516_NAMESPACE::TIMESTAMP )
+                                            ? Int64Time( theTime ).get_time_in_micros()
+                                            : -1 );
       }
 
       manager->receive_interaction( theInteraction,
@@ -763,16 +986,27 @@ void FedAmb::receiveInteraction(
    RTI1516_NAMESPACE::MessageRetractionHandle        theHandle,
    RTI1516_NAMESPACE::SupplementalReceiveInfo        theReceiveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager == NULL ) {
       send_hs( stderr, "FedAmb::receiveInteraction():%d NULL Manager!%c",
                __LINE__, THLA_NEWLINE );
    } else {
+      THLA_TRACE_SCOPE( "callback", "receiveInteraction", -1, -1 );
+
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
-         send_hs( stderr, "FedAmb::receiveInteraction():%d %c",
-                  __LINE__, THLA_NEWLINE );
+         THLA_LOG( stderr, "FedAmb::receiveInteraction():%d %c",
+                   __LINE__, THLA_NEWLINE );
       }
 
       // Process the interaction.
+      if ( THLA_PROBE_ENABLED( receive_interaction ) ) {
+         fire_receive_interaction_probe( theInteraction, theParameterValues,
+                                         ( receivedOrder == RTI1516_NAMESPACE::TIMESTAMP )
+                                            ? Int64Time( theTime ).get_time_in_micros()
+                                            : -1 );
+      }
+
       manager->receive_interaction( theInteraction,
                                     (ParameterHandleValueMap &)theParameterValues,
                                     theUserSuppliedTag,
@@ -787,6 +1021,8 @@ void FedAmb::removeObjectInstance(
    RTI1516_NAMESPACE::OrderType                 sentOrder,
    RTI1516_NAMESPACE::SupplementalRemoveInfo    theRemoveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string id_str;
       StringUtilities::to_string( id_str, theObject );
@@ -805,6 +1041,7 @@ void FedAmb::removeObjectInstance(
 
    // Remove the instance ID for a federate, which this function will test for.
    federate->remove_MOM_HLAfederate_instance_id( theObject );
+   federate->remove_time_stall_federate( theObject );
 
    // Mark this object as deleted from the RTI.
    manager->mark_object_as_deleted_from_federation( theObject );
@@ -818,8 +1055,11 @@ void FedAmb::removeObjectInstance(
    RTI1516_NAMESPACE::OrderType                 receivedOrder,
    RTI1516_NAMESPACE::SupplementalRemoveInfo    theRemoveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    // Remove the instance ID for a federate, which this function will test for.
    federate->remove_MOM_HLAfederate_instance_id( theObject );
+   federate->remove_time_stall_federate( theObject );
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string id_str;
@@ -848,8 +1088,11 @@ void FedAmb::removeObjectInstance(
    RTI1516_NAMESPACE::MessageRetractionHandle   theHandle,
    RTI1516_NAMESPACE::SupplementalRemoveInfo    theRemoveInfo ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    // Remove the instance ID for a federate, which this function will test for.
    federate->remove_MOM_HLAfederate_instance_id( theObject );
+   federate->remove_time_stall_federate( theObject );
 
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       string id_str;
@@ -873,6 +1116,8 @@ void FedAmb::attributesInScope(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::attributesInScope():%d %c",
             federate->get_federate_name(),
@@ -883,6 +1128,8 @@ void FedAmb::attributesOutOfScope(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::attributesOutOfScope():%d %c",
             federate->get_federate_name(),
@@ -894,6 +1141,8 @@ void FedAmb::provideAttributeValueUpdate(
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes,
    RTI1516_NAMESPACE::VariableLengthData const &theUserSuppliedTag ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( manager != NULL ) {
       manager->provide_attribute_update( theObject,
                                          (AttributeHandleSet &)theAttributes );
@@ -904,6 +1153,8 @@ void FedAmb::turnUpdatesOnForObjectInstance(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::turnUpdatesOnForObjectInstance():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -914,6 +1165,8 @@ void FedAmb::turnUpdatesOnForObjectInstance(
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes,
    wstring const                               &updateRateDesignator ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::turnUpdatesOnForObjectInstance():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -923,6 +1176,8 @@ void FedAmb::turnUpdatesOffForObjectInstance(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::turnUpdatesOffForObjectInstance():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -933,6 +1188,8 @@ void FedAmb::confirmAttributeTransportationTypeChange(
    RTI1516_NAMESPACE::AttributeHandleSet   theAttributes,
    RTI1516_NAMESPACE::TransportationType   theTransportation ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::confirmAttributeTransportationTypeChange():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -943,6 +1200,8 @@ void FedAmb::reportAttributeTransportationType(
    RTI1516_NAMESPACE::AttributeHandle      theAttribute,
    RTI1516_NAMESPACE::TransportationType   theTransportation ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::reportAttributeTransportationType():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -952,6 +1211,8 @@ void FedAmb::confirmInteractionTransportationTypeChange(
    RTI1516_NAMESPACE::InteractionClassHandle theInteraction,
    RTI1516_NAMESPACE::TransportationType     theTransportation ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::confirmInteractionTransportationTypeChange():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -962,6 +1223,8 @@ void FedAmb::reportInteractionTransportationType(
    RTI1516_NAMESPACE::InteractionClassHandle theInteraction,
    RTI1516_NAMESPACE::TransportationType     theTransportation ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::reportInteractionTransportationType():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -977,6 +1240,8 @@ void FedAmb::requestAttributeOwnershipAssumption(
    RTI1516_NAMESPACE::AttributeHandleSet const &offeredAttributes,
    RTI1516_NAMESPACE::VariableLengthData const &theUserSuppliedTag ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    char const *tag = (char const *)theUserSuppliedTag.data();
    if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::requestAttributeOwnershipAssumption():%d push request received, tag='%s'%c",
@@ -987,6 +1252,11 @@ void FedAmb::requestAttributeOwnershipAssumption(
 
    if ( trickhla_obj != NULL ) {
 
+      if ( THLA_PROBE_ENABLED( ownership_assumption_request ) ) {
+         THLA_PROBE3( ownership_assumption_request, manager->get_object_index( trickhla_obj ),
+                      (long)theObject.hash(), offeredAttributes.size() );
+      }
+
       AttributeHandleSet::const_iterator iter;
 
       bool any_attribute_not_recognized = false;
@@ -1098,6 +1368,8 @@ void FedAmb::requestDivestitureConfirmation(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &releasedAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    Object *trickhla_obj = ( manager != NULL ) ? manager->get_trickhla_object( theObject ) : NULL;
 
    if ( trickhla_obj == NULL ) {
@@ -1111,6 +1383,11 @@ object instance (ID:%s), push request rejected.%c",
       throw FederateInternalError( L"FedAmb::requestDivestitureConfirmation() Unknown object instance." );
    }
 
+   if ( THLA_PROBE_ENABLED( divestiture_confirmation ) ) {
+      THLA_PROBE3( divestiture_confirmation, manager->get_object_index( trickhla_obj ),
+                   (long)theObject.hash(), releasedAttributes.size() );
+   }
+
    AttributeHandleSet::const_iterator iter;
    bool                               any_devist_requested         = false;
    bool                               any_attribute_not_recognized = false;
@@ -1192,6 +1469,8 @@ void FedAmb::attributeOwnershipAcquisitionNotification(
    RTI1516_NAMESPACE::AttributeHandleSet const &securedAttributes,
    RTI1516_NAMESPACE::VariableLengthData const &theUserSuppliedTag ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_3_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::attributeOwnershipAcquisitionNotification():%d %c",
                __LINE__, THLA_NEWLINE );
@@ -1200,6 +1479,12 @@ void FedAmb::attributeOwnershipAcquisitionNotification(
    Object *trickhla_obj = ( manager != NULL ) ? manager->get_trickhla_object( theObject ) : NULL;
 
    if ( trickhla_obj != NULL ) {
+
+      if ( THLA_PROBE_ENABLED( ownership_acquired ) ) {
+         THLA_PROBE3( ownership_acquired, manager->get_object_index( trickhla_obj ),
+                      (long)theObject.hash(), securedAttributes.size() );
+      }
+
       AttributeHandleSet::const_iterator iter;
       bool                               any_attribute_acquired       = false;
       bool                               any_attribute_not_recognized = false;
@@ -1302,6 +1587,8 @@ void FedAmb::attributeOwnershipUnavailable(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &releasedAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::attributeOwnershipUnavailable():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -1313,6 +1600,8 @@ void FedAmb::requestAttributeOwnershipRelease(
    RTI1516_NAMESPACE::AttributeHandleSet const &candidateAttributes,
    RTI1516_NAMESPACE::VariableLengthData const &theUserSuppliedTag ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    char const *tag = (char const *)theUserSuppliedTag.data();
    if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::requestAttributeOwnershipRelease():%d pull request received, tag='%s'%c",
@@ -1322,6 +1611,11 @@ void FedAmb::requestAttributeOwnershipRelease(
 
    if ( trickhla_obj != NULL ) {
 
+      if ( THLA_PROBE_ENABLED( ownership_release_request ) ) {
+         THLA_PROBE3( ownership_release_request, manager->get_object_index( trickhla_obj ),
+                      (long)theObject.hash(), candidateAttributes.size() );
+      }
+
       AttributeHandleSet::const_iterator iter;
       bool                               any_pull_requested           = false;
       bool                               any_attribute_not_recognized = false;
@@ -1407,6 +1701,8 @@ void FedAmb::confirmAttributeOwnershipAcquisitionCancellation(
    RTI1516_NAMESPACE::ObjectInstanceHandle      theObject,
    RTI1516_NAMESPACE::AttributeHandleSet const &releasedAttributes ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::confirmAttributeOwnershipAcquisitionCancellation():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -1418,6 +1714,8 @@ void FedAmb::informAttributeOwnership(
    RTI1516_NAMESPACE::AttributeHandle      theAttribute,
    RTI1516_NAMESPACE::FederateHandle       theOwner ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::informAttributeOwnership():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -1428,6 +1726,8 @@ void FedAmb::attributeIsNotOwned(
    RTI1516_NAMESPACE::ObjectInstanceHandle theObject,
    RTI1516_NAMESPACE::AttributeHandle      theAttribute ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::attributeIsNotOwned():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -1438,6 +1738,8 @@ void FedAmb::attributeIsOwnedByRTI(
    RTI1516_NAMESPACE::ObjectInstanceHandle theObject,
    RTI1516_NAMESPACE::AttributeHandle      theAttribute ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::attributeIsOwnedByRTI():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -1450,6 +1752,8 @@ FedAmb::attributeIsOwnedByRTI():%d %c",
 void FedAmb::timeRegulationEnabled(
    RTI1516_NAMESPACE::LogicalTime const &theFederateTime ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::timeRegulationEnabled():%d Federate \"%s\" %c",
                __LINE__, federate->get_federate_name(), THLA_NEWLINE );
@@ -1460,6 +1764,8 @@ void FedAmb::timeRegulationEnabled(
 void FedAmb::timeConstrainedEnabled(
    RTI1516_NAMESPACE::LogicalTime const &theFederateTime ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
       send_hs( stdout, "FedAmb::timeConstrainedEnabled():%d Federate \
 \"%s\" Time granted to: %.12G %c",
@@ -1472,13 +1778,22 @@ void FedAmb::timeConstrainedEnabled(
 void FedAmb::timeAdvanceGrant(
    RTI1516_NAMESPACE::LogicalTime const &theTime ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
+   THLA_TRACE_SCOPE( "callback", "timeAdvanceGrant", -1, -1 );
+
    Int64Time int64Time( theTime );
 
+   THLA_PROBE1( time_advance_grant, int64Time.get_time_in_micros() );
+
    // Ignore any granted time less than the requested time otherwise it will
    // break our concept of HLA time since we are using scheduled jobs for
    // processing HLA data sends, receives, etc and expected the next granted
    // time to match our requested time. Dan Dexter, 2/12/2007
-   if ( int64Time >= federate->get_requested_time() ) {
+   // A Next Message Request is granted at the time of the next message, which
+   // can be before the next frame, so only the time must not go backwards.
+   if ( ( int64Time >= federate->get_requested_time() )
+        || ( federate->is_next_message_mode() && ( int64Time >= federate->get_granted_time() ) ) ) {
 
       federate->set_time_advance_granted( theTime );
 
@@ -1496,6 +1811,8 @@ IGNORING GRANTED TIME %.12G because it is less then requested time %.12G %c",
 void FedAmb::requestRetraction(
    RTI1516_NAMESPACE::MessageRetractionHandle theHandle ) throw( RTI1516_NAMESPACE::FederateInternalError )
 {
+   check_callback_thread();
+
    send_hs( stderr, "This federate '%s' does not support this function: \
 FedAmb::requestRetraction():%d %c",
             federate->get_federate_name(), __LINE__, THLA_NEWLINE );
@@ -15,15 +15,25 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AllocationGuard.cpp}
+@trick_link_dependency{AsyncLogger.cpp}
+@trick_link_dependency{AsyncPublisher.cpp}
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{EvokedCallbacks.cpp}
 @trick_link_dependency{ExecutionControlBase.cpp}
 @trick_link_dependency{FedAmb.cpp}
 @trick_link_dependency{Federate.cpp}
 @trick_link_dependency{Int64Interval.cpp}
+@trick_link_dependency{LatencyHistogram.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MetricsRegistry.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
+@trick_link_dependency{ThreadConfig.cpp}
+@trick_link_dependency{TimeStallProfiler.cpp}
+@trick_link_dependency{TraceRecorder.cpp}
 @trick_link_dependency{TrickThreadCoordinator.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{Utilities.cpp}
@@ -34,24 +44,46 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, Jan 2019, --, SRFOM support & test.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional asynchronous attribute update publisher.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread coordination summary at shutdown.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Child thread object data exchange.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Latency histograms.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics in shared memory.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Asynchronous debug logging.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Next Message Request time advance modes.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Adaptive lookahead.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Time advance stall profiler.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Batched time advance requests.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Pipelined time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, TSC clock calibration at initialization.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation and allocation guard.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, HLA_EVOKED callback model.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread affinity and scheduling configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Keep the adaptive lookahead when nothing timestamped was sent.}
 @revs_end
 
 */
 
 // System include files.
 #include <arpa/inet.h>
+#include <cctype>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib> // for atof
 #include <float.h>
+#include <cstring>
+#include <errno.h>
 #include <fstream> // for ifstream
 #include <iostream>
 #include <limits>
+#include <malloc.h>
 #include <memory> // for auto_ptr
 #include <sstream>
 #include <string>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <time.h>
 
@@ -70,17 +102,24 @@ NASA, Johnson Space Center\n
 #include "trick/release.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationGuard.hh"
+#include "TrickHLA/AsyncLogger.hh"
+#include "TrickHLA/AsyncPublisher.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/EvokedCallbacks.hh"
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/FedAmb.hh"
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/Int64Interval.hh"
+#include "TrickHLA/LatencyHistogram.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TSCTimeline.hh"
+#include "TrickHLA/TraceRecorder.hh"
 #include "TrickHLA/TrickThreadCoordinator.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
@@ -134,6 +173,13 @@ Federate::Federate()
      time_regulating( true ),
      time_constrained( true ),
      time_management( true ),
+     time_advance_mode( TIME_ADVANCE_MODE_TAR ),
+     batch_max_frames( 10 ),
+     pipelined_time_advance( false ),
+     adaptive_lookahead( false ),
+     lookahead_min_time( 0.0 ),
+     lookahead_max_time( 0.0 ),
+     adaptive_lookahead_frames( 10 ),
      enable_known_feds( true ),
      known_feds_count( 0 ),
      known_feds( NULL ),
@@ -143,11 +189,41 @@ Federate::Federate()
      can_rejoin_federation( false ),
      freeze_delay_frames( 2 ),
      unfreeze_after_save( false ),
+     async_publish( false ),
+     child_thread_data_exchange( false ),
+     trace_frame_phases( false ),
+     trace_events_per_thread( 65536 ),
+     trace_file( NULL ),
+     latency_stats( false ),
+     latency_stats_report_period( 0.0 ),
+     time_stall_profiler( false ),
+     stall_threshold( 0.1 ),
+     stall_report_period( 0.0 ),
+     runtime_metrics( false ),
+     metrics_shm_name( NULL ),
+     async_debug_log( false ),
+     async_log_records_per_thread( 1024 ),
+     debug_log_rate_limit( 0 ),
+     real_time_memory( false ),
+     lock_memory( false ),
+     allocation_guard( false ),
+     evoked_callbacks( false ),
+     callback_budget( 0.001 ),
+     callback_thread(),
+     publisher_thread(),
+     logger_thread(),
+     ownership_thread(),
      federation_created_by_federate( false ),
      federation_exists( false ),
      federation_joined( false ),
      all_federates_joined( false ),
      lookahead( 0.0 ),
+     lookahead_pending_micros( -1 ),
+     lookahead_pending_time( 0.0 ),
+     min_send_distance_micros( INT64_MAX ),
+     lookahead_window_grants( 0 ),
+     lookahead_window_waits( 0 ),
+     lookahead_window_wait_ns( 0 ),
      shutdown_called( false ),
      HLA_save_directory( "" ),
      initiate_save_flag( false ),
@@ -184,6 +260,8 @@ Federate::Federate()
      time_adv_state_mutex(),
      granted_time( 0.0 ),
      requested_time( 0.0 ),
+     next_event_time( 0.0 ),
+     batch_frame_time( 0.0 ),
      HLA_time( 0.0 ),
      start_to_save( false ),
      start_to_restore( false ),
@@ -191,6 +269,7 @@ Federate::Federate()
      restart_cfg_flag( false ),
      time_regulating_state( false ),
      time_constrained_state( false ),
+     pipelined_grant_pending( false ),
      got_startup_sync_point( false ),
      make_copy_of_run_directory( false ),
      MOM_HLAfederation_class_handle(),
@@ -209,6 +288,18 @@ Federate::Federate()
      joined_federate_handles(),
      joined_federate_names(),
      thread_coordinator(),
+     async_publisher(),
+     rti_update_mutex(),
+     tag_wait_stats(),
+     tar_begin_ns( 0 ),
+     next_latency_stats_report_ns( 0 ),
+     metrics_registry(),
+     stall_profiler(),
+     stall_MOM_attributes(),
+     stall_GALT_micros( -1 ),
+     stall_queried( false ),
+     next_stall_report_ns( 0 ),
+     allocation_warned( false ),
      RTI_ambassador( NULL ),
      federate_ambassador( NULL ),
      manager( NULL ),
@@ -273,6 +364,22 @@ Federate::~Federate()
       MIM_module = static_cast< char * >( NULL );
    }
 
+   // Free the memory used by the trace file name.
+   if ( trace_file != static_cast< char * >( NULL ) ) {
+      if ( TMM_is_alloced( trace_file ) ) {
+         TMM_delete_var_a( trace_file );
+      }
+      trace_file = static_cast< char * >( NULL );
+   }
+
+   // Free the memory used by the metrics shared memory name.
+   if ( metrics_shm_name != static_cast< char * >( NULL ) ) {
+      if ( TMM_is_alloced( metrics_shm_name ) ) {
+         TMM_delete_var_a( metrics_shm_name );
+      }
+      metrics_shm_name = static_cast< char * >( NULL );
+   }
+
    // Free the memory used by the array of known Federates for the Federation.
    if ( known_feds != static_cast< KnownFederate * >( NULL ) ) {
       for ( unsigned int i = 0; i < known_feds_count; ++i ) {
@@ -483,6 +590,35 @@ void Federate::initialize()
                __LINE__, name, type, THLA_NEWLINE );
    }
 
+   // Start the debug message writer thread if requested.
+   AsyncLogger::set_rate_limit( debug_log_rate_limit );
+   if ( this->async_debug_log ) {
+      AsyncLogger::start( async_log_records_per_thread, &logger_thread );
+   }
+
+   // Start recording the frame phases if requested.
+   if ( this->trace_frame_phases ) {
+      if ( ( trace_file == NULL ) || ( *trace_file == '\0' ) ) {
+         trace_file = TMM_strdup( (char *)"trickhla_trace.json" );
+      }
+#if defined( THLA_FRAME_TRACING )
+      TraceRecorder::enable( trace_events_per_thread );
+#else
+      send_hs( stderr, "Federate::initialize():%d WARNING: Frame phase tracing \
+was requested but TrickHLA was built with NO_THLA_FRAME_TRACING defined in \
+CompileConfig.hh, so no trace will be written.%c",
+               __LINE__, THLA_NEWLINE );
+#endif
+   }
+
+   // Calibrate the clock of the sleep timeouts now instead of on the first
+   // spin wait.
+   TSCTimeline::initialize();
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::initialize():%d Clock:%c%s%c",
+               __LINE__, THLA_NEWLINE, TSCTimeline::to_string().c_str(), THLA_NEWLINE );
+   }
+
    // Check to make sure we have a reference to the TrickHLA::FedAmb.
    if ( federate_ambassador == NULL ) {
       ostringstream errmsg;
@@ -565,6 +701,60 @@ void Federate::restart_initialization()
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
+   if ( ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH ) && ( this->batch_max_frames == 0 ) ) {
+      this->batch_max_frames = 1;
+   }
+
+   if ( this->adaptive_lookahead ) {
+      // A zero bound means the configured lookahead time.
+      if ( lookahead_min_time <= 0.0 ) {
+         lookahead_min_time = lookahead_time;
+      }
+      if ( lookahead_max_time <= 0.0 ) {
+         lookahead_max_time = lookahead_time;
+      }
+      if ( lookahead_time <= 0.0 ) {
+         send_hs( stderr, "Federate::restart_initialization():%d WARNING: \
+Disabling the adaptive lookahead since it does not apply to a zero lookahead time.%c",
+                  __LINE__, THLA_NEWLINE );
+         this->adaptive_lookahead = false;
+      } else if ( ( lookahead_min_time > lookahead_time ) || ( lookahead_max_time < lookahead_time ) ) {
+         ostringstream errmsg;
+         errmsg << "Federate::restart_initialization():" << __LINE__
+                << " Invalid adaptive lookahead bounds! The lookahead_min_time ("
+                << lookahead_min_time << " seconds) must not be greater than"
+                << " and the lookahead_max_time (" << lookahead_max_time
+                << " seconds) must not be less than the lookahead_time ("
+                << lookahead_time << " seconds)." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      // The cyclic data is sent at the granted time plus the data cycle
+      // time, which must not be less than the granted time plus lookahead.
+      int64_t const data_cycle_micros = thread_coordinator.get_main_thread_data_cycle_time_micros();
+      if ( this->adaptive_lookahead
+           && ( data_cycle_micros > 0LL )
+           && ( Int64Interval::to_microseconds( lookahead_max_time ) > data_cycle_micros ) ) {
+         ostringstream errmsg;
+         errmsg << "Federate::restart_initialization():" << __LINE__
+                << " Invalid adaptive lookahead bounds! The lookahead_max_time ("
+                << lookahead_max_time << " seconds) must not be greater than"
+                << " the data cycle time (" << Int64Interval::to_seconds( data_cycle_micros )
+                << " seconds) of the send_cyclic_and_requested_data() job." << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      if ( this->adaptive_lookahead_frames == 0 ) {
+         this->adaptive_lookahead_frames = 1;
+      }
+   }
+
+   // Start the adaptive lookahead over from the configured lookahead time.
+   this->lookahead_pending_micros = -1;
+   this->min_send_distance_micros = INT64_MAX;
+   this->lookahead_window_grants  = 0;
+   this->lookahead_window_waits   = 0;
+   this->lookahead_window_wait_ns = 0;
+
    // Verify the FOM-modules value.
    if ( ( FOM_modules == NULL ) || ( *FOM_modules == '\0' ) ) {
       ostringstream errmsg;
@@ -652,6 +842,27 @@ void Federate::pre_multiphase_initialization()
 
    // Initialize the TrickHLA::Manager object instance.
    manager->initialize();
+
+   // Export the runtime metrics to shared memory if requested.
+   if ( this->runtime_metrics ) {
+      if ( ( metrics_shm_name == NULL ) || ( *metrics_shm_name == '\0' ) ) {
+         // The shared memory name can not have any other slashes in it.
+         string shm_name = "/TrickHLA_";
+         for ( char const *c = name; *c != '\0'; ++c ) {
+            shm_name += isalnum( *c ) ? *c : '_';
+         }
+         metrics_shm_name = TMM_strdup( (char *)shm_name.c_str() );
+      }
+      if ( metrics_registry.initialize( metrics_shm_name, name, manager->get_metrics_entry_count() ) ) {
+         manager->register_metrics( metrics_registry );
+         metrics_registry.publish();
+
+         if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::initialize():%d Runtime metrics are in shared memory '%s'.%c",
+                     __LINE__, metrics_shm_name, THLA_NEWLINE );
+         }
+      }
+   }
 }
 
 /*!
@@ -666,6 +877,48 @@ void Federate::post_multiphase_initialization()
    // Perform the Execution Control specific post-multi-phase initialization.
    execution_control->post_multi_phase_init_processes();
 
+   // The attribute updates only need to be serialized if the Trick child
+   // threads send their own objects.
+   rti_update_mutex.set_single_threaded( !this->child_thread_data_exchange );
+
+   // Start the publisher thread now that the initialization data exchanges,
+   // which are always sent from the Trick main thread, are done.
+   if ( this->async_publish ) {
+      async_publisher.start( get_RTI_ambassador(), &publisher_thread );
+   }
+
+   // The MOM HLAfederate subscriptions used to find the joined federates
+   // are gone by now, so subscribe to the time state attributes we need.
+   if ( this->time_stall_profiler && this->time_management ) {
+      setup_time_stall_profiler();
+   }
+
+   // With the callbacks evoked on this thread, the mutexes of the data path
+   // are only needed by the publisher thread and the Trick child threads.
+   // Objects that can transfer ownership keep their object mutexes locking
+   // for the ownership push and divestiture threads.
+   if ( EvokedCallbacks::is_enabled()
+        && !this->async_publish
+        && !this->child_thread_data_exchange
+        && !thread_coordinator.is_any_child_thread_associated() ) {
+
+      manager->set_single_threaded( true );
+      time_adv_state_mutex.set_single_threaded( true );
+      joined_federate_mutex.set_single_threaded( true );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::post_multiphase_initialization():%d Using \
+the single threaded data path for the evoked callbacks.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+   }
+
+   // Size, prefault and lock the memory used by the real-time frames now
+   // that the objects and interactions are initialized.
+   prepare_real_time_memory();
+
+   print_thread_report();
+
    // Debug printout.
    if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::post_multiphase_initialization():%d\n     Simulation has started and is now running...%c",
@@ -676,6 +929,124 @@ void Federate::post_multiphase_initialization()
    this->set_federate_has_begun_execution();
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Federate::deliver_evoked_callbacks()
+{
+   if ( !EvokedCallbacks::is_enabled() ) {
+      return;
+   }
+
+   if ( EvokedCallbacks::deliver( this->callback_budget )
+        && DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::deliver_evoked_callbacks():%d Callbacks are \
+still pending after the %.6G second budget.%c",
+               __LINE__, this->callback_budget, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details The glibc allocator is also told to never trim the heap or use
+ * mmap() for large blocks when the memory is locked, so the memory freed and
+ * allocated again by the frames stays locked and faulted in.
+ * @job_class{initialization}
+ */
+void Federate::prepare_real_time_memory()
+{
+   if ( this->real_time_memory ) {
+      manager->prepare_buffers_for_real_time();
+
+      if ( this->async_publish ) {
+         async_publisher.reserve_records( manager->get_object_count() );
+      }
+
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::prepare_real_time_memory():%d Prepared the \
+attribute and parameter buffers for the real-time frames.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+
+      if ( this->lock_memory ) {
+#if defined( __GLIBC__ )
+         mallopt( M_TRIM_THRESHOLD, -1 );
+         mallopt( M_MMAP_MAX, 0 );
+#endif
+         if ( mlockall( MCL_CURRENT | MCL_FUTURE ) != 0 ) {
+            int const error = errno;
+            send_hs( stderr, "Federate::prepare_real_time_memory():%d WARNING: \
+Failed to lock the memory with mlockall(), which usually needs the CAP_IPC_LOCK \
+capability or a larger memlock limit (ulimit -l): %s%c",
+                     __LINE__, strerror( error ), THLA_NEWLINE );
+         } else if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::prepare_real_time_memory():%d Locked the \
+process memory.%c",
+                     __LINE__, THLA_NEWLINE );
+         }
+      }
+   } else if ( this->lock_memory ) {
+      send_hs( stderr, "Federate::prepare_real_time_memory():%d WARNING: \
+The lock_memory setting needs real_time_memory to be set, so the memory will \
+not be locked.%c",
+               __LINE__, THLA_NEWLINE );
+   }
+
+   if ( this->allocation_guard ) {
+      if ( AllocationGuard::is_built_in() ) {
+         AllocationGuard::arm();
+      } else {
+         send_hs( stderr, "Federate::prepare_real_time_memory():%d WARNING: \
+The allocation guard was requested but TrickHLA was built without \
+THLA_ALLOCATION_GUARD defined in CompileConfig.hh, so allocations will not be \
+counted.%c",
+                  __LINE__, THLA_NEWLINE );
+      }
+   }
+}
+
+/*!
+ * @details Starting the publisher and logger threads waits until they have
+ * applied their configuration, so their effective settings are known here.
+ * The RTI callback thread is configured on its first callback.
+ * @job_class{initialization}
+ */
+void Federate::print_thread_report()
+{
+   if ( !callback_thread.is_configured()
+        && !publisher_thread.is_configured()
+        && !logger_thread.is_configured()
+        && !ownership_thread.is_configured()
+        && !DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      return;
+   }
+
+   string const callback_desc  = callback_thread.get_effective();
+   string const publisher_desc = publisher_thread.get_effective();
+   string const logger_desc    = logger_thread.get_effective();
+   string const ownership_desc = ownership_thread.get_effective();
+
+   ostringstream msg;
+   msg << "Federate::print_thread_report():" << __LINE__
+       << " Effective thread affinity and scheduling:" << endl
+       << "  Trick main: " << ThreadConfig::describe_current_thread() << endl
+       << "  RTI callback: "
+       << ( EvokedCallbacks::is_enabled() ? string( "evoked on the Trick main thread" )
+                                          : ( callback_desc.empty() ? string( "no callback yet" ) : callback_desc ) )
+       << endl
+       << "  Publisher: "
+       << ( !this->async_publish ? string( "not used" )
+                                 : ( publisher_desc.empty() ? string( "not started" ) : publisher_desc ) )
+       << endl
+       << "  Logger: "
+       << ( !this->async_debug_log ? string( "not used" )
+                                   : ( logger_desc.empty() ? string( "not started" ) : logger_desc ) )
+       << endl
+       << "  Ownership: "
+       << ( ownership_desc.empty() ? string( "started on demand" ) : ownership_desc )
+       << endl;
+   send_hs( stdout, "%s%c", msg.str().c_str(), THLA_NEWLINE );
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -729,15 +1100,30 @@ void Federate::create_RTI_ambassador_and_connect()
       // Create the RTI ambassador.
       this->RTI_ambassador = rtiAmbassadorFactory->createRTIambassador();
 
+      // With HLA_EVOKED the RTI only calls the federate ambassador from the
+      // evoke calls TrickHLA makes on this thread.
+      CallbackModel const callback_model = this->evoked_callbacks ? HLA_EVOKED : HLA_IMMEDIATE;
+
       if ( ( local_settings == NULL ) || ( *local_settings == '\0' ) ) {
          // Use default vendor local settings.
-         RTI_ambassador->connect( *federate_ambassador, HLA_IMMEDIATE );
+         RTI_ambassador->connect( *federate_ambassador, callback_model );
 
       } else {
          wstring local_settings_ws;
          StringUtilities::to_wstring( local_settings_ws, local_settings );
 
-         RTI_ambassador->connect( *federate_ambassador, HLA_IMMEDIATE, local_settings_ws );
+         RTI_ambassador->connect( *federate_ambassador, callback_model, local_settings_ws );
+      }
+
+      // From now on the TrickHLA waits on this thread deliver the callbacks.
+      if ( this->evoked_callbacks ) {
+         EvokedCallbacks::enable( get_RTI_ambassador() );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::create_RTI_ambassador_and_connect():%d \
+Connected with the HLA_EVOKED callback model.%c",
+                     __LINE__, THLA_NEWLINE );
+         }
       }
 
       // Reset the Federate shutdown-called flag now that we are connected.
@@ -3185,7 +3571,8 @@ void Federate::post_restore()
          // When auto_unlock_mutex goes out of scope it automatically unlocks the
          // mutex even if there is an exception.
          MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
-         this->requested_time = this->granted_time;
+         this->requested_time   = this->granted_time;
+         this->batch_frame_time = this->granted_time;
       }
 
       federation_restored();
@@ -3254,6 +3641,7 @@ void Federate::set_requested_time(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
    requested_time.set( time );
+   batch_frame_time.set( time );
 }
 
 void Federate::set_requested_time(
@@ -3263,6 +3651,16 @@ void Federate::set_requested_time(
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
    requested_time.set( time );
+   batch_frame_time.set( time );
+}
+
+void Federate::set_next_event_time(
+   double const time )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+   next_event_time.set( time );
 }
 
 void Federate::set_lookahead(
@@ -3275,6 +3673,138 @@ void Federate::set_lookahead(
    lookahead_time = value;
 }
 
+void Federate::record_send_distance(
+   int64_t const distance_micros )
+{
+   if ( !this->adaptive_lookahead ) {
+      return;
+   }
+
+   // Lower the smallest distance without a lock since the child threads and
+   // the interaction senders can call this at the same time.
+   int64_t current = __atomic_load_n( &min_send_distance_micros, __ATOMIC_RELAXED );
+   while ( ( distance_micros < current )
+           && !__atomic_compare_exchange_n( &min_send_distance_micros, &current, distance_micros,
+                                            true, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+      // The current value was reloaded, so try again.
+   }
+}
+
+/*!
+ * @details The lookahead follows the smallest distance from the granted time
+ * of the timestamps sent over the window, within the configured bounds, and
+ * stays the same when nothing timestamped was sent. A higher
+ * lookahead takes effect right away. A lower lookahead is given to the RTI
+ * right away but is only used for sending once the granted time has advanced
+ * by the difference, since the RTI only lets the effective lookahead shrink
+ * as time advances.
+ */
+void Federate::update_adaptive_lookahead()
+{
+   int64_t const granted_micros = this->granted_time.get_time_in_micros();
+
+   if ( ( this->lookahead_pending_micros >= 0 )
+        && ( granted_micros >= this->lookahead_pending_time.get_time_in_micros() ) ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+      this->lookahead.set( this->lookahead_pending_micros );
+      this->lookahead_pending_micros = -1;
+   }
+
+   if ( ++this->lookahead_window_grants < this->adaptive_lookahead_frames ) {
+      return;
+   }
+
+   int64_t const      distance      = __atomic_exchange_n( &min_send_distance_micros, INT64_MAX, __ATOMIC_RELAXED );
+   unsigned int const window_grants = this->lookahead_window_grants;
+   double const       mean_wait_us  = ( this->lookahead_window_waits > 0 )
+                                         ? ( (double)this->lookahead_window_wait_ns / this->lookahead_window_waits / 1000.0 )
+                                         : 0.0;
+   this->lookahead_window_grants  = 0;
+   this->lookahead_window_waits   = 0;
+   this->lookahead_window_wait_ns = 0;
+
+   int64_t const min_micros = Int64Interval::to_microseconds( this->lookahead_min_time );
+   int64_t const max_micros = Int64Interval::to_microseconds( this->lookahead_max_time );
+
+   int64_t const send_micros    = this->lookahead.get_time_in_micros();
+   int64_t const current_micros = ( this->lookahead_pending_micros >= 0 ) ? this->lookahead_pending_micros
+                                                                          : send_micros;
+
+   // Keep the current lookahead if nothing timestamped was sent, since the
+   // next window would otherwise swing it back to the data cycle time.
+   if ( distance == INT64_MAX ) {
+      metrics_registry.record_lookahead( current_micros, -1, false );
+      return;
+   }
+
+   int64_t target = distance;
+   if ( target < min_micros ) {
+      target = min_micros;
+   } else if ( target > max_micros ) {
+      target = max_micros;
+   }
+
+   if ( target == current_micros ) {
+      metrics_registry.record_lookahead( current_micros, distance, false );
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   bool modified = false;
+   try {
+      RTI_ambassador->modifyLookahead( Int64Interval( target ).get() );
+      modified = true;
+   } catch ( RTI1516_NAMESPACE::InvalidLookahead const &e ) {
+      send_hs( stderr, "Federate::update_adaptive_lookahead():%d ERROR: InvalidLookahead for %.12G seconds.%c",
+               __LINE__, Int64Interval::to_seconds( target ), THLA_NEWLINE );
+   } catch ( RTI1516_NAMESPACE::InTimeAdvancingState const &e ) {
+      send_hs( stderr, "Federate::update_adaptive_lookahead():%d ERROR: InTimeAdvancingState.%c",
+               __LINE__, THLA_NEWLINE );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      send_hs( stderr, "Federate::update_adaptive_lookahead():%d Unexpected RTI exception: '%s'%c",
+               __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   if ( !modified ) {
+      return;
+   }
+
+   if ( target >= send_micros ) {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+      this->lookahead.set( target );
+      this->lookahead_pending_micros = -1;
+   } else {
+      // Keep sending with the higher lookahead until the timestamps it
+      // allowed have passed.
+      this->lookahead_pending_micros = target;
+      this->lookahead_pending_time.set( granted_micros + ( send_micros - target ) );
+   }
+
+   metrics_registry.record_lookahead( target, distance, true );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::update_adaptive_lookahead():%d Lookahead changed \
+from %.12G to %.12G seconds at granted time %.12G seconds, smallest send \
+distance %.12G seconds, mean TAR to TAG wait %.3f microseconds over the last %u grants.%c",
+               __LINE__, Int64Interval::to_seconds( current_micros ),
+               Int64Interval::to_seconds( target ), Int64Interval::to_seconds( granted_micros ),
+               Int64Interval::to_seconds( distance ),
+               mean_wait_us, window_grants, THLA_NEWLINE );
+   }
+}
+
 void Federate::time_advance_request_to_GALT()
 {
    // Simply return if we are the master federate that created the federation,
@@ -4386,6 +4916,20 @@ void Federate::setup_time_regulation()
  */
 void Federate::time_advance_request()
 {
+   THLA_TRACE_SCOPE( "frame", "time_advance_request", -1, -1 );
+
+   // Report the first allocation made in the guarded jobs, which is checked
+   // once a frame before our own guard scope so the warning is not counted.
+   if ( !allocation_warned
+        && AllocationGuard::is_armed()
+        && ( AllocationGuard::get_allocation_count() > 0 ) ) {
+      this->allocation_warned = true;
+      send_hs( stderr, "Federate::time_advance_request():%d WARNING: \
+Heap allocation in a real-time frame:%c%s",
+               __LINE__, THLA_NEWLINE, AllocationGuard::to_string().c_str() );
+   }
+   THLA_ALLOCATION_GUARD_SCOPE( "time_advance_request" );
+
    // Skip requesting time-advancement if we are not time-regulating and
    // not time-constrained (i.e. not using time management).
    if ( !this->time_management ) {
@@ -4405,13 +4949,69 @@ void Federate::time_advance_request()
    this->save_completed = false; // reset ONLY at the bottom of the frame...
    // -- end of checkpoint additions --
 
+   bool already_granted;
    {
       // When auto_unlock_mutex goes out of scope it automatically unlocks the
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
 
-      // Build a request time.
-      this->requested_time += this->lookahead_time;
+      if ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH ) {
+         // Go to the next frame, which the outstanding batched request
+         // already covers unless we sent data in this frame.
+         this->batch_frame_time += this->lookahead_time;
+
+         already_granted = ( this->batch_frame_time <= this->requested_time );
+      } else {
+         // Build a request time.
+         this->requested_time += this->lookahead_time;
+
+         // A Next Message Request can be granted past the next frame, in which
+         // case we already hold the grant for the next frame.
+         already_granted = is_next_message_mode()
+                           && ( this->time_adv_state == TIME_ADVANCE_GRANTED )
+                           && ( this->granted_time >= this->requested_time );
+      }
+   }
+
+   if ( already_granted ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::time_advance_request():%d Skipping the request \
+for the frame at %.12G seconds since time is already requested to %.12G seconds \
+and granted to %.12G seconds.%c",
+                  __LINE__, batch_frame_time.get_time_in_seconds(),
+                  requested_time.get_time_in_seconds(),
+                  granted_time.get_time_in_seconds(), THLA_NEWLINE );
+      }
+      return;
+   }
+
+   if ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH ) {
+      int64_t const      frame_micros = Int64Interval::to_microseconds( this->lookahead_time );
+      unsigned int const frames       = ( manager != NULL )
+                                           ? manager->get_frames_to_next_send( frame_micros, this->batch_max_frames )
+                                           : 1;
+
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
+
+      int64_t const frame_time = this->batch_frame_time.get_time_in_micros();
+      int64_t       batch_time = frame_time + ( ( frames - 1 ) * frame_micros );
+
+      // Stop at the frame of the next event, such as the frame we send a
+      // timestamped interaction in.
+      int64_t const event_time = this->next_event_time.get_time_in_micros();
+      if ( ( frame_micros > 0LL ) && ( event_time >= frame_time ) && ( event_time < batch_time ) ) {
+         batch_time = frame_time + ( ( ( event_time - frame_time ) / frame_micros ) * frame_micros );
+      }
+      this->requested_time.set( batch_time );
+
+      if ( ( batch_time > frame_time ) && DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::time_advance_request():%d Batching the frames \
+from %.12G seconds into one request to %.12G seconds.%c",
+                  __LINE__, batch_frame_time.get_time_in_seconds(),
+                  requested_time.get_time_in_seconds(), THLA_NEWLINE );
+      }
    }
 
    // Perform the time-advance request to go to the requested time.
@@ -4445,6 +5045,10 @@ void Federate::perform_time_advance_request()
       this->time_adv_state = TIME_ADVANCE_RESET;
    }
 
+   // All of the attribute updates for this frame must be sent before we
+   // request the time advance to preserve the Timestamp Order (TSO) semantics.
+   async_publisher.flush();
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -4456,18 +5060,49 @@ void Federate::perform_time_advance_request()
       // Check for shutdown.
       check_for_shutdown_with_termination();
 
-      if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
-         send_hs( stdout, "Federate::perform_time_advance_request():%d Time Advance Request (TAR) to %.12G seconds.%c",
-                  __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
-      }
-
       try {
          // When auto_unlock_mutex goes out of scope it automatically unlocks
          // the mutex even if there is an exception.
          MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
 
-         // Request that time be advanced to the new time.
-         RTI_ambassador->timeAdvanceRequest( requested_time.get() );
+         // Start of the Time Advance Request to Grant wait.
+         if ( this->latency_stats || this->adaptive_lookahead || this->time_stall_profiler
+              || metrics_registry.is_initialized() ) {
+            this->tar_begin_ns = LatencyHistogram::now();
+         }
+
+         switch ( this->time_advance_mode ) {
+            case TIME_ADVANCE_MODE_NMR:
+            case TIME_ADVANCE_MODE_NMRA: {
+               // Ask for the later of the next frame and our next event, and
+               // the RTI grants the time of the next message if it is sooner.
+               Int64Time const &next_time = ( this->next_event_time > this->requested_time )
+                                               ? this->next_event_time
+                                               : this->requested_time;
+
+               if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+                  send_hs( stdout, "Federate::perform_time_advance_request():%d Next Message Request%s to %.12G seconds.%c",
+                           __LINE__, ( ( this->time_advance_mode == TIME_ADVANCE_MODE_NMRA ) ? " Available" : "" ),
+                           next_time.get_time_in_seconds(), THLA_NEWLINE );
+               }
+               if ( this->time_advance_mode == TIME_ADVANCE_MODE_NMRA ) {
+                  RTI_ambassador->nextMessageRequestAvailable( next_time.get() );
+               } else {
+                  RTI_ambassador->nextMessageRequest( next_time.get() );
+               }
+               break;
+            }
+            default: {
+               if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+                  send_hs( stdout, "Federate::perform_time_advance_request():%d Time Advance Request (TAR) to %.12G seconds.%c",
+                           __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
+               }
+
+               // Request that time be advanced to the new time.
+               RTI_ambassador->timeAdvanceRequest( requested_time.get() );
+               break;
+            }
+         }
 
          // Indicate we issued a TAR since we successfully made the request
          // without an exception.
@@ -4621,6 +5256,9 @@ void Federate::announce_data_sent()
  */
 void Federate::wait_to_send_data()
 {
+   THLA_TRACE_SCOPE( "frame", "wait_to_send_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "wait_to_send_data" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::wait_to_send_data():%d Thread:%d%c",
                __LINE__, exec_get_process_id(), THLA_NEWLINE );
@@ -4633,6 +5271,9 @@ void Federate::wait_to_send_data()
 /*! @brief Wait to receive data when the Trick main thread is ready. */
 void Federate::wait_to_receive_data()
 {
+   THLA_TRACE_SCOPE( "frame", "wait_to_receive_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "wait_to_receive_data" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::wait_to_receive_data():%d Thread:%d%c",
                __LINE__, exec_get_process_id(), THLA_NEWLINE );
@@ -4642,6 +5283,73 @@ void Federate::wait_to_receive_data()
    this->thread_coordinator.wait_to_receive_data();
 }
 
+/*!
+ * @details The receive is only done if child_thread_data_exchange is true,
+ * otherwise this is the same as wait_to_receive_data().
+ * @job_class{scheduled}
+ */
+void Federate::receive_child_thread_data()
+{
+   // Wait for the Trick main thread to have received the data for this frame.
+   wait_to_receive_data();
+
+   if ( this->child_thread_data_exchange ) {
+      unsigned int const thread_id = exec_get_process_id();
+
+      if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::receive_child_thread_data():%d Thread:%d%c",
+                  __LINE__, thread_id, THLA_NEWLINE );
+      }
+
+      // Receive the objects associated to this child thread.
+      this->manager->receive_cyclic_data_for_child_thread( thread_id );
+   }
+}
+
+/*!
+ * @details The objects are sent before this child thread is marked as ready
+ * to send, so the Trick main thread will not ask for a time advance until
+ * all the child thread updates for this frame have been sent. The send is
+ * only done if child_thread_data_exchange is true, otherwise this is the
+ * same as wait_to_send_data().
+ * @job_class{scheduled}
+ */
+void Federate::send_child_thread_data()
+{
+   if ( this->child_thread_data_exchange ) {
+      unsigned int const thread_id = exec_get_process_id();
+
+      if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::send_child_thread_data():%d Thread:%d%c",
+                  __LINE__, thread_id, THLA_NEWLINE );
+      }
+
+      // Send the objects associated to this child thread.
+      this->manager->send_cyclic_and_requested_data_for_child_thread( thread_id );
+   }
+
+   // Mark this thread as ready to send and wait for the main thread to send.
+   wait_to_send_data();
+}
+
+/*! @brief Get the Trick thread-id the object with the given index is
+ * associated to, which is 0 for the main thread. */
+unsigned int const Federate::get_thread_id_for_obj(
+   unsigned int const obj_index ) const
+{
+   // Delegate to the Trick child thread coordinator.
+   return this->thread_coordinator.get_thread_id_for_obj( obj_index );
+}
+
+/*! @brief Is the data for the object with the given index exchanged by the
+ * Trick child thread it is associated to instead of the main thread. */
+bool const Federate::is_obj_exchanged_by_child_thread(
+   unsigned int const obj_index ) const
+{
+   return ( this->child_thread_data_exchange
+            && ( get_thread_id_for_obj( obj_index ) != 0 ) );
+}
+
 /*! @brief Get the data cycle time for the configured object index or return
  * the default data cycle time otherwise. */
 int64_t const Federate::get_data_cycle_time_micros_for_obj(
@@ -4666,6 +5374,13 @@ bool const Federate::on_data_cycle_boundary_for_obj(
  */
 void Federate::wait_for_time_advance_grant()
 {
+   THLA_TRACE_SCOPE( "frame", "wait_for_time_advance_grant", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "wait_for_time_advance_grant" );
+
+   // Deliver the evoked callbacks that arrived during the last frame, which
+   // is also the only frame point for a federate without time management.
+   deliver_evoked_callbacks();
+
    // Skip requesting time-advancement if time management is not enabled.
    if ( !this->time_management ) {
       return;
@@ -4681,11 +5396,26 @@ void Federate::wait_for_time_advance_grant()
    }
 
    unsigned short state;
+   bool           batched_frame;
    {
       // When auto_unlock_mutex goes out of scope it automatically unlocks the
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
       state = this->time_adv_state;
+
+      // The frames before the time of a batched request run locally.
+      batched_frame = ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH )
+                      && ( this->batch_frame_time < this->requested_time );
+   }
+
+   if ( batched_frame ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::wait_for_time_advance_grant():%d Running the \
+frame at %.12G seconds locally until the batched request for %.12G seconds.%c",
+                  __LINE__, batch_frame_time.get_time_in_seconds(),
+                  requested_time.get_time_in_seconds(), THLA_NEWLINE );
+      }
+      return;
    }
 
    if ( state == TIME_ADVANCE_RESET ) {
@@ -4696,6 +5426,33 @@ void Federate::wait_for_time_advance_grant()
       return;
    }
 
+   // Only the wait in this frame holds us back, since the batched frames
+   // before it ran while the request was outstanding.
+   if ( ( this->time_advance_mode == TIME_ADVANCE_MODE_BATCH ) && ( this->tar_begin_ns != 0 ) ) {
+      this->tar_begin_ns = LatencyHistogram::now();
+   }
+
+   // Let the models run while the grant is pending if they only need the
+   // received data at the end of their step, and wait for it later in
+   // wait_for_pipelined_time_advance_grant().
+   if ( this->pipelined_time_advance
+        && !this->pipelined_grant_pending
+        && ( state != TIME_ADVANCE_GRANTED )
+        && ( this->time_advance_mode == TIME_ADVANCE_MODE_TAR )
+        && !is_zero_lookahead_time()
+        && ( manager != NULL )
+        && manager->is_late_data_dependence_only() ) {
+
+      this->pipelined_grant_pending = true;
+
+      if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::wait_for_time_advance_grant():%d Running the \
+frame while the Time Advance Grant to %.12G seconds is pending.%c",
+                  __LINE__, requested_time.get_time_in_seconds(), THLA_NEWLINE );
+      }
+      return;
+   }
+
    if ( state != TIME_ADVANCE_GRANTED ) {
 
       if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
@@ -4746,15 +5503,276 @@ void Federate::wait_for_time_advance_grant()
                send_hs( stdout, "Federate::wait_for_time_advance_grant():%d Waiting...%c",
                         __LINE__, THLA_NEWLINE );
             }
+
+            // Once the wait is a stall, ask who is holding back the grant
+            // while we are still waiting for it.
+            if ( !this->stall_queried
+                 && stall_profiler.is_initialized()
+                 && ( this->tar_begin_ns != 0 )
+                 && ( ( LatencyHistogram::now() - this->tar_begin_ns ) >= stall_profiler.get_stall_threshold_ns() ) ) {
+               query_time_stall_state();
+            }
          }
       } while ( state != TIME_ADVANCE_GRANTED );
    }
 
+   // A pipelined frame has its grant now, even if the
+   // wait_for_pipelined_time_advance_grant() job is not scheduled.
+   this->pipelined_grant_pending = false;
+
    // Add the line number for a higher trace level.
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "Federate::wait_for_time_advance_grant():%d Time Advance Grant (TAG) to %.12G seconds.%c",
                __LINE__, this->granted_time.get_time_in_seconds(), THLA_NEWLINE );
    }
+
+   if ( this->tar_begin_ns != 0 ) {
+      int64_t const now_ns = LatencyHistogram::now();
+
+      metrics_registry.record_time_advance_grant( now_ns - this->tar_begin_ns,
+                                                  this->granted_time.get_time_in_micros() );
+
+      ++this->lookahead_window_waits;
+      this->lookahead_window_wait_ns += now_ns - this->tar_begin_ns;
+
+      if ( this->latency_stats ) {
+         tag_wait_stats.record( now_ns - this->tar_begin_ns );
+
+         // Print the latency percentiles periodically if requested.
+         if ( this->latency_stats_report_period > 0.0 ) {
+            if ( this->next_latency_stats_report_ns == 0 ) {
+               this->next_latency_stats_report_ns = now_ns + (int64_t)( this->latency_stats_report_period * 1.0e9 );
+            } else if ( now_ns >= this->next_latency_stats_report_ns ) {
+               this->next_latency_stats_report_ns = now_ns + (int64_t)( this->latency_stats_report_period * 1.0e9 );
+               print_latency_stats();
+            }
+         }
+      }
+
+      if ( stall_profiler.is_initialized() ) {
+         stall_profiler.record_wait( now_ns - this->tar_begin_ns,
+                                     this->requested_time.get_time_in_micros(),
+                                     this->stall_GALT_micros );
+         this->stall_GALT_micros = -1;
+         this->stall_queried     = false;
+
+         // Print the stall report periodically if requested.
+         if ( this->stall_report_period > 0.0 ) {
+            if ( this->next_stall_report_ns == 0 ) {
+               this->next_stall_report_ns = now_ns + (int64_t)( this->stall_report_period * 1.0e9 );
+            } else if ( now_ns >= this->next_stall_report_ns ) {
+               this->next_stall_report_ns = now_ns + (int64_t)( this->stall_report_period * 1.0e9 );
+               print_time_stall_report();
+            }
+         }
+      }
+      this->tar_begin_ns = 0;
+   }
+
+   // Now is a safe point to change the lookahead, since we are not in the
+   // time advancing state and have not sent any data for this frame yet.
+   if ( this->adaptive_lookahead && this->time_regulating_state ) {
+      update_adaptive_lookahead();
+   }
+}
+
+/*!
+ * @details This must be scheduled after the model jobs and before the data is
+ * sent for the frame, since the sends use the granted time.
+ * @job_class{scheduled}
+ */
+void Federate::wait_for_pipelined_time_advance_grant()
+{
+   // Nothing to do if the frame waited for its grant at the start.
+   if ( !this->pipelined_grant_pending ) {
+      return;
+   }
+
+   // Only the blocking wait holds us back, since the model compute before
+   // it overlapped the outstanding request.
+   if ( this->tar_begin_ns != 0 ) {
+      this->tar_begin_ns = LatencyHistogram::now();
+   }
+
+   // The pending flag makes this a blocking wait, which clears the flag
+   // once the grant arrives.
+   wait_for_time_advance_grant();
+
+   // Now receive the data and interactions the frame ran ahead of, which
+   // applies the receive side lag compensation of each object.
+   if ( manager != NULL ) {
+      manager->receive_cyclic_data();
+      manager->process_interactions();
+   }
+}
+
+/*!
+ * @details The percentiles are cumulative since the start of the run. The
+ * objects and interactions with no recorded values are not shown.
+ */
+void Federate::print_latency_stats()
+{
+   ostringstream msg;
+   msg << "Federate::print_latency_stats():" << __LINE__
+       << " Latency percentiles at simulation-time " << exec_get_sim_time()
+       << " seconds:" << endl
+       << "  TAR to TAG wait: " << tag_wait_stats.to_string() << endl;
+
+   if ( manager != NULL ) {
+      if ( manager->interaction_stats.get_count() > 0 ) {
+         msg << "  Interaction processing: " << manager->interaction_stats.to_string() << endl;
+      }
+      for ( int n = 0; n < manager->obj_count; ++n ) {
+         Object const &obj = manager->objects[n];
+         if ( obj.blocking_read_stats.get_count() > 0 ) {
+            msg << "  Object '" << obj.name << "' blocking read wait: "
+                << obj.blocking_read_stats.to_string() << endl;
+         }
+         if ( obj.pack_stats.get_count() > 0 ) {
+            msg << "  Object '" << obj.name << "' pack: "
+                << obj.pack_stats.to_string() << endl;
+         }
+         if ( obj.send_stats.get_count() > 0 ) {
+            msg << "  Object '" << obj.name << "' send: "
+                << obj.send_stats.to_string() << endl;
+         }
+         if ( obj.unpack_stats.get_count() > 0 ) {
+            msg << "  Object '" << obj.name << "' unpack: "
+                << obj.unpack_stats.to_string() << endl;
+         }
+      }
+   }
+   send_hs( stdout, (char *)msg.str().c_str() );
+}
+
+/*!
+ * @details The stall report is cumulative since the start of the run.
+ */
+void Federate::print_time_stall_report()
+{
+   ostringstream msg;
+   msg << "Federate::print_time_stall_report():" << __LINE__
+       << " Time Advance Grant stalls at simulation-time " << exec_get_sim_time()
+       << " seconds:" << endl
+       << stall_profiler.to_string();
+   send_hs( stdout, (char *)msg.str().c_str() );
+}
+
+/*!
+ * @details The HLAfederate MOM object has no attribute for the time a
+ * federate was last granted, so HLAlogicalTime, which the RTI updates on
+ * every grant, is used with HLAlookahead to find the federate limiting the
+ * GALT. A missing MOM attribute disables the profiler with a warning.
+ * @job_class{initialization}
+ */
+void Federate::setup_time_stall_profiler()
+{
+   // Make sure the MOM handles get initialized before we try to use them.
+   if ( !MOM_HLAfederateName_handle.isValid() ) {
+      initialize_MOM_handles();
+   }
+
+   wchar_t const *attr_names[4] = { L"HLAlogicalTime",
+                                    L"HLAlookahead",
+                                    L"HLAtimeRegulating",
+                                    L"HLAtimeConstrained" };
+   AttributeHandle attr_handles[4];
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   bool error_flag = false;
+   for ( int i = 0; ( i < 4 ) && !error_flag; ++i ) {
+      try {
+         attr_handles[i] = RTI_ambassador->getAttributeHandle( MOM_HLAfederate_class_handle, attr_names[i] );
+      } catch ( RTI1516_EXCEPTION const &e ) {
+         error_flag = true;
+
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         string attr_name;
+         StringUtilities::to_string( attr_name, wstring( attr_names[i] ) );
+         send_hs( stderr, "Federate::setup_time_stall_profiler():%d WARNING: \
+Disabling the time stall profiler since getting the MOM HLAfederate '%s' \
+attribute handle failed: '%s'%c",
+                  __LINE__, attr_name.c_str(), rti_err_msg.c_str(), THLA_NEWLINE );
+      }
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   if ( error_flag ) {
+      this->time_stall_profiler = false;
+      return;
+   }
+
+   if ( this->stall_threshold < 0.0 ) {
+      this->stall_threshold = 0.0;
+   }
+
+   stall_MOM_attributes.clear();
+   stall_MOM_attributes.insert( MOM_HLAfederateName_handle );
+   for ( int i = 0; i < 4; ++i ) {
+      stall_MOM_attributes.insert( attr_handles[i] );
+   }
+
+   wstring own_name;
+   StringUtilities::to_wstring( own_name, this->name );
+
+   stall_profiler.initialize( own_name,
+                              (int64_t)( this->stall_threshold * 1.0e9 ),
+                              MOM_HLAfederateName_handle,
+                              attr_handles[0],
+                              attr_handles[1],
+                              attr_handles[2],
+                              attr_handles[3] );
+
+   subscribe_attributes( MOM_HLAfederate_class_handle, stall_MOM_attributes );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      send_hs( stdout, "Federate::setup_time_stall_profiler():%d Profiling the \
+Time Advance Grant waits of %.6f seconds or more.%c",
+               __LINE__, this->stall_threshold, THLA_NEWLINE );
+   }
+}
+
+/*!
+ * @details The MOM values arrive in the RTI callbacks while we keep waiting
+ * for the grant, and the GALT tells which time the grant is held back to.
+ */
+void Federate::query_time_stall_state()
+{
+   this->stall_queried = true;
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   try {
+      HLAinteger64Time time;
+      if ( RTI_ambassador->queryGALT( time ) ) {
+         this->stall_GALT_micros = time.getTime();
+      }
+
+      // A failed request only costs us the limiting federate of this stall,
+      // so unlike request_attribute_update() it must not terminate.
+      RTI_ambassador->requestAttributeValueUpdate( MOM_HLAfederate_class_handle,
+                                                   stall_MOM_attributes,
+                                                   RTI1516_USERDATA( 0, 0 ) );
+   } catch ( RTI1516_EXCEPTION const &e ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         send_hs( stderr, "Federate::query_time_stall_state():%d WARNING: \
+Querying the time state for the stall failed: '%s'%c",
+                  __LINE__, rti_err_msg.c_str(), THLA_NEWLINE );
+      }
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
 /*!
@@ -4818,6 +5836,50 @@ void Federate::shutdown()
       }
 #endif
 
+      if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         send_hs( stdout, "Federate::shutdown():%d %s%c", __LINE__,
+                  thread_coordinator.get_summary().c_str(), THLA_NEWLINE );
+         if ( this->evoked_callbacks ) {
+            send_hs( stdout, "Federate::shutdown():%d %s%c", __LINE__,
+                     EvokedCallbacks::get_summary().c_str(), THLA_NEWLINE );
+         }
+      }
+
+      // Send any queued attribute updates and stop the publisher thread
+      // before we resign from the federation.
+      async_publisher.stop();
+
+      // Dump the latency percentiles.
+      if ( this->latency_stats ) {
+         print_latency_stats();
+      }
+
+      // Dump the federates that held back our time advance grants.
+      if ( stall_profiler.is_initialized() ) {
+         print_time_stall_report();
+      }
+
+      // Dump the allocations made in the real-time frames.
+      if ( this->allocation_guard && AllocationGuard::is_built_in() ) {
+         AllocationGuard::disarm();
+         send_hs( stdout, "Federate::shutdown():%d Allocation guard:%c%s",
+                  __LINE__, THLA_NEWLINE, AllocationGuard::to_string().c_str() );
+      }
+
+      // Remove the runtime metrics shared memory segment.
+      metrics_registry.shutdown();
+
+#if defined( THLA_FRAME_TRACING )
+      // Write out the recorded frame phases.
+      if ( this->trace_frame_phases && ( trace_file != NULL ) ) {
+         if ( TraceRecorder::write_chrome_trace( trace_file )
+              && DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+            send_hs( stdout, "Federate::shutdown():%d Wrote the frame phase trace to '%s'.%c",
+                     __LINE__, trace_file, THLA_NEWLINE );
+         }
+      }
+#endif
+
       // Macro to save the FPU Control Word register value.
       TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -4872,6 +5934,9 @@ contact the TrickHLA team for support.%c",
                   THLA_NEWLINE );
       }
 #endif
+
+      // Write any queued debug messages and stop the writer thread.
+      AsyncLogger::stop();
    }
 }
 
@@ -5414,6 +6479,9 @@ void Federate::destroy()
                   __LINE__, THLA_NEWLINE );
       }
 
+      // Nothing can be evoked once we are disconnected.
+      EvokedCallbacks::disable();
+
       RTI_ambassador->disconnect();
 
       this->federation_exists = false;
@@ -6467,8 +7535,9 @@ void Federate::restart_checkpoint()
       // mutex even if there is an exception.
       MutexProtection auto_unlock_mutex( &time_adv_state_mutex );
 
-      this->requested_time  = this->granted_time;
-      this->restore_process = No_Restore;
+      this->requested_time   = this->granted_time;
+      this->batch_frame_time = this->granted_time;
+      this->restore_process  = No_Restore;
    }
 
    reinstate_logged_sync_pts();
@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, July 2020, --, Changed function names to match TrickHLA coding style.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added Int64TimeValue conversions.}
 @revs_end
 
 */
@@ -85,6 +86,16 @@ Int64Time::Int64Time(
    return;
 }
 
+/*!
+ * @job_class{initialization}
+ */
+Int64Time::Int64Time(
+   Int64TimeValue const &value )
+   : hla_time( value.get_time_in_micros() )
+{
+   return;
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -165,3 +176,9 @@ void Int64Time::set(
 {
    hla_time = value.get_time_in_micros();
 }
+
+void Int64Time::set(
+   Int64TimeValue const &value )
+{
+   hla_time.setTime( value.get_time_in_micros() );
+}
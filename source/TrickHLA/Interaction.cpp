@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{InteractionHandler.cpp}
 @trick_link_dependency{InteractionItem.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MetricsRegistry.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Parameter.cpp}
@@ -34,6 +35,8 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Aug 2006, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Send distance for the adaptive lookahead.}
 @revs_end
 
 */
@@ -58,6 +61,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/InteractionHandler.hh"
 #include "TrickHLA/InteractionItem.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Parameter.hh"
@@ -96,7 +100,8 @@ Interaction::Interaction()
      manager( NULL ),
      user_supplied_tag_size( 0 ),
      user_supplied_tag_capacity( 0 ),
-     user_supplied_tag( NULL )
+     user_supplied_tag( NULL ),
+     metrics( NULL )
 {
    return;
 }
@@ -898,6 +903,10 @@ bool Interaction::send(
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+   if ( successfuly_sent && ( metrics != NULL ) ) {
+      record_sent_metrics( param_values_map );
+   }
+
    // Free the memory used in the parameter values map.
    param_values_map.clear();
 
@@ -980,6 +989,9 @@ bool Interaction::send(
                                             time.get() );
             successfuly_sent = true;
 
+            federate->record_send_distance( time.get_time_in_micros()
+                                            - federate->get_granted_time().get_time_in_micros() );
+
          } else {
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
                send_hs( stdout, "Interaction::send():%d As Receive-Order: \
@@ -1026,12 +1038,29 @@ Interaction '%s' is time-regulating:%s, preferred-order:%s.%c",
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+   if ( successfuly_sent && ( metrics != NULL ) ) {
+      record_sent_metrics( param_values_map );
+   }
+
    // Free the memory used in the parameter values map.
    param_values_map.clear();
 
    return ( successfuly_sent );
 }
 
+void Interaction::record_sent_metrics(
+   ParameterHandleValueMap const &param_values_map )
+{
+   size_t total_bytes = 0;
+
+   ParameterHandleValueMap::const_iterator iter;
+   for ( iter = param_values_map.begin(); iter != param_values_map.end(); ++iter ) {
+      total_bytes += iter->second.size();
+   }
+   MetricsRegistry::add( metrics->updates_sent, 1 );
+   MetricsRegistry::add( metrics->bytes_sent, total_bytes );
+}
+
 void Interaction::process_interaction()
 {
    // The Interaction data must have changed and the RTI must be ready.
@@ -0,0 +1,222 @@
+/*!
+@file TrickHLA/LatencyHistogram.cpp
+@ingroup TrickHLA
+@brief This class is a fixed memory, lock-free latency histogram that reports
+percentiles.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// TrickHLA include files.
+#include "TrickHLA/LatencyHistogram.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+LatencyHistogram::LatencyHistogram()
+   : total_count( 0 ),
+     total_sum( 0 ),
+     min_value( INT64_MAX ),
+     max_value( 0 )
+{
+   for ( unsigned int i = 0; i < THLA_LATENCY_HISTOGRAM_BUCKET_COUNT; ++i ) {
+      counts[i] = 0;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+LatencyHistogram::~LatencyHistogram()
+{
+   return;
+}
+
+int64_t LatencyHistogram::now()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ( ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec );
+}
+
+/*!
+ * @details The bucket count is the only thing a percentile needs, so the
+ * other totals are only updated with relaxed atomics and the minimum and
+ * maximum are updated with a compare-and-swap loop that only runs when the
+ * value is a new extreme.
+ */
+void LatencyHistogram::record(
+   int64_t const value_ns )
+{
+   int64_t const value = ( value_ns > 0 ) ? value_ns : 0;
+
+   __atomic_add_fetch( &counts[get_bucket_index( (uint64_t)value )], 1, __ATOMIC_RELAXED );
+   __atomic_add_fetch( &total_sum, (unsigned long long)value, __ATOMIC_RELAXED );
+   __atomic_add_fetch( &total_count, 1, __ATOMIC_RELAXED );
+
+   int64_t current = __atomic_load_n( &min_value, __ATOMIC_RELAXED );
+   while ( ( value < current )
+           && !__atomic_compare_exchange_n( &min_value, &current, value, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+   }
+   current = __atomic_load_n( &max_value, __ATOMIC_RELAXED );
+   while ( ( value > current )
+           && !__atomic_compare_exchange_n( &max_value, &current, value, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+   }
+}
+
+void LatencyHistogram::reset()
+{
+   for ( unsigned int i = 0; i < THLA_LATENCY_HISTOGRAM_BUCKET_COUNT; ++i ) {
+      __atomic_store_n( &counts[i], 0, __ATOMIC_RELAXED );
+   }
+   __atomic_store_n( &total_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &total_sum, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &min_value, INT64_MAX, __ATOMIC_RELAXED );
+   __atomic_store_n( &max_value, 0, __ATOMIC_RELAXED );
+}
+
+unsigned long long const LatencyHistogram::get_count() const
+{
+   return __atomic_load_n( &total_count, __ATOMIC_RELAXED );
+}
+
+int64_t const LatencyHistogram::get_min() const
+{
+   int64_t const value = __atomic_load_n( &min_value, __ATOMIC_RELAXED );
+   return ( value == INT64_MAX ) ? 0 : value;
+}
+
+int64_t const LatencyHistogram::get_max() const
+{
+   return __atomic_load_n( &max_value, __ATOMIC_RELAXED );
+}
+
+double const LatencyHistogram::get_mean() const
+{
+   unsigned long long const count = get_count();
+   if ( count == 0 ) {
+      return 0.0;
+   }
+   return (double)__atomic_load_n( &total_sum, __ATOMIC_RELAXED ) / (double)count;
+}
+
+/*!
+ * @details The total is summed from the buckets rather than taken from the
+ * total count so the result is consistent even while values are being
+ * recorded. The highest value of the bucket is reported, limited to the
+ * maximum value recorded.
+ */
+int64_t const LatencyHistogram::get_value_at_percentile(
+   double const percentile ) const
+{
+   unsigned long long total = 0;
+   for ( unsigned int i = 0; i < THLA_LATENCY_HISTOGRAM_BUCKET_COUNT; ++i ) {
+      total += __atomic_load_n( &counts[i], __ATOMIC_RELAXED );
+   }
+   if ( total == 0 ) {
+      return 0;
+   }
+
+   double const p = ( percentile < 0.0 ) ? 0.0 : ( ( percentile > 100.0 ) ? 100.0 : percentile );
+
+   unsigned long long target = (unsigned long long)( ( p / 100.0 ) * (double)total + 0.5 );
+   if ( target < 1 ) {
+      target = 1;
+   }
+
+   int64_t const      max   = get_max();
+   unsigned long long count = 0;
+   for ( unsigned int i = 0; i < THLA_LATENCY_HISTOGRAM_BUCKET_COUNT; ++i ) {
+      count += __atomic_load_n( &counts[i], __ATOMIC_RELAXED );
+      if ( count >= target ) {
+         int64_t const value = get_bucket_highest_value( i );
+         return ( value < max ) ? value : max;
+      }
+   }
+   return max;
+}
+
+std::string const LatencyHistogram::to_string() const
+{
+   ostringstream msg;
+   msg << fixed << setprecision( 3 )
+       << "count:" << get_count()
+       << " min:" << ( get_min() / 1000.0 )
+       << " p50:" << ( get_value_at_percentile( 50.0 ) / 1000.0 )
+       << " p90:" << ( get_value_at_percentile( 90.0 ) / 1000.0 )
+       << " p99:" << ( get_value_at_percentile( 99.0 ) / 1000.0 )
+       << " p99.9:" << ( get_value_at_percentile( 99.9 ) / 1000.0 )
+       << " max:" << ( get_max() / 1000.0 )
+       << " mean:" << ( get_mean() / 1000.0 )
+       << " microseconds";
+   return msg.str();
+}
+
+/*!
+ * @details Values below the sub-bucket count map directly to a bucket. For a
+ * larger value, the shift is how far the value has to be shifted right to
+ * leave only its top THLA_LATENCY_HISTOGRAM_SUB_BUCKET_BITS bits, and each
+ * shift amount has half the sub-bucket count of buckets.
+ */
+unsigned int const LatencyHistogram::get_bucket_index(
+   uint64_t const value_ns )
+{
+   if ( value_ns < THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT ) {
+      return (unsigned int)value_ns;
+   }
+   if ( value_ns >= ( 1ULL << THLA_LATENCY_HISTOGRAM_MAX_VALUE_BITS ) ) {
+      return ( THLA_LATENCY_HISTOGRAM_BUCKET_COUNT - 1 );
+   }
+
+   unsigned int const msb   = 63 - __builtin_clzll( value_ns );
+   unsigned int const shift = msb - ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_BITS - 1 );
+   unsigned int const sub   = (unsigned int)( value_ns >> shift );
+
+   return ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT
+            + ( ( shift - 1 ) * ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 ) )
+            + ( sub - ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 ) ) );
+}
+
+int64_t const LatencyHistogram::get_bucket_highest_value(
+   unsigned int const index )
+{
+   if ( index < THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT ) {
+      return (int64_t)index;
+   }
+   unsigned int const offset = index - THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT;
+   unsigned int const shift  = ( offset / ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 ) ) + 1;
+   unsigned int const sub    = ( offset % ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 ) )
+                            + ( THLA_LATENCY_HISTOGRAM_SUB_BUCKET_COUNT / 2 );
+
+   return ( ( (int64_t)sub << shift ) + ( ( (int64_t)1 << shift ) - 1 ) );
+}
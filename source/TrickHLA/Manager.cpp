@@ -15,6 +15,7 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AllocationGuard.cpp}
 @trick_link_dependency{Attribute.cpp}
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{ExecutionConfigurationBase.cpp}
@@ -24,13 +25,17 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Int64Time.cpp}
 @trick_link_dependency{Interaction.cpp}
 @trick_link_dependency{InteractionItem.cpp}
+@trick_link_dependency{LatencyHistogram.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MetricsRegistry.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Object.cpp}
+@trick_link_dependency{OpaqueBuffer.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{TraceRecorder.cpp}
 @trick_link_dependency{Types.cpp}
 
 @revs_title
@@ -39,6 +44,20 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, Jan 2019, --, SRFOM support and testing.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer memory report and shrink hook.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional front/back attribute buffers.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Child thread object data exchange.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Interaction processing latency histogram.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Send distance for the adaptive lookahead.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frames to the next send for batched time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Pipelined time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Integer update times with a per frame HLA time cache.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time memory preparation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Single threaded data path for evoked callbacks.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Persistent HLA time caches for the Trick child threads.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Swap the attribute encode buffers once per frame.}
 @revs_end
 
 */
@@ -51,9 +70,11 @@ NASA, Johnson Space Center\n
 // Trick include files.
 #include "trick/Executive.hh"
 #include "trick/MemoryManager.hh"
+#include "trick/exec_proto.h"
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AllocationGuard.hh"
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Constants.hh"
@@ -63,16 +84,22 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
+#include "TrickHLA/Int64TimeValue.hh"
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/LatencyHistogram.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
 #include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/StringStorage.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TraceRecorder.hh"
 #include "TrickHLA/Types.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -120,6 +147,9 @@ Manager::Manager()
      check_interactions_count( 0 ),
      check_interactions( NULL ),
      job_cycle_time_micros( 0LL ),
+     update_time_cache(),
+     thread_time_caches( NULL ),
+     thread_time_cache_cnt( 0 ),
      rejoining_federate( false ),
      restore_determined( false ),
      restore_federate( false ),
@@ -127,6 +157,7 @@ Manager::Manager()
      obj_discovery_mutex(),
      object_map(),
      federate_has_been_restored( false ),
+     interaction_stats(),
      federate( NULL ),
      execution_control( NULL )
 {
@@ -142,6 +173,12 @@ Manager::~Manager()
    object_map.clear();
    clear_interactions();
 
+   if ( thread_time_caches != NULL ) {
+      delete[] thread_time_caches;
+      thread_time_caches    = NULL;
+      thread_time_cache_cnt = 0;
+   }
+
    // Make sure we unlock the mutex.
    (void)obj_discovery_mutex.unlock();
 }
@@ -262,6 +299,17 @@ void Manager::initialize()
       inter_count = 0;
    }
 
+   // Allocate a persistent HLA time cache for each Trick thread (main + child)
+   // so the child threads that send their own objects do not construct the
+   // RTI time objects every frame.
+   if ( thread_time_caches == NULL ) {
+      thread_time_cache_cnt = exec_get_num_threads();
+      if ( thread_time_cache_cnt == 0 ) {
+         thread_time_cache_cnt = 1;
+      }
+      thread_time_caches = new Int64TimeCache[thread_time_cache_cnt];
+   }
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 
@@ -1055,6 +1103,9 @@ void Manager::setup_object_ref_attributes(
          // Initialize the TrickHLA-Attribute before we use it.
          attrs[i].initialize( data_objects[n].get_FOM_name(), n, i );
 
+         // Only objects that opt in get the additional buffers.
+         attrs[i].set_buffer_slots( data_objects[n].buffer_slots );
+
          if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             msg << "   " << ( i + 1 ) << "/" << attr_count
                 << " FOM-Attribute:'" << attrs[i].get_FOM_name() << "'"
@@ -2300,20 +2351,28 @@ void Manager::determine_job_cycle_time()
  */
 void Manager::send_cyclic_and_requested_data()
 {
+   THLA_TRACE_SCOPE( "frame", "send_cyclic_and_requested_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "send_cyclic_and_requested_data" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::send_cyclic_and_requested_data():%d%c",
                __LINE__, THLA_NEWLINE );
    }
 
+   // The granted time, or the requested time while a batched Time Advance
+   // Request is outstanding since the RTI only takes later timestamps.
    int64_t const sim_time_micros     = Int64Interval::to_microseconds( exec_get_sim_time() );
-   int64_t const granted_time_micros = get_granted_time_in_micros();
+   int64_t const granted_time_micros = federate->get_send_base_time_in_micros();
    bool const    zero_lookahead      = federate->is_zero_lookahead_time();
 
-   // Initial time values.
-   int64_t   dt      = zero_lookahead ? 0LL : get_lookahead_time_in_micros();
-   int64_t   prev_dt = dt;
-   Int64Time granted_plus_lookahead( granted_time_micros + dt );
-   Int64Time update_time( granted_plus_lookahead );
+   // Initial time values, where the time arithmetic is done on integers and
+   // the HLA time is only created once per frame for each update time.
+   int64_t              dt      = zero_lookahead ? 0LL : get_lookahead_time_in_micros();
+   int64_t              prev_dt = dt;
+   Int64TimeValue const granted_plus_lookahead( granted_time_micros + dt );
+   Int64TimeValue       update_time( granted_plus_lookahead );
+
+   this->update_time_cache.clear();
 
    // Determine the main thread cycle time for this job if it is not yet known.
    if ( this->job_cycle_time_micros <= 0LL ) {
@@ -2356,19 +2415,21 @@ void Manager::send_cyclic_and_requested_data()
 
          // Make sure the update time is not less than the granted time + lookahead.
          if ( update_time < granted_plus_lookahead ) {
-            update_time.set( granted_plus_lookahead );
+            update_time = granted_plus_lookahead;
          }
       }
    }
 
    // Send any ExecutionControl data requested.
-   this->execution_control->send_requested_data( update_time );
+   this->execution_control->send_requested_data( update_time_cache.get( update_time ) );
 
    // Send data to remote RTI federates for each of the objects.
    for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
 
-      // Only send data if we are on the data cycle time boundary for this object.
-      if ( this->federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_micros ) ) {
+      // Only send data if we are on the data cycle time boundary for this
+      // object, and the object is not sent by its Trick child thread.
+      if ( this->federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_micros )
+           && !this->federate->is_obj_exchanged_by_child_thread( obj_index ) ) {
 
          // Only update the time if time management is enabled.
          if ( federate->is_time_management_enabled() ) {
@@ -2379,6 +2440,10 @@ void Manager::send_cyclic_and_requested_data()
                                 : this->federate->get_data_cycle_time_micros_for_obj(
                                    obj_index, this->job_cycle_time_micros );
 
+            // The data cycle time is how far ahead we want to send, for the
+            // adaptive lookahead.
+            this->federate->record_send_distance( dt );
+
             // Reuse the update_time if the data cycle time (dt) is the same.
             if ( dt != prev_dt ) {
                prev_dt = dt;
@@ -2387,13 +2452,21 @@ void Manager::send_cyclic_and_requested_data()
 
                // Make sure the update time is not less than the granted time + lookahead.
                if ( update_time < granted_plus_lookahead ) {
-                  update_time.set( granted_plus_lookahead );
+                  update_time = granted_plus_lookahead;
                }
             }
          }
 
          // Send the data for the object.
-         objects[obj_index].send_cyclic_and_requested_data( update_time );
+         THLA_TRACE_SCOPE( "object", "send_object", (int)obj_index, -1 );
+         objects[obj_index].send_cyclic_and_requested_data( update_time_cache.get( update_time ) );
+      }
+   }
+   // Publish the attribute values packed this frame now that all the sends
+   // are done.
+   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+      if ( !this->federate->is_obj_exchanged_by_child_thread( obj_index ) ) {
+         objects[obj_index].swap_attribute_buffers();
       }
    }
 }
@@ -2410,11 +2483,19 @@ void Manager::send_cyclic_and_requested_data()
  */
 void Manager::receive_cyclic_data()
 {
+   THLA_TRACE_SCOPE( "frame", "receive_cyclic_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "receive_cyclic_data" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       send_hs( stdout, "Manager::receive_cyclic_data():%d%c",
                __LINE__, THLA_NEWLINE );
    }
 
+   // The data of a pipelined frame is received once the grant arrives.
+   if ( federate->is_pipelined_grant_pending() ) {
+      return;
+   }
+
    int64_t const sim_time_micros = Int64Interval::to_microseconds( exec_get_sim_time() );
 
    // Receive and process any updates for ExecutionControl.
@@ -2423,8 +2504,186 @@ void Manager::receive_cyclic_data()
    // Receive data from remote RTI federates for each of the objects.
    for ( unsigned int n = 0; n < obj_count; ++n ) {
 
-      // Only receive data if we are on the data cycle time boundary for this object.
-      if ( this->federate->on_data_cycle_boundary_for_obj( n, sim_time_micros ) ) {
+      // Only receive data if we are on the data cycle time boundary for this
+      // object, and the object is not received by its Trick child thread.
+      if ( this->federate->on_data_cycle_boundary_for_obj( n, sim_time_micros )
+           && !this->federate->is_obj_exchanged_by_child_thread( n ) ) {
+         THLA_TRACE_SCOPE( "object", "receive_object", (int)n, -1 );
+         objects[n].receive_cyclic_data();
+      }
+   }
+}
+
+/*!
+ * @details This is called from the Trick child thread before it is marked as
+ * ready to send, while the Trick main thread is waiting on it, so the granted
+ * time will not change while the update times are determined.
+ * @job_class{scheduled}
+ */
+void Manager::send_cyclic_and_requested_data_for_child_thread(
+   unsigned int const thread_id )
+{
+   THLA_TRACE_SCOPE( "frame", "send_cyclic_and_requested_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "send_cyclic_and_requested_data" );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::send_cyclic_and_requested_data_for_child_thread():%d Thread:%d%c",
+               __LINE__, thread_id, THLA_NEWLINE );
+   }
+
+   // The granted time, or the requested time while a batched Time Advance
+   // Request is outstanding since the RTI only takes later timestamps.
+   int64_t const sim_time_micros     = Int64Interval::to_microseconds( exec_get_sim_time() );
+   int64_t const granted_time_micros = federate->get_send_base_time_in_micros();
+   bool const    zero_lookahead      = federate->is_zero_lookahead_time();
+
+   if ( thread_id >= this->thread_time_cache_cnt ) {
+      ostringstream errmsg;
+      errmsg << "Manager::send_cyclic_and_requested_data_for_child_thread():" << __LINE__
+             << " ERROR: The Trick thread-id:" << thread_id << " is not less"
+             << " than the number of Trick threads:" << this->thread_time_cache_cnt
+             << " the Manager was initialized with!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // The child threads send at the same time, so each thread converts its
+   // update times with its own cache.
+   Int64TimeCache &thread_time_cache = this->thread_time_caches[thread_id];
+   thread_time_cache.clear();
+
+   // Initial time values.
+   int64_t              dt      = zero_lookahead ? 0LL : get_lookahead_time_in_micros();
+   int64_t              prev_dt = dt;
+   Int64TimeValue const granted_plus_lookahead( granted_time_micros + dt );
+   Int64TimeValue       update_time( granted_plus_lookahead );
+
+   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+
+      // Only send the objects associated to this thread that are on the data
+      // cycle time boundary.
+      if ( ( this->federate->get_thread_id_for_obj( obj_index ) == thread_id )
+           && this->federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_micros ) ) {
+
+         // Only update the time if time management is enabled.
+         if ( federate->is_time_management_enabled() ) {
+
+            // The update time is the granted time plus the data cycle time
+            // of the object, but not less than the granted time + lookahead.
+            dt = zero_lookahead ? 0LL
+                                : this->federate->get_data_cycle_time_micros_for_obj(
+                                   obj_index, this->job_cycle_time_micros );
+
+            // The data cycle time is how far ahead we want to send, for the
+            // adaptive lookahead.
+            this->federate->record_send_distance( dt );
+
+            // Reuse the update_time if the data cycle time (dt) is the same.
+            if ( dt != prev_dt ) {
+               prev_dt = dt;
+
+               update_time.set( granted_time_micros + dt );
+
+               // Make sure the update time is not less than the granted time + lookahead.
+               if ( update_time < granted_plus_lookahead ) {
+                  update_time = granted_plus_lookahead;
+               }
+            }
+         }
+
+         // Send the data for the object.
+         THLA_TRACE_SCOPE( "object", "send_object", (int)obj_index, -1 );
+         objects[obj_index].send_cyclic_and_requested_data( thread_time_cache.get( update_time ) );
+      }
+   }
+   // Publish the attribute values this thread packed this frame.
+   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+      if ( this->federate->get_thread_id_for_obj( obj_index ) == thread_id ) {
+         objects[obj_index].swap_attribute_buffers();
+      }
+   }
+}
+
+/*!
+ * @details This must be called after the sends of the current frame, since
+ * the attribute sub-rate counters only advance when the object is sent on
+ * its data cycle. Objects that send no cyclic data do not limit the frames.
+ */
+unsigned int const Manager::get_frames_to_next_send(
+   int64_t const      frame_micros,
+   unsigned int const max_frames ) const
+{
+   if ( ( frame_micros <= 0LL ) || ( max_frames <= 1 ) ) {
+      return 1;
+   }
+
+   int64_t const sim_time_micros = Int64Interval::to_microseconds( exec_get_sim_time() );
+   unsigned int  frames          = max_frames;
+
+   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+
+      int const cycles = objects[obj_index].get_data_cycles_to_next_send();
+      if ( cycles <= 0 ) {
+         continue;
+      }
+
+      // Count the data cycles of the object over the coming frames.
+      int count = 0;
+      for ( unsigned int n = 1; n < frames; ++n ) {
+         if ( this->federate->on_data_cycle_boundary_for_obj( obj_index, sim_time_micros + ( n * frame_micros ) )
+              && ( ++count >= cycles ) ) {
+            frames = n;
+            break;
+         }
+      }
+      if ( frames == 1 ) {
+         break;
+      }
+   }
+   return frames;
+}
+
+/*!
+ * @details An object we receive cyclic data for without a late data
+ * dependence, or that a Trick child thread receives at the start of its
+ * frame, is a strict dependence that needs the blocking wait for the grant.
+ */
+bool const Manager::is_late_data_dependence_only()
+{
+   for ( unsigned int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+      if ( objects[obj_index].any_remotely_owned_subscribed_cyclic_attribute()
+           && ( !objects[obj_index].late_data_dependence
+                || this->federate->is_obj_exchanged_by_child_thread( obj_index ) ) ) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/*!
+ * @details This is called from the Trick child thread after the Trick main
+ * thread has announced the data for this frame is available.
+ * @job_class{scheduled}
+ */
+void Manager::receive_cyclic_data_for_child_thread(
+   unsigned int const thread_id )
+{
+   THLA_TRACE_SCOPE( "frame", "receive_cyclic_data", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "receive_cyclic_data" );
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      send_hs( stdout, "Manager::receive_cyclic_data_for_child_thread():%d Thread:%d%c",
+               __LINE__, thread_id, THLA_NEWLINE );
+   }
+
+   int64_t const sim_time_micros = Int64Interval::to_microseconds( exec_get_sim_time() );
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+
+      // Only receive the objects associated to this thread that are on the
+      // data cycle time boundary.
+      if ( ( this->federate->get_thread_id_for_obj( n ) == thread_id )
+           && this->federate->on_data_cycle_boundary_for_obj( n, sim_time_micros ) ) {
+         THLA_TRACE_SCOPE( "object", "receive_object", (int)n, -1 );
          objects[n].receive_cyclic_data();
       }
    }
@@ -2435,6 +2694,15 @@ void Manager::receive_cyclic_data()
  */
 void Manager::process_interactions()
 {
+   THLA_TRACE_SCOPE( "frame", "process_interactions", -1, -1 );
+   THLA_ALLOCATION_GUARD_SCOPE( "process_interactions" );
+
+   // The interactions of a pipelined frame are processed once the grant
+   // arrives, so they stay in timestamp order with the cyclic data.
+   if ( federate->is_pipelined_grant_pending() ) {
+      return;
+   }
+
    // Process any ExecutionControl mode transitions.
    this->execution_control->process_mode_interaction();
 
@@ -2463,9 +2731,17 @@ void Manager::process_interactions()
                  && ( interaction_item->index < inter_count )
                  && interactions[interaction_item->index].is_subscribe() ) {
 
+               THLA_TRACE_SCOPE( "interaction", "process_interaction", interaction_item->index, -1 );
+
+               int64_t const begin_ns = federate->is_latency_stats_enabled() ? LatencyHistogram::now() : 0;
+
                interactions[interaction_item->index].extract_data( interaction_item );
 
                interactions[interaction_item->index].process_interaction();
+
+               if ( begin_ns != 0 ) {
+                  interaction_stats.record_since( begin_ns );
+               }
             }
             break;
          }
@@ -2529,6 +2805,21 @@ void Manager::receive_interaction(
          // Add the interaction item to the queue.
          interactions_queue.push( item );
 
+         MetricsEntry *metrics = interactions[i].get_metrics();
+         if ( metrics != NULL ) {
+            size_t bytes = 0;
+
+            ParameterHandleValueMap::const_iterator iter;
+            for ( iter = theParameterValues.begin(); iter != theParameterValues.end(); ++iter ) {
+               bytes += iter->second.size();
+            }
+            MetricsRegistry::add( metrics->updates_received, 1 );
+            MetricsRegistry::add( metrics->bytes_received, bytes );
+            MetricsRegistry::add( metrics->reflections_queued, 1 );
+            MetricsRegistry::update_high_water( metrics->queue_depth_high_water,
+                                                (unsigned long long)interactions_queue.size() );
+         }
+
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             if ( received_as_TSO ) {
                Int64Time _time;
@@ -3257,3 +3548,159 @@ bool Manager::is_shutdown_called() const
 {
    return ( ( this->federate != NULL ) ? this->federate->is_shutdown_called() : false );
 }
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::print_buffer_memory_report()
+{
+   size_t total_capacity = 0;
+   size_t total_used     = 0;
+
+   ostringstream msg;
+   msg << "Manager::print_buffer_memory_report():" << __LINE__ << endl
+       << "================== BUFFER MEMORY REPORT ==================" << endl;
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      Attribute *attrs          = objects[n].get_attributes();
+      size_t     obj_capacity   = 0;
+      size_t     obj_used       = 0;
+      int const  obj_attr_count = objects[n].get_attribute_count();
+
+      for ( int i = 0; i < obj_attr_count; ++i ) {
+         obj_capacity += attrs[i].get_buffer_capacity();
+         obj_used += attrs[i].get_buffer_size();
+      }
+      msg << "Object '" << objects[n].get_name() << "' (FOM '"
+          << objects[n].get_FOM_name() << "') capacity:" << obj_capacity
+          << " used:" << obj_used << endl;
+
+      for ( int i = 0; i < obj_attr_count; ++i ) {
+         msg << "   Attribute '" << attrs[i].get_FOM_name() << "' capacity:"
+             << attrs[i].get_buffer_capacity() << " used:"
+             << attrs[i].get_buffer_size() << endl;
+      }
+      total_capacity += obj_capacity;
+      total_used += obj_used;
+   }
+
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      Parameter *params          = interactions[n].get_parameters();
+      size_t     inter_capacity  = 0;
+      size_t     inter_used      = 0;
+      int const  inter_param_cnt = interactions[n].get_parameter_count();
+
+      for ( int i = 0; i < inter_param_cnt; ++i ) {
+         inter_capacity += params[i].get_buffer_capacity();
+         inter_used += params[i].get_buffer_size();
+      }
+      msg << "Interaction '" << interactions[n].get_FOM_name() << "' capacity:"
+          << inter_capacity << " used:" << inter_used << endl;
+
+      for ( int i = 0; i < inter_param_cnt; ++i ) {
+         msg << "   Parameter '" << params[i].get_FOM_name() << "' capacity:"
+             << params[i].get_buffer_capacity() << " used:"
+             << params[i].get_buffer_size() << endl;
+      }
+      total_capacity += inter_capacity;
+      total_used += inter_used;
+   }
+
+   msg << "Total capacity:" << total_capacity << " used:" << total_used << endl
+       << StringStorage::get_counters_summary() << endl;
+   send_hs( stdout, (char *)msg.str().c_str() );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Manager::shrink_buffers_to_fit()
+{
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      Attribute *attrs = objects[n].get_attributes();
+      for ( int i = 0; i < objects[n].get_attribute_count(); ++i ) {
+         attrs[i].shrink_to_fit();
+      }
+   }
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      Parameter *params = interactions[n].get_parameters();
+      for ( int i = 0; i < interactions[n].get_parameter_count(); ++i ) {
+         params[i].shrink_to_fit();
+      }
+   }
+}
+
+/*!
+ * @details A packing object that is also an OpaqueBuffer, like the SpaceFOM
+ * entities, has its buffer prefaulted too.
+ * @job_class{initialization}
+ */
+void Manager::prepare_buffers_for_real_time()
+{
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      OpaqueBuffer *packing_buffer = dynamic_cast< OpaqueBuffer * >( objects[n].packing );
+      if ( packing_buffer != NULL ) {
+         packing_buffer->prepare_for_real_time( 0 );
+      }
+
+      Attribute *attrs = objects[n].get_attributes();
+      for ( int i = 0; i < objects[n].get_attribute_count(); ++i ) {
+         attrs[i].prepare_buffers_for_real_time();
+      }
+   }
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      Parameter *params = interactions[n].get_parameters();
+      for ( int i = 0; i < interactions[n].get_parameter_count(); ++i ) {
+         params[i].prepare_buffer_for_real_time();
+      }
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::set_single_threaded(
+   bool const single_thread )
+{
+   obj_discovery_mutex.set_single_threaded( single_thread );
+   interactions_queue.mutex.set_single_threaded( single_thread );
+
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      objects[n].set_single_threaded( single_thread );
+   }
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      interactions[n].mutex.set_single_threaded( single_thread );
+   }
+}
+
+unsigned int const Manager::get_metrics_entry_count() const
+{
+   unsigned int count = inter_count;
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      count += objects[n].get_metrics_entry_count();
+   }
+   return count;
+}
+
+/*!
+ * @details Each object entry is followed by the entries for its attributes
+ * in the same order as the attributes array, which is how the object finds
+ * the entry for an attribute.
+ * @job_class{initialization}
+ */
+void Manager::register_metrics(
+   MetricsRegistry &registry )
+{
+   for ( unsigned int n = 0; n < obj_count; ++n ) {
+      MetricsEntry *obj_metrics = registry.add_entry( METRICS_OBJECT, objects[n].get_name(), NULL );
+
+      Attribute *attrs = objects[n].get_attributes();
+      for ( int i = 0; i < objects[n].get_attribute_count(); ++i ) {
+         (void)registry.add_entry( METRICS_ATTRIBUTE, attrs[i].get_FOM_name(), obj_metrics );
+      }
+      objects[n].set_metrics( obj_metrics );
+   }
+   for ( unsigned int n = 0; n < inter_count; ++n ) {
+      interactions[n].set_metrics( registry.add_entry( METRICS_INTERACTION, interactions[n].get_FOM_name(), NULL ) );
+   }
+}
@@ -0,0 +1,218 @@
+/*!
+@file TrickHLA/MetricsRegistry.cpp
+@ingroup TrickHLA
+@brief This class keeps the runtime counters for the objects, attributes and
+interactions in a shared memory segment that a monitor process can read.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{MetricsRegistry.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Adaptive lookahead values.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/MetricsRegistry.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+MetricsRegistry::MetricsRegistry()
+   : segment_name(),
+     segment_size( 0 ),
+     header( NULL ),
+     entries( NULL ),
+     entry_used( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+MetricsRegistry::~MetricsRegistry()
+{
+   shutdown();
+}
+
+/*!
+ * @details Any segment left over from an earlier run with the same name is
+ * removed first so a reader never sees a stale layout. The new segment is
+ * zero filled by the system.
+ * @job_class{initialization}
+ */
+bool MetricsRegistry::initialize(
+   char const        *segment_name,
+   char const        *federate_name,
+   unsigned int const entry_count )
+{
+   if ( header != NULL ) {
+      return true;
+   }
+
+   this->segment_name = ( segment_name != NULL ) ? segment_name : "";
+   this->segment_size = sizeof( MetricsHeader ) + ( entry_count * sizeof( MetricsEntry ) );
+
+   (void)shm_unlink( this->segment_name.c_str() );
+
+   int const fd = shm_open( this->segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644 );
+   if ( fd < 0 ) {
+      send_hs( stderr, "MetricsRegistry::initialize():%d WARNING: Could not create the shared memory segment '%s': %s%c",
+               __LINE__, this->segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      return false;
+   }
+
+   if ( ftruncate( fd, (off_t)this->segment_size ) != 0 ) {
+      send_hs( stderr, "MetricsRegistry::initialize():%d WARNING: Could not size the shared memory segment '%s': %s%c",
+               __LINE__, this->segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      close( fd );
+      (void)shm_unlink( this->segment_name.c_str() );
+      return false;
+   }
+
+   void *addr = mmap( NULL, this->segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   close( fd );
+   if ( addr == MAP_FAILED ) {
+      send_hs( stderr, "MetricsRegistry::initialize():%d WARNING: Could not map the shared memory segment '%s': %s%c",
+               __LINE__, this->segment_name.c_str(), strerror( errno ), THLA_NEWLINE );
+      (void)shm_unlink( this->segment_name.c_str() );
+      return false;
+   }
+
+   header  = static_cast< MetricsHeader * >( addr );
+   entries = reinterpret_cast< MetricsEntry * >( header + 1 );
+
+   header->version     = THLA_METRICS_VERSION;
+   header->header_size = (unsigned int)sizeof( MetricsHeader );
+   header->entry_size  = (unsigned int)sizeof( MetricsEntry );
+   header->entry_count = 0;
+   header->pid         = (int)getpid();
+   if ( federate_name != NULL ) {
+      strncpy( header->federate_name, federate_name, THLA_METRICS_NAME_SIZE - 1 );
+   }
+   entry_used = 0;
+
+   return true;
+}
+
+MetricsEntry *MetricsRegistry::add_entry(
+   MetricsKindEnum const kind,
+   char const           *name,
+   MetricsEntry const   *parent )
+{
+   if ( ( header == NULL )
+        || ( ( sizeof( MetricsHeader ) + ( ( entry_used + 1 ) * sizeof( MetricsEntry ) ) ) > segment_size ) ) {
+      return NULL;
+   }
+
+   MetricsEntry *entry = &entries[entry_used++];
+   entry->kind         = (unsigned int)kind;
+   entry->parent       = ( parent != NULL ) ? (int)( parent - entries ) : -1;
+   if ( name != NULL ) {
+      strncpy( entry->name, name, THLA_METRICS_NAME_SIZE - 1 );
+   }
+   return entry;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void MetricsRegistry::publish()
+{
+   if ( header == NULL ) {
+      return;
+   }
+   header->entry_count = entry_used;
+
+   // Everything written above is visible before the magic string.
+   __atomic_thread_fence( __ATOMIC_RELEASE );
+   memcpy( header->magic, THLA_METRICS_MAGIC, sizeof( THLA_METRICS_MAGIC ) );
+}
+
+void MetricsRegistry::record_time_advance_grant(
+   int64_t const wait_ns,
+   int64_t const granted_time_micros )
+{
+   if ( header == NULL ) {
+      return;
+   }
+   unsigned long long const wait = ( wait_ns > 0 ) ? (unsigned long long)wait_ns : 0;
+
+   __atomic_store_n( &header->granted_time_micros, (long long)granted_time_micros, __ATOMIC_RELAXED );
+   __atomic_store_n( &header->tag_wait_last_ns, wait, __ATOMIC_RELAXED );
+   add( header->tag_wait_total_ns, wait );
+   update_high_water( header->tag_wait_max_ns, wait );
+   add( header->tag_count, 1 );
+}
+
+void MetricsRegistry::record_lookahead(
+   int64_t const lookahead_micros,
+   int64_t const send_distance_micros,
+   bool const    changed )
+{
+   if ( header == NULL ) {
+      return;
+   }
+   __atomic_store_n( &header->lookahead_micros, (long long)lookahead_micros, __ATOMIC_RELAXED );
+   __atomic_store_n( &header->send_distance_micros, (long long)send_distance_micros, __ATOMIC_RELAXED );
+   if ( changed ) {
+      add( header->lookahead_changes, 1 );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void MetricsRegistry::shutdown()
+{
+   if ( header != NULL ) {
+      munmap( header, segment_size );
+      (void)shm_unlink( segment_name.c_str() );
+      header     = NULL;
+      entries    = NULL;
+      entry_used = 0;
+   }
+}
+
+void MetricsRegistry::update_high_water(
+   unsigned long long &counter,
+   unsigned long long  value )
+{
+   unsigned long long current = __atomic_load_n( &counter, __ATOMIC_RELAXED );
+   while ( ( value > current )
+           && !__atomic_compare_exchange_n( &counter, &current, value, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) {
+   }
+}
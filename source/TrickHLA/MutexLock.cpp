@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Single threaded mode without locking.}
 @revs_end
 
 */
@@ -37,6 +38,7 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 MutexLock::MutexLock()
+   : single_threaded( false )
 {
    pthread_mutexattr_t attr;
    pthread_mutexattr_init( &attr );
@@ -60,6 +62,9 @@ MutexLock::~MutexLock()
  */
 int const MutexLock::lock()
 {
+   if ( single_threaded ) {
+      return 0;
+   }
    return pthread_mutex_lock( &mutex );
 }
 
@@ -69,5 +74,8 @@ int const MutexLock::lock()
  */
 int const MutexLock::unlock()
 {
+   if ( single_threaded ) {
+      return 0;
+   }
    return pthread_mutex_unlock( &mutex );
 }
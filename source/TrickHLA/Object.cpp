@@ -15,6 +15,8 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{AsyncLogger.cpp}
+@trick_link_dependency{AsyncPublisher.cpp}
 @trick_link_dependency{Attribute.cpp}
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{ElapsedTimeStats.cpp}
@@ -22,13 +24,18 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Int64Interval.cpp}
 @trick_link_dependency{Int64Time.cpp}
 @trick_link_dependency{LagCompensation.cpp}
+@trick_link_dependency{LatencyHistogram.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{MetricsRegistry.cpp}
 @trick_link_dependency{MutexLock.cpp}
 @trick_link_dependency{MutexProtection.cpp}
 @trick_link_dependency{Object.cpp}
+@trick_link_dependency{ObjectSnapshot.cpp}
 @trick_link_dependency{OwnershipHandler.cpp}
 @trick_link_dependency{Packing.cpp}
+@trick_link_dependency{Probes.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{TraceRecorder.cpp}
 @trick_link_dependency{Types.cpp}
 
 @revs_title
@@ -36,6 +43,21 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, May 2006, --, DSES Created Object}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional asynchronous attribute update publisher.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Optional front/back attribute buffers.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Seqlock snapshots of received data.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Serialize attribute updates across threads.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Frame phase tracing.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Latency histograms.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Runtime metrics.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, USDT probes.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Send traces through the asynchronous logger.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Data cycles to the next send for batched time advances.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Late data dependence for pipelined frames.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Thread configuration.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Integer time for the requested data and delete timestamps.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Keep the object mutexes locking when ownership can transfer.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Swap the attribute encode buffers once per frame.}
 @revs_end
 
 */
@@ -56,6 +78,8 @@ NASA, Johnson Space Center\n
 #include "trick/release.h"
 
 // TrickHLA include files.
+#include "TrickHLA/AsyncLogger.hh"
+#include "TrickHLA/AsyncPublisher.hh"
 #include "TrickHLA/Attribute.hh"
 #include "TrickHLA/CompileConfig.hh"
 #include "TrickHLA/Constants.hh"
@@ -65,15 +89,20 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Int64Time.hh"
 #include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LatencyHistogram.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/MetricsRegistry.hh"
 #include "TrickHLA/MutexLock.hh"
 #include "TrickHLA/MutexProtection.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/ObjectDeleted.hh"
+#include "TrickHLA/ObjectSnapshot.hh"
 #include "TrickHLA/OwnershipHandler.hh"
 #include "TrickHLA/Packing.hh"
+#include "TrickHLA/Probes.hh"
 #include "TrickHLA/SleepTimeout.hh"
 #include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TraceRecorder.hh"
 #include "TrickHLA/Types.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -114,8 +143,11 @@ Object::Object()
      create_HLA_instance( false ),
      required( true ),
      blocking_cyclic_read( false ),
+     late_data_dependence( false ),
      attr_count( 0 ),
      attributes( NULL ),
+     buffer_slots( 1 ),
+     snapshot_received_data( false ),
      lag_comp( NULL ),
      lag_comp_type( LAG_COMPENSATION_NONE ),
      packing( NULL ),
@@ -140,9 +172,15 @@ Object::Object()
      rti_ambassador( NULL ),
      thla_reflected_attributes_queue(),
      thla_attribute_map(),
+     snapshot_store(),
+     metrics( NULL ),
      send_count( 0LL ),
      receive_count( 0LL ),
-     elapsed_time_stats()
+     elapsed_time_stats(),
+     blocking_read_stats(),
+     pack_stats(),
+     send_stats(),
+     unpack_stats()
 {
    // Make sure we allocate the map.
    this->attribute_values_map = new AttributeHandleValueMap();
@@ -335,6 +373,11 @@ void Object::initialize(
       this->attr_count = 0;
    }
 
+   // The snapshot store must be allocated before any thread can read it.
+   if ( snapshot_received_data && ( attr_count > 0 ) ) {
+      snapshot_store.initialize( attr_count );
+   }
+
    // TODO: Get the preferred order by parsing the FOM.
    //
    // Determine if any attribute is the FOM specified order.
@@ -457,9 +500,13 @@ void Object::remove()
                if ( is_instance_handle_valid() && federate->is_execution_member() ) {
 
                   // Delete the object instance at a specific time if we are
-                  // time-regulating.
+                  // time-regulating. The send base is the requested time while
+                  // a batched Time Advance Request is outstanding, since the
+                  // RTI only takes later timestamps.
                   if ( federate->in_time_regulating_state() ) {
-                     Int64Time update_time( get_granted_time() + get_lookahead() );
+                     Int64Time const update_time( Int64TimeValue(
+                        federate->get_send_base_time_in_micros()
+                        + federate->get_lookahead_time_in_micros() ) );
                      (void)rti_amb->deleteObjectInstance( instance_handle,
                                                           RTI1516_USERDATA( 0, 0 ),
                                                           update_time.get() );
@@ -1582,8 +1629,15 @@ void Object::provide_attribute_update(
 void Object::send_requested_data()
 {
    if ( attr_update_requested ) {
-      Int64Time granted_plus_lookahead( get_granted_time() + get_lookahead() );
-      send_requested_data( granted_plus_lookahead );
+      // Add the lookahead in integer microseconds so only the final update
+      // time is converted to an HLA time. Like the cyclic data, start from
+      // the send base time, which is the requested time while a batched Time
+      // Advance Request is outstanding.
+      Federate const *federate = get_federate();
+      Int64Time const update_time( Int64TimeValue(
+         federate->get_send_base_time_in_micros()
+         + federate->get_lookahead_time_in_micros() ) );
+      send_requested_data( update_time );
    }
 }
 
@@ -1659,14 +1713,36 @@ void Object::send_requested_data(
       // IEEE-1516.1-2000 sections 4.12, 4.20)
       if ( federate->should_publish_data() ) {
 
-         RTIambassador *rti_amb = get_RTI_ambassador();
+         // Serialize the updates in case Trick child threads are sending
+         // their own objects at the same time.
+         MutexProtection auto_unlock_rti_mutex( federate->get_rti_update_mutex() );
+
+         RTIambassador  *rti_amb   = get_RTI_ambassador();
+         AsyncPublisher *publisher = federate->get_async_publisher();
+
+         if ( publisher != NULL ) {
+            if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+               THLA_LOG( stdout, "Object::send_requested_data():%d Object '%s', queued %s Attribute update for the publisher thread.%c",
+                         __LINE__, get_name(), ( send_with_timestamp ? "Timestamp Order (TSO)" : "Receive Order (RO)" ),
+                         THLA_NEWLINE );
+            }
+
+            // Count the update now, because the publisher takes the
+            // attribute values out of the map.
+            if ( metrics != NULL ) {
+               record_sent_metrics();
+            }
 
-         if ( send_with_timestamp ) {
+            // Hand the update off to the publisher thread, which sends it
+            // in order before our next Time Advance Request.
+            publisher->publish( this, this->instance_handle, *attribute_values_map,
+                                send_with_timestamp, update_time );
+         } else if ( send_with_timestamp ) {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_requested_data():%d \
+               THLA_LOG( stdout, "Object::send_requested_data():%d \
 Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds.%c",
-                        __LINE__, get_name(), update_time.get_time_in_seconds(),
-                        THLA_NEWLINE );
+                         __LINE__, get_name(), update_time.get_time_in_seconds(),
+                         THLA_NEWLINE );
             }
             // Send as Timestamp Order
             (void)rti_amb->updateAttributeValues( this->instance_handle,
@@ -1675,8 +1751,8 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                                                   update_time.get() );
          } else {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
-                        __LINE__, get_name(), THLA_NEWLINE );
+               THLA_LOG( stdout, "Object::send_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
+                         __LINE__, get_name(), THLA_NEWLINE );
             }
 
             // Send as Receive Order
@@ -1687,6 +1763,9 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         if ( ( metrics != NULL ) && ( publisher == NULL ) ) {
+            record_sent_metrics();
+         }
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -1854,6 +1933,11 @@ void Object::send_cyclic_and_requested_data(
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
+   Federate *federate = get_federate();
+
+   bool const latency_stats = federate->is_latency_stats_enabled();
+   int64_t    begin_ns      = latency_stats ? LatencyHistogram::now() : 0;
+
    // Do send side lag compensation.
    if ( ( lag_comp_type == LAG_COMPENSATION_SEND_SIDE ) && ( lag_comp != NULL ) ) {
       lag_comp->send_lag_compensation();
@@ -1867,6 +1951,12 @@ void Object::send_cyclic_and_requested_data(
    // Buffer the attribute values for the object.
    pack_cyclic_and_requested_attribute_buffers();
 
+   if ( latency_stats ) {
+      int64_t const end_ns = LatencyHistogram::now();
+      pack_stats.record( end_ns - begin_ns );
+      begin_ns = end_ns;
+   }
+
    try {
       // Create the map of "cyclic" and requested attribute values we will be updating.
       create_attribute_set( CONFIG_CYCLIC, true );
@@ -1887,8 +1977,6 @@ void Object::send_cyclic_and_requested_data(
       return;
    }
 
-   Federate *federate = get_federate();
-
    // The message will only be sent as TSO if our Federate is in the HLA Time
    // Regulating state and we have at least one attribute with a preferred
    // timestamp order. Assumes the FOM specified order is TSO.
@@ -1902,15 +1990,51 @@ void Object::send_cyclic_and_requested_data(
       // IEEE-1516.1-2000 sections 4.12, 4.20)
       if ( federate->should_publish_data() ) {
 
-         RTIambassador *rti_amb = get_RTI_ambassador();
+         // Serialize the updates in case Trick child threads are sending
+         // their own objects at the same time.
+         MutexProtection auto_unlock_rti_mutex( federate->get_rti_update_mutex() );
+
+         RTIambassador  *rti_amb   = get_RTI_ambassador();
+         AsyncPublisher *publisher = federate->get_async_publisher();
+
+         // Capture the probe arguments before the publisher takes the
+         // attribute values out of the map.
+         bool const probe_enabled    = THLA_PROBE_ENABLED( send_cyclic_data );
+         size_t     probe_attr_count = 0;
+         size_t     probe_bytes      = 0;
+         if ( probe_enabled ) {
+            probe_attr_count = attribute_values_map->size();
 
-         if ( send_with_timestamp ) {
+            AttributeHandleValueMap::const_iterator iter;
+            for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+               probe_bytes += iter->second.size();
+            }
+         }
 
+         if ( publisher != NULL ) {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_cyclic_and_requested_data():%d \
+               THLA_LOG( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', queued %s Attribute update for the publisher thread.%c",
+                         __LINE__, get_name(), ( send_with_timestamp ? "Timestamp Order (TSO)" : "Receive Order (RO)" ),
+                         THLA_NEWLINE );
+            }
+
+            // Count the update now, because the publisher takes the
+            // attribute values out of the map.
+            if ( metrics != NULL ) {
+               record_sent_metrics();
+            }
+
+            // Hand the update off to the publisher thread, which sends it
+            // in order before our next Time Advance Request.
+            publisher->publish( this, this->instance_handle, *attribute_values_map,
+                                send_with_timestamp, update_time );
+         } else if ( send_with_timestamp ) {
+
+            if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
+               THLA_LOG( stdout, "Object::send_cyclic_and_requested_data():%d \
 Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds.%c",
-                        __LINE__, get_name(), update_time.get_time_in_seconds(),
-                        THLA_NEWLINE );
+                         __LINE__, get_name(), update_time.get_time_in_seconds(),
+                         THLA_NEWLINE );
             }
 
             // Send as Timestamp Order
@@ -1920,8 +2044,8 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                                                   update_time.get() );
          } else {
             if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
-               send_hs( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
-                        __LINE__, get_name(), THLA_NEWLINE );
+               THLA_LOG( stdout, "Object::send_cyclic_and_requested_data():%d Object '%s', Receive Order (RO) Attribute update.%c",
+                         __LINE__, get_name(), THLA_NEWLINE );
             }
 
             // Send as Receive Order (i.e. with no timestamp).
@@ -1932,6 +2056,15 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         if ( ( metrics != NULL ) && ( publisher == NULL ) ) {
+            record_sent_metrics();
+         }
+
+         if ( probe_enabled ) {
+            THLA_PROBE5( send_cyclic_data, manager->get_object_index( this ), (long)instance_handle.hash(),
+                         probe_attr_count, probe_bytes,
+                         ( send_with_timestamp ? update_time.get_time_in_micros() : -1 ) );
+         }
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -2074,6 +2207,10 @@ exception for '%s' with error message '%s'.%c",
       send_hs( stderr, (char *)errmsg.str().c_str() );
    }
 
+   if ( latency_stats ) {
+      send_stats.record_since( begin_ns );
+   }
+
    // Macro to restore the saved FPU Control Word register value.
    TRICKHLA_RESTORE_FPU_CONTROL_WORD;
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
@@ -2115,6 +2252,8 @@ void Object::receive_cyclic_data()
       // Block waiting for data if it has not arrived yet.
       if ( !is_changed() ) {
 
+         int64_t const wait_begin_ns = get_federate()->is_latency_stats_enabled() ? LatencyHistogram::now() : 0;
+
          SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
 
          // On average using "usleep()" to wait for data is faster but at the
@@ -2151,12 +2290,20 @@ void Object::receive_cyclic_data()
                         __LINE__, exec_get_sim_time(), THLA_NEWLINE );
             }
          }
+
+         if ( wait_begin_ns != 0 ) {
+            blocking_read_stats.record_since( wait_begin_ns );
+         }
       }
    }
 
    // Process the data now that it has been received (i.e. changed).
    if ( is_changed() ) {
 
+      bool const latency_stats = get_federate()->is_latency_stats_enabled();
+
+      unsigned long long unpack_count = 0;
+
 #ifdef THLA_CYCLIC_READ_TIME_STATS
       elapsed_time_stats.measure();
 #endif
@@ -2168,6 +2315,8 @@ void Object::receive_cyclic_data()
                   THLA_NEWLINE );
 #endif
 
+         int64_t const unpack_begin_ns = latency_stats ? LatencyHistogram::now() : 0;
+
          // Unpack the buffer and copy the values to the object attributes.
          unpack_cyclic_attribute_buffers();
 
@@ -2176,6 +2325,10 @@ void Object::receive_cyclic_data()
             packing->unpack();
          }
 
+         if ( latency_stats ) {
+            unpack_stats.record_since( unpack_begin_ns );
+         }
+
          // Do receive side lag compensation.
          if ( ( lag_comp_type == LAG_COMPENSATION_RECEIVE_SIDE ) && ( lag_comp != NULL ) ) {
             lag_comp->receive_lag_compensation();
@@ -2184,9 +2337,21 @@ void Object::receive_cyclic_data()
          // Mark this data as unchanged now that we have processed it from the buffer.
          mark_unchanged();
 
+         ++unpack_count;
+
          // Check for more object attribute data in the buffer/queue for this
          // object instance, which will show up as still being changed.
       } while ( is_changed() );
+
+#if defined( THLA_QUEUE_REFLECTED_ATTRIBUTES )
+      // Every queued update but the last was overwritten in this frame.
+      if ( ( metrics != NULL ) && ( unpack_count > 1 ) ) {
+         MetricsRegistry::add( metrics->reflections_coalesced, unpack_count - 1 );
+      }
+#endif
+
+      THLA_PROBE4( receive_cyclic_data, manager->get_object_index( this ), (long)instance_handle.hash(),
+                   unpack_count, get_granted_time().get_time_in_micros() );
    }
 #if THLA_OBJ_DEBUG_VALID_OBJECT_RECEIVE
    else if ( is_instance_handle_valid() && ( exec_get_sim_time() > 0.0 ) ) {
@@ -2258,6 +2423,9 @@ void Object::send_init_data()
 #ifdef THLA_CHECK_SEND_AND_RECEIVE_COUNTS
          ++send_count;
 #endif
+         if ( metrics != NULL ) {
+            record_sent_metrics();
+         }
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -2547,7 +2715,12 @@ void Object::create_attribute_set(
 void Object::enqueue_data(
    AttributeHandleValueMap const &theAttributes )
 {
-   thla_reflected_attributes_queue.push( theAttributes );
+   size_t const depth = thla_reflected_attributes_queue.push( theAttributes );
+
+   if ( metrics != NULL ) {
+      MetricsRegistry::add( metrics->reflections_queued, 1 );
+      MetricsRegistry::update_high_water( metrics->queue_depth_high_water, depth );
+   }
 }
 #endif // THLA_QUEUE_REFLECTED_ATTRIBUTES
 
@@ -2565,7 +2738,19 @@ void Object::extract_data(
    // extract the data from the buffer that is returned by
    // getValue().
 
-   bool attr_changed = false;
+   bool   attr_changed = false;
+   size_t total_bytes  = 0;
+
+   // Data not yet processed by the Trick main thread is about to be overwritten.
+   if ( ( metrics != NULL ) && changed ) {
+      MetricsRegistry::add( metrics->reflections_coalesced, 1 );
+   }
+
+   // Readers of the snapshot retry until the whole update has been copied.
+   bool const snapshot = snapshot_store.is_initialized();
+   if ( snapshot ) {
+      snapshot_store.begin_write();
+   }
 
    AttributeHandleValueMap::iterator iter;
 
@@ -2578,10 +2763,23 @@ void Object::extract_data(
 
       // Determine if this object has this attribute.
       if ( attr != NULL ) {
+         THLA_TRACE_SCOPE( "attribute", "extract_data", manager->get_object_index( this ), (int)( attr - attributes ) );
 
          // Place the RTI AttributeValue into the TrickHLA Attribute.
          attr->extract_data( &( iter->second ) );
 
+         if ( snapshot ) {
+            snapshot_store.write( (unsigned int)( attr - attributes ),
+                                  iter->second.data(), iter->second.size() );
+         }
+
+         if ( metrics != NULL ) {
+            MetricsEntry &attr_metrics = metrics[1 + ( attr - attributes )];
+            MetricsRegistry::add( attr_metrics.updates_received, 1 );
+            MetricsRegistry::add( attr_metrics.bytes_received, iter->second.size() );
+            total_bytes += iter->second.size();
+         }
+
          attr_changed = true;
 
       } else if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
@@ -2595,6 +2793,15 @@ this attribute.%c",
       }
    }
 
+   if ( snapshot ) {
+      snapshot_store.end_write();
+   }
+
+   if ( metrics != NULL ) {
+      MetricsRegistry::add( metrics->updates_received, 1 );
+      MetricsRegistry::add( metrics->bytes_received, total_bytes );
+   }
+
    // Set the change flag once all the attributes have been processed.
    if ( attr_changed ) {
       // Mark the data as being changed since the attribute changed.
@@ -2605,6 +2812,44 @@ this attribute.%c",
    }
 }
 
+/*!
+ * @details Counts the attribute values in the attribute_values_map, so this
+ * must be called right after the map has been sent, or right before it is
+ * handed to the publisher thread, which takes the values out of the map.
+ */
+void Object::record_sent_metrics()
+{
+   size_t total_bytes = 0;
+
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+      Attribute const *attr = get_attribute( iter->first );
+      if ( attr != NULL ) {
+         MetricsEntry &attr_metrics = metrics[1 + ( attr - attributes )];
+         MetricsRegistry::add( attr_metrics.updates_sent, 1 );
+         MetricsRegistry::add( attr_metrics.bytes_sent, iter->second.size() );
+      }
+      total_bytes += iter->second.size();
+   }
+   MetricsRegistry::add( metrics->updates_sent, 1 );
+   MetricsRegistry::add( metrics->bytes_sent, total_bytes );
+}
+
+/*!
+ * @details The snapshot is copied from the store written by extract_data(),
+ * so this works the same whether the received data is queued for the Trick
+ * main thread or extracted in the RTI callback thread.
+ */
+bool Object::read_snapshot(
+   ObjectSnapshot &snapshot ) const
+{
+   if ( !snapshot_store.is_initialized() ) {
+      return false;
+   }
+   snapshot_store.read( snapshot );
+   return true;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -3091,6 +3336,9 @@ void *grant_push_pthread_function(
    void *arg )
 {
    Object *pushThreadTHLAObj = static_cast< Object * >( arg );
+   if ( pushThreadTHLAObj->get_federate() != NULL ) {
+      pushThreadTHLAObj->get_federate()->ownership_thread.apply( "THLA_push" );
+   }
    pushThreadTHLAObj->grant_push_request();
    pthread_exit( NULL );
    return ( NULL );
@@ -3210,6 +3458,10 @@ void *ownership_divestiture_pthread_function(
    if ( arg != NULL ) {
       DivestThreadArgs *divest_thread_args = reinterpret_cast< DivestThreadArgs * >( arg );
 
+      if ( divest_thread_args->trick_hla_obj->get_federate() != NULL ) {
+         divest_thread_args->trick_hla_obj->get_federate()->ownership_thread.apply( "THLA_divest" );
+      }
+
 #if THLA_OBJ_OWNERSHIP_DEBUG
       send_hs( stdout, "====== Object::ownership_divestiture_pthread_function():%d \
 calling negotiated_attribute_ownership_divestiture()%c",
@@ -3492,6 +3744,39 @@ for Attributes of object '%s'.%c",
    }
 }
 
+/*!
+ * @job_class{initialization}
+ */
+bool const Object::is_ownership_transfer_possible() const
+{
+   if ( ownership != NULL ) {
+      return true;
+   }
+   for ( int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_publish() && !attributes[i].is_locally_owned() ) {
+         return true;
+      }
+   }
+   return false;
+}
+
+/*!
+ * @details The thread that services a push request from another federate
+ * and the ownership divestiture thread change the attribute ownership flags
+ * under the object mutex, so those mutexes keep locking for an object that
+ * can take part in an ownership transfer.
+ * @job_class{initialization}
+ */
+void Object::set_single_threaded(
+   bool const single_thread )
+{
+   bool const lock_for_ownership = single_thread && is_ownership_transfer_possible();
+
+   mutex.set_single_threaded( single_thread && !lock_for_ownership );
+   ownership_mutex.set_single_threaded( single_thread && !lock_for_ownership );
+   thla_reflected_attributes_queue.queue_mutex.set_single_threaded( single_thread );
+}
+
 void Object::setup_ownership_transfer_checkpointed_data()
 {
    if ( ownership != static_cast< OwnershipHandler * >( NULL ) ) {
@@ -3701,6 +3986,30 @@ bool Object::any_locally_owned_published_cyclic_data_ready_attribute()
    return any_ready;
 }
 
+int const Object::get_data_cycles_to_next_send() const
+{
+   // A requested update goes out on the next data cycle.
+   if ( attr_update_requested ) {
+      return 1;
+   }
+
+   int cycles = 0;
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      if ( attributes[i].is_locally_owned() && attributes[i].is_publish() ) {
+         if ( attributes[i].is_update_requested() ) {
+            return 1;
+         }
+         if ( ( attributes[i].get_configuration() & CONFIG_CYCLIC ) == CONFIG_CYCLIC ) {
+            int const attr_cycles = attributes[i].get_data_cycles_to_ready();
+            if ( ( cycles == 0 ) || ( attr_cycles < cycles ) ) {
+               cycles = attr_cycles;
+            }
+         }
+      }
+   }
+   return cycles;
+}
+
 bool Object::any_locally_owned_published_requested_attribute()
 {
    for ( unsigned int i = 0; i < attr_count; ++i ) {
@@ -3740,6 +4049,7 @@ void Object::pack_requested_attribute_buffers()
 {
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( attributes[i].is_update_requested() ) {
+         THLA_TRACE_SCOPE( "attribute", "pack_attribute", manager->get_object_index( this ), (int)i );
          attributes[i].pack_attribute_buffer();
       }
    }
@@ -3752,6 +4062,7 @@ void Object::pack_attribute_buffers(
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( ( include_requested && attributes[i].is_update_requested() )
            || ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
+         THLA_TRACE_SCOPE( "attribute", "pack_attribute", manager->get_object_index( this ), (int)i );
          attributes[i].pack_attribute_buffer();
       }
    }
@@ -3762,11 +4073,22 @@ void Object::unpack_attribute_buffers(
 {
    for ( unsigned int i = 0; i < attr_count; ++i ) {
       if ( ( attributes[i].get_configuration() & attr_config ) == attr_config ) {
+         THLA_TRACE_SCOPE( "attribute", "unpack_attribute", manager->get_object_index( this ), (int)i );
          attributes[i].unpack_attribute_buffer();
       }
    }
 }
 
+void Object::swap_attribute_buffers()
+{
+   if ( buffer_slots <= 1 ) {
+      return;
+   }
+   for ( unsigned int i = 0; i < attr_count; ++i ) {
+      attributes[i].swap_buffers();
+   }
+}
+
 void Object::set_to_unblocking_cyclic_reads()
 {
    this->blocking_cyclic_read       = false;
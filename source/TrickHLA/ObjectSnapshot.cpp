@@ -0,0 +1,282 @@
+/*!
+@file TrickHLA/ObjectSnapshot.cpp
+@ingroup TrickHLA
+@brief This class provides consistent snapshots of the attribute data received
+for an object to readers on any thread.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{ObjectSnapshot.cpp}
+@trick_link_dependency{Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstring>
+#include <sched.h>
+#include <sstream>
+#include <vector>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/ObjectSnapshot.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+ObjectSnapshot::ObjectSnapshot()
+   : data(),
+     valid(),
+     version( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ObjectSnapshot::~ObjectSnapshot()
+{
+   return;
+}
+
+unsigned char const *ObjectSnapshot::get_attribute_data(
+   unsigned int const index,
+   size_t            &num_bytes ) const
+{
+   if ( ( index >= data.size() ) || !valid[index] ) {
+      num_bytes = 0;
+      return NULL;
+   }
+   num_bytes = data[index].size();
+
+   // A received value can be empty, which is not the same as not received,
+   // so do not return NULL for it.
+   static unsigned char const empty_value = 0;
+   return data[index].empty() ? &empty_value : &data[index][0];
+}
+
+/*!
+ * @job_class{initialization}
+ */
+ObjectSnapshotStore::ObjectSnapshotStore()
+   : attr_count( 0 ),
+     buffers( NULL ),
+     capacities( NULL ),
+     sizes( NULL ),
+     retired(),
+     sequence( 0 ),
+     read_retry_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ObjectSnapshotStore::~ObjectSnapshotStore()
+{
+   for ( size_t i = 0; i < retired.size(); ++i ) {
+      if ( TMM_is_alloced( (char *)retired[i] ) ) {
+         TMM_delete_var_a( retired[i] );
+      }
+   }
+   retired.clear();
+
+   if ( buffers != NULL ) {
+      for ( unsigned int i = 0; i < attr_count; ++i ) {
+         if ( ( buffers[i] != NULL ) && TMM_is_alloced( (char *)buffers[i] ) ) {
+            TMM_delete_var_a( buffers[i] );
+         }
+      }
+      if ( TMM_is_alloced( (char *)buffers ) ) {
+         TMM_delete_var_a( buffers );
+      }
+      buffers = NULL;
+   }
+   if ( capacities != NULL ) {
+      if ( TMM_is_alloced( (char *)capacities ) ) {
+         TMM_delete_var_a( capacities );
+      }
+      capacities = NULL;
+   }
+   if ( sizes != NULL ) {
+      if ( TMM_is_alloced( (char *)sizes ) ) {
+         TMM_delete_var_a( sizes );
+      }
+      sizes = NULL;
+   }
+   attr_count = 0;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ObjectSnapshotStore::initialize(
+   unsigned int const attribute_count )
+{
+   if ( ( buffers != NULL ) || ( attribute_count == 0 ) ) {
+      return;
+   }
+
+   buffers    = (unsigned char **)TMM_declare_var_1d( "unsigned char *", (int)attribute_count );
+   capacities = (unsigned long *)TMM_declare_var_1d( "unsigned long", (int)attribute_count );
+   sizes      = (unsigned long *)TMM_declare_var_1d( "unsigned long", (int)attribute_count );
+
+   if ( ( buffers == NULL ) || ( capacities == NULL ) || ( sizes == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectSnapshotStore::initialize():" << __LINE__
+             << " ERROR: Could not allocate memory for the snapshot store of "
+             << attribute_count << " attributes!" << THLA_ENDL;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   for ( unsigned int i = 0; i < attribute_count; ++i ) {
+      buffers[i]    = NULL;
+      capacities[i] = 0;
+      sizes[i]      = 0;
+   }
+   attr_count = attribute_count;
+}
+
+void ObjectSnapshotStore::begin_write()
+{
+   // Make the sequence odd before any of the data changes.
+   __atomic_store_n( &sequence, sequence + 1, __ATOMIC_RELAXED );
+   __atomic_thread_fence( __ATOMIC_RELEASE );
+}
+
+/*!
+ * @details A buffer that has to grow is replaced instead of resized, and the
+ * old buffer is retired rather than freed because a reader may still be
+ * copying from it. The buffers grow geometrically so the retired memory is
+ * bounded by the final capacity. The buffer address is published before the
+ * size so a reader that sees the new size also sees the larger buffer.
+ */
+void ObjectSnapshotStore::write(
+   unsigned int const index,
+   void const        *src,
+   size_t const       num_bytes )
+{
+   if ( index >= attr_count ) {
+      return;
+   }
+
+   if ( ( buffers[index] == NULL ) || ( num_bytes > capacities[index] ) ) {
+      size_t new_capacity = Utilities::next_positive_multiple_of_8( num_bytes );
+      if ( new_capacity < ( 2 * capacities[index] ) ) {
+         new_capacity = 2 * capacities[index];
+      }
+      if ( new_capacity == 0 ) {
+         new_capacity = 8;
+      }
+
+      unsigned char *new_buffer = (unsigned char *)TMM_declare_var_1d( "unsigned char", (int)new_capacity );
+      if ( new_buffer == NULL ) {
+         ostringstream errmsg;
+         errmsg << "ObjectSnapshotStore::write():" << __LINE__
+                << " ERROR: Could not allocate " << new_capacity
+                << " bytes for the snapshot of attribute " << index << "!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+
+      if ( buffers[index] != NULL ) {
+         retired.push_back( buffers[index] );
+      }
+      capacities[index] = new_capacity;
+      __atomic_store_n( &buffers[index], new_buffer, __ATOMIC_RELEASE );
+   }
+
+   if ( num_bytes > 0 ) {
+      memcpy( buffers[index], src, num_bytes );
+   }
+   __atomic_store_n( &sizes[index], (unsigned long)num_bytes, __ATOMIC_RELEASE );
+}
+
+void ObjectSnapshotStore::end_write()
+{
+   // Make the sequence even again after all the data has changed.
+   __atomic_store_n( &sequence, sequence + 1, __ATOMIC_RELEASE );
+}
+
+/*!
+ * @details The copy into the snapshot reuses the memory the snapshot already
+ * has, so a reader that keeps its snapshot does not allocate in the steady
+ * state.
+ */
+void ObjectSnapshotStore::read(
+   ObjectSnapshot &snapshot ) const
+{
+   if ( snapshot.data.size() != attr_count ) {
+      snapshot.data.resize( attr_count );
+      snapshot.valid.resize( attr_count, false );
+   }
+
+   unsigned int tries = 0;
+   while ( true ) {
+      unsigned long long const begin_seq = __atomic_load_n( &sequence, __ATOMIC_ACQUIRE );
+
+      // Only copy when no update is in progress.
+      if ( ( begin_seq & 1 ) == 0 ) {
+         for ( unsigned int i = 0; i < attr_count; ++i ) {
+            size_t const         num_bytes = __atomic_load_n( &sizes[i], __ATOMIC_ACQUIRE );
+            unsigned char const *src       = __atomic_load_n( &buffers[i], __ATOMIC_ACQUIRE );
+
+            if ( src != NULL ) {
+               snapshot.data[i].assign( src, src + num_bytes );
+               snapshot.valid[i] = true;
+            } else {
+               snapshot.data[i].clear();
+               snapshot.valid[i] = false;
+            }
+         }
+
+         __atomic_thread_fence( __ATOMIC_ACQUIRE );
+         if ( __atomic_load_n( &sequence, __ATOMIC_RELAXED ) == begin_seq ) {
+            snapshot.version = begin_seq / 2;
+            return;
+         }
+      }
+
+      __atomic_add_fetch( &read_retry_count, 1, __ATOMIC_RELAXED );
+
+      // Let the writer finish if it keeps beating us.
+      if ( ( ++tries % 64 ) == 0 ) {
+         sched_yield();
+      }
+   }
+}
+
+unsigned long long const ObjectSnapshotStore::get_version() const
+{
+   return ( __atomic_load_n( &sequence, __ATOMIC_ACQUIRE ) / 2 );
+}
+
+unsigned long long const ObjectSnapshotStore::get_read_retry_count() const
+{
+   return __atomic_load_n( &read_retry_count, __ATOMIC_RELAXED );
+}
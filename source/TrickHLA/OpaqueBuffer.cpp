@@ -28,6 +28,8 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, July 2009, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
 @revs_end
 
 */
@@ -59,6 +61,8 @@ OpaqueBuffer::OpaqueBuffer()
      push_pos( 0 ),
      pull_pos( 0 ),
      capacity( 0 ),
+     growth( BUFFER_GROWTH_EXACT ),
+     capacity_limit( 0 ),
      buffer( NULL )
 {
    // Default to a buffer capacity of 1 for now just to make sure we have
@@ -109,6 +113,10 @@ void OpaqueBuffer::set_byte_alignment( unsigned int size )
 }
 
 /*!
+ * @details The default growth is BUFFER_GROWTH_EXACT because the buffer is
+ * often mapped directly to an attribute with the ENCODING_OPAQUE_DATA
+ * encoding, where the size of the Trick allocation is the number of bytes
+ * sent. Only use BUFFER_GROWTH_GEOMETRIC when that is not the case.
  * @job_class{initialization}
  */
 void OpaqueBuffer::ensure_buffer_capacity(
@@ -123,7 +131,7 @@ void OpaqueBuffer::ensure_buffer_capacity(
    }
 
    if ( size > capacity ) {
-      capacity = size;
+      capacity = Utilities::next_buffer_capacity( capacity, size, growth, capacity_limit );
       if ( buffer == NULL ) {
          buffer = (unsigned char *)TMM_declare_var_1d( "unsigned char", (int)capacity );
       } else {
@@ -147,6 +155,32 @@ void OpaqueBuffer::ensure_buffer_capacity(
    }
 }
 
+void OpaqueBuffer::shrink_to_fit()
+{
+   size_t fit_capacity = ( push_pos > alignment ) ? push_pos : alignment;
+
+   if ( ( buffer != NULL ) && ( capacity > fit_capacity ) ) {
+      unsigned char *new_buffer = (unsigned char *)TMM_resize_array_1d_a( buffer, (int)fit_capacity );
+      if ( new_buffer == NULL ) {
+         send_hs( stderr, "OpaqueBuffer::shrink_to_fit():%d WARNING: Could not shrink the buffer to %d bytes.%c",
+                  __LINE__, (int)fit_capacity, THLA_NEWLINE );
+         return;
+      }
+      buffer   = new_buffer;
+      capacity = fit_capacity;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void OpaqueBuffer::prepare_for_real_time(
+   size_t const max_size )
+{
+   ensure_buffer_capacity( ( max_size > capacity ) ? max_size : capacity );
+   Utilities::prefault_memory( buffer, capacity );
+}
+
 void OpaqueBuffer::push_to_buffer(
    void        *src,
    size_t       size,
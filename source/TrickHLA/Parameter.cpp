@@ -28,6 +28,10 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, DSES, Aug 2006, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Use the UTF-16BE widen/narrow kernels.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Reuse string memory when decoding.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Real-time buffer preparation.}
 @revs_end
 
 */
@@ -55,6 +59,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/Int64Interval.hh"
 #include "TrickHLA/Parameter.hh"
+#include "TrickHLA/StringStorage.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/Utilities.hh"
 
@@ -78,6 +83,9 @@ Parameter::Parameter()
    : trick_name( NULL ),
      FOM_name( NULL ),
      rti_encoding( ENCODING_UNKNOWN ),
+     buffer_growth( BUFFER_GROWTH_GEOMETRIC ),
+     buffer_capacity_limit( 0 ),
+     max_buffer_size( 0 ),
      buffer( NULL ),
      buffer_capacity( 0 ),
      size_is_static( true ),
@@ -735,7 +743,8 @@ void Parameter::ensure_buffer_capacity(
    size_t capacity )
 {
    if ( capacity > buffer_capacity ) {
-      buffer_capacity = capacity;
+      buffer_capacity = Utilities::next_buffer_capacity( buffer_capacity, capacity,
+                                                         buffer_growth, buffer_capacity_limit );
       if ( buffer == NULL ) {
          buffer = (unsigned char *)TMM_declare_var_1d( "unsigned char", (int)buffer_capacity );
       } else {
@@ -760,6 +769,41 @@ void Parameter::ensure_buffer_capacity(
    }
 }
 
+/*!
+ * @details The buffer keeps at least one byte so that it is always allocated.
+ * The encoded data in the buffer is preserved, where a boolean is encoded
+ * as a 4 byte HLAboolean.
+ */
+void Parameter::shrink_to_fit()
+{
+   size_t const encoded_size = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+   size_t const fit_capacity = ( encoded_size > 0 ) ? encoded_size : 1;
+
+   if ( ( buffer != NULL ) && ( buffer_capacity > fit_capacity ) ) {
+      unsigned char *new_buffer = (unsigned char *)TMM_resize_array_1d_a( buffer, (int)fit_capacity );
+      if ( new_buffer == NULL ) {
+         send_hs( stderr, "Parameter::shrink_to_fit():%d WARNING: Could not shrink the buffer for parameter '%s' to %d bytes.%c",
+                  __LINE__, FOM_name, (int)fit_capacity, THLA_NEWLINE );
+         return;
+      }
+      buffer          = new_buffer;
+      buffer_capacity = fit_capacity;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Parameter::prepare_buffer_for_real_time()
+{
+   size_t capacity = ( rti_encoding == ENCODING_BOOLEAN ) ? ( 4 * size ) : size;
+   if ( max_buffer_size > capacity ) {
+      capacity = max_buffer_size;
+   }
+   ensure_buffer_capacity( capacity );
+   Utilities::prefault_memory( buffer, buffer_capacity );
+}
+
 void Parameter::calculate_size_and_number_of_items()
 {
    size_t num_bytes = 0;
@@ -1723,10 +1767,8 @@ void Parameter::encode_string_to_buffer()
                size_t length = strlen( s );
 
                // Encode as UTF-16 characters in Big Endian
-               for ( size_t k = 0; k < length; ++k ) {
-                  *( output++ ) = '\0';
-                  *( output++ ) = (unsigned char)*( s++ );
-               }
+               Utilities::widen_ascii_to_utf16be( output, (unsigned char *)s, length );
+               output += 2 * length;
                byte_count += 2 * length;
             }
 
@@ -1804,10 +1846,8 @@ void Parameter::encode_string_to_buffer()
 
                if ( s != NULL ) {
                   // Encode as UTF-16 characters in Big Endian
-                  for ( size_t k = 0; k < length; ++k ) {
-                     *( output++ ) = '\0';
-                     *( output++ ) = (unsigned char)*( s++ );
-                  }
+                  Utilities::widen_ascii_to_utf16be( output, (unsigned char *)s, length );
+                  output += 2 * length;
                   byte_count += 2 * length;
                }
 
@@ -2278,35 +2318,9 @@ size %d, will use the data buffer size instead.%c",
             }
 
             // UTF-16 character encoding of the string.
-            output = *( (unsigned char **)address );
-
-            if ( output != NULL ) {
-
-               // TODO: If the users Trick simulation variable is static in size
-               // should we be reallocating memory for it below?
-
-               // Determine if we need to allocate more memory for the sim string.
-               // If it is larger than the existing string and larger than the
-               // memory allocated for the string then reallocate more memory.
-               if ( (int)length >= get_size( (char *)output ) ) {
-
-                  // Make sure to make room for the terminating null character,
-                  // and add a few more bytes to give us a little more space
-                  // for next time.
-                  int array_size        = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)address ) = (char *)TMM_resize_array_1d_a( *( (char **)address ), array_size );
-
-                  output = *( (unsigned char **)address );
-               }
-            } else {
-               // Allocate memory for the sim string and include room for the
-               // terminating null character and add a few more bytes to give
-               // us a little more space for next time.
-               int array_size        = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)address ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-               output = *( (unsigned char **)address );
-            }
+            // Reuse the memory for the sim string if it can hold the string and
+            // the terminating null character, otherwise grow it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)address, 0, length + 1 );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2319,10 +2333,8 @@ size %d, will use the data buffer size instead.%c",
             } else {
 
                // Decode the UTF-16 characters.
-               for ( size_t k = 0; k < length; ++k ) {
-                  input++; // skip the high-character of the UTF-16 encoding
-                  output[k] = *( input++ );
-               }
+               Utilities::narrow_utf16be_to_ascii( output, input, length );
+               input += 2 * length;
 
                // Add the terminating null character '\0';
                output[length] = '\0';
@@ -2427,32 +2439,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // UTF-16 character encoding of the string.
-               output = *( (unsigned char **)address + i );
-
-               if ( output != NULL ) {
-
-                  // Determine if we need to allocate more memory for the sim string.
-                  // If it is larger than the existing string and larger than the
-                  // memory allocated for the string then reallocate more memory.
-                  if ( (int)length >= get_size( (char *)output ) ) {
-
-                     // Make sure to make room for the terminating null character,
-                     // and add a few more bytes to give us a little more space
-                     // for next time.
-                     int array_size            = Utilities::next_positive_multiple_of_8( length );
-                     *( (char **)address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)address + i ), array_size );
-
-                     output = *( (unsigned char **)address + i );
-                  }
-               } else {
-                  // Allocate memory for the sim string and include room for the
-                  // terminating null character and add a few more bytes to give
-                  // us a little more space for next time.
-                  int array_size            = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-                  output = *( (unsigned char **)address + i );
-               }
+               // Reuse the memory for the sim string if it can hold the string and
+               // the terminating null character, otherwise grow it geometrically.
+               output = (unsigned char *)string_storage.get_string( (char **)address, i, length + 1 );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -2465,10 +2454,8 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                } else {
 
                   // Decode the UTF-16 characters.
-                  for ( size_t k = 0; k < length; ++k ) {
-                     input++; // skip the high-character of the UTF-16 encoding
-                     output[k] = *( input++ );
-                  }
+                  Utilities::narrow_utf16be_to_ascii( output, input, length );
+                  input += 2 * length;
 
                   // Add the terminating null character '\0';
                   output[length] = '\0';
@@ -2541,32 +2528,9 @@ WARNING: For ENCODING_ASCII_STRING parameter '%s', decoded length %d > data buff
             }
 
             // UTF-16 character encoding of the string.
-            output = *( (unsigned char **)address );
-
-            if ( output != NULL ) {
-
-               // Determine if we need to allocate more memory for the sim string.
-               // If it is larger than the existing string and larger than the
-               // memory allocated for the string then reallocate more memory.
-               if ( (int)length >= get_size( (char *)output ) ) {
-
-                  // Make sure to make room for the terminating null character,
-                  // and add a few more bytes to give us a little more space
-                  // for next time.
-                  int array_size        = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)address ) = (char *)TMM_resize_array_1d_a( *( (char **)address ), array_size );
-
-                  output = *( (unsigned char **)address );
-               }
-            } else {
-               // Allocate memory for the sim string and include room for the
-               // terminating null character and add a few more bytes to give
-               // us a little more space for next time.
-               int array_size        = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)address ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-               output = *( (unsigned char **)address );
-            }
+            // Reuse the memory for the sim string if it can hold the string and
+            // the terminating null character, otherwise grow it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)address, 0, length + 1 );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2580,7 +2544,7 @@ WARNING: For ENCODING_ASCII_STRING parameter '%s', decoded length %d > data buff
 
                // Copy the ASCII characters over.
                if ( length > 0 ) {
-                  memcpy( output, input, (size_t)length );
+                  StringStorage::copy_if_changed( output, input, (size_t)length );
                }
 
                // Add the terminating null character '\0';
@@ -2681,32 +2645,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // UTF-16 character encoding of the string.
-               output = *( (unsigned char **)address + i );
-
-               if ( output != NULL ) {
-
-                  // Determine if we need to allocate more memory for the sim string.
-                  // If it is larger than the existing string and larger than the
-                  // memory allocated for the string then reallocate more memory.
-                  if ( (int)length >= get_size( (char *)output ) ) {
-
-                     // Make sure to make room for the terminating null character,
-                     // and add a few more bytes to give us a little more space
-                     // for next time.
-                     int array_size            = Utilities::next_positive_multiple_of_8( length );
-                     *( (char **)address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)address + i ), array_size );
-
-                     output = *( (unsigned char **)address + i );
-                  }
-               } else {
-                  // Allocate memory for the sim string and include room for the
-                  // terminating null character and add a few more bytes to give
-                  // us a little more space for next time.
-                  int array_size            = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-
-                  output = *( (unsigned char **)address + i );
-               }
+               // Reuse the memory for the sim string if it can hold the string and
+               // the terminating null character, otherwise grow it geometrically.
+               output = (unsigned char *)string_storage.get_string( (char **)address, i, length + 1 );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -2720,7 +2661,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
                   // Copy the ASCII characters over.
                   if ( length > 0 ) {
-                     memcpy( output, input, (size_t)length );
+                     StringStorage::copy_if_changed( output, input, (size_t)length );
                      input += length;
                   }
 
@@ -2794,29 +2735,9 @@ WARNING: For ENCODING_OPAQUE_DATA parameter '%s', decoded length %d > data buffe
             }
 
             // Get a pointer to the output.
-            output = *( (unsigned char **)address );
-
-            if ( output != NULL ) {
-               // The output array size must exactly match the incoming data
-               // size for opaque data.
-               if ( (int)length != get_size( (char *)output ) ) {
-                  // WORKAROUND: Trick 10 can't handle a length of zero so to
-                  // workaround the memory manager problem use a size of 1 in
-                  // the allocation.
-                  *( (char **)address ) = (char *)TMM_resize_array_1d_a( *( (char **)address ),
-                                                                         (int)( ( length > 0 ) ? length : 1 ) );
-
-                  output = *( (unsigned char **)address );
-               }
-            } else {
-               // Allocate memory for the output array.
-               // WORKAROUND: Trick 10 can't handle a length of zero so to
-               // workaround the memory manager problem use a size of 1 in
-               // the allocation.
-               *( (char **)address ) = (char *)TMM_declare_var_1d( "char", (int)( ( length > 0 ) ? length : 1 ) );
-
-               output = *( (unsigned char **)address );
-            }
+            // The output array size must exactly match the incoming data
+            // size for opaque data.
+            output = (unsigned char *)string_storage.get_exact( (char **)address, 0, length );
 
             if ( output == NULL ) {
                ostringstream errmsg;
@@ -2829,7 +2750,7 @@ WARNING: For ENCODING_OPAQUE_DATA parameter '%s', decoded length %d > data buffe
 
             // Copy the characters over.
             if ( length > 0 ) {
-               memcpy( output, input, (size_t)length );
+               StringStorage::copy_if_changed( output, input, (size_t)length );
             }
 
          } else if ( num_items > 1 ) {
@@ -2925,29 +2846,9 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                }
 
                // 8-big characters.
-               output = *( (unsigned char **)address + i );
-
-               if ( output != NULL ) {
-                  // The output array size must exactly match the incoming data
-                  // size for opaque data.
-                  if ( (int)length != get_size( (char *)output ) ) {
-                     // WORKAROUND: Trick 10 can't handle a length of zero so to
-                     // workaround the memory manager problem use a size of 1 in
-                     // the allocation.
-                     *( (char **)address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)address + i ),
-                                                                                (int)( ( length > 0 ) ? length : 1 ) );
-
-                     output = *( (unsigned char **)address + i );
-                  }
-               } else {
-                  // Allocate memory for the output array.
-                  // WORKAROUND: Trick 10 can't handle a length of zero so to
-                  // workaround the memory manager problem use a size of 1 in
-                  // the allocation.
-                  *( (char **)address + i ) = (char *)TMM_declare_var_1d( "char", (int)( ( length > 0 ) ? length : 1 ) );
-
-                  output = *( (unsigned char **)address + i );
-               }
+               // The output array size must exactly match the incoming data
+               // size for opaque data.
+               output = (unsigned char *)string_storage.get_exact( (char **)address, i, length );
 
                if ( output == NULL ) {
                   ostringstream errmsg;
@@ -2960,7 +2861,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
                // Copy the characters over.
                if ( length > 0 ) {
-                  memcpy( output, input, (size_t)length );
+                  StringStorage::copy_if_changed( output, input, (size_t)length );
                   input += length;
                }
 
@@ -3032,20 +2933,12 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
 
             size_t length = ( end_index - start_index ) + 1;
 
-            if ( *( (char **)address + i ) != NULL ) {
+            // Reuse the memory for the sim string if it can hold the string,
+            // which includes the terminating null character, otherwise grow
+            // it geometrically.
+            output = (unsigned char *)string_storage.get_string( (char **)address, i, length );
 
-               // Determine if we need to allocate more memory for the sim string.
-               if ( (int)length >= get_size( *( (char **)address + i ) ) ) {
-                  int array_size            = Utilities::next_positive_multiple_of_8( length );
-                  *( (char **)address + i ) = (char *)TMM_resize_array_1d_a( *( (char **)address + i ), array_size );
-               }
-            } else {
-               // Allocate memory for the sim string.
-               int array_size            = Utilities::next_positive_multiple_of_8( length );
-               *( (char **)address + i ) = (char *)TMM_declare_var_1d( "char", array_size );
-            }
-
-            if ( *( (char **)address + i ) == NULL ) {
+            if ( output == NULL ) {
                ostringstream errmsg;
                errmsg << "Parameter::decode_string_from_buffer():" << __LINE__
                       << " ERROR: Could not allocate memory for ENCODING_C_STRING"
@@ -3055,7 +2948,7 @@ length %d > data buffer size %d, will use the data buffer size instead.%c",
                DebugHandler::terminate_with_message( errmsg.str() );
             }
 
-            memcpy( *( (char **)address + i ), ( input + start_index ), (size_t)length );
+            StringStorage::copy_if_changed( output, ( input + start_index ), length );
 
             // Move to the next encoded string in the input.
             end_index++;
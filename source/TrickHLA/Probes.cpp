@@ -0,0 +1,53 @@
+/*!
+@file TrickHLA/Probes.cpp
+@ingroup TrickHLA
+@brief Semaphores for the USDT (User Statically-Defined Tracing) probes.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Probes.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// TrickHLA include files.
+#include "TrickHLA/Probes.hh"
+
+#if defined( THLA_USDT_PROBES_AVAILABLE )
+
+// A tracer finds each semaphore through the probe notes and increments it
+// while it is attached, which is why they have to be in the .probes section.
+#   define THLA_PROBE_SEMAPHORE( name ) \
+      unsigned short trickhla_##name##_semaphore __attribute__( ( section( ".probes" ) ) ) = 0
+
+extern "C" {
+THLA_PROBE_SEMAPHORE( reflect_attributes );
+THLA_PROBE_SEMAPHORE( reflect_attribute );
+THLA_PROBE_SEMAPHORE( receive_interaction );
+THLA_PROBE_SEMAPHORE( time_advance_grant );
+THLA_PROBE_SEMAPHORE( send_cyclic_data );
+THLA_PROBE_SEMAPHORE( receive_cyclic_data );
+THLA_PROBE_SEMAPHORE( ownership_assumption_request );
+THLA_PROBE_SEMAPHORE( divestiture_confirmation );
+THLA_PROBE_SEMAPHORE( ownership_acquired );
+THLA_PROBE_SEMAPHORE( ownership_release_request );
+THLA_PROBE_SEMAPHORE( sync_point_registered );
+THLA_PROBE_SEMAPHORE( sync_point_announced );
+THLA_PROBE_SEMAPHORE( federation_synchronized );
+}
+
+#endif // THLA_USDT_PROBES_AVAILABLE
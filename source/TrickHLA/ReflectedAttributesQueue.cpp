@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, Feb 2019, --, Initial implementation.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Return the queue depth from push().}
 @revs_end
 
 */
@@ -73,7 +74,7 @@ bool ReflectedAttributesQueue::empty()
    return queue_is_empty;
 }
 
-void ReflectedAttributesQueue::push(
+size_t const ReflectedAttributesQueue::push(
    AttributeHandleValueMap const &theAttributes )
 {
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
@@ -81,6 +82,7 @@ void ReflectedAttributesQueue::push(
    MutexProtection auto_unlock_mutex( &queue_mutex );
 
    attribute_map_queue.push( theAttributes );
+   return attribute_map_queue.size();
 }
 
 void ReflectedAttributesQueue::pop()
@@ -15,11 +15,15 @@ NASA, Johnson Space Center\n
 2101 NASA Parkway, Houston, TX  77058
 
 @tldh
+@trick_link_dependency{EvokedCallbacks.cpp}
 @trick_link_dependency{SleepTimeout.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA/ER6, TrickHLA, July 2020, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Read the time from the TSCTimeline.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Deliver the evoked RTI callbacks while waiting.}
 @revs_end
 
 */
@@ -29,11 +33,10 @@ NASA, Johnson Space Center\n
 #include <limits>
 #include <time.h>
 
-// Trick include files.
-#include "trick/clock_proto.h"
-
 // TrickHLA include files.
+#include "TrickHLA/EvokedCallbacks.hh"
 #include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/TSCTimeline.hh"
 
 using namespace TrickHLA;
 
@@ -98,14 +101,23 @@ void SleepTimeout::set(
    reset();
 }
 
+/*!
+ * @details With the HLA_EVOKED callback model the thread that evokes the
+ * callbacks delivers them while it waits, otherwise nothing would deliver the
+ * callbacks the wait loops are waiting for.
+ */
 int const SleepTimeout::sleep() const
 {
+   if ( EvokedCallbacks::is_enabled()
+        && EvokedCallbacks::wait( (double)sleep_time.tv_sec + ( (double)sleep_time.tv_nsec * 1.0e-9 ) ) ) {
+      return 0;
+   }
    return nanosleep( &sleep_time, NULL );
 }
 
 int64_t const SleepTimeout::time() const
 {
-   return clock_wall_time();
+   return TSCTimeline::get_time_in_micros();
 }
 
 bool const SleepTimeout::timeout() const
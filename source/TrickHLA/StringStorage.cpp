@@ -0,0 +1,254 @@
+/*!
+@file TrickHLA/StringStorage.cpp
+@ingroup TrickHLA
+@brief This class manages the Trick memory used for the strings decoded into
+the simulation variables of an attribute or parameter.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{StringStorage.cpp}
+@trick_link_dependency{Utilities.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Always look up the allocation size.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstring>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+
+// TrickHLA include files.
+#include "TrickHLA/StringStorage.hh"
+#include "TrickHLA/Utilities.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+unsigned long long StringStorage::allocate_count     = 0;
+unsigned long long StringStorage::resize_count       = 0;
+unsigned long long StringStorage::lookup_count       = 0;
+unsigned long long StringStorage::reuse_count        = 0;
+unsigned long long StringStorage::copy_skipped_count = 0;
+
+/*!
+ * @job_class{initialization}
+ */
+StringStorage::StringStorage()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+StringStorage::~StringStorage()
+{
+   return;
+}
+
+/*!
+ * @details The size is looked up every time instead of being cached by the
+ * address of the string. A user can delete a string and allocate a shorter
+ * one, for example with mm_strdup(), and the allocator can return the same
+ * address, so a cached capacity would be larger than the new allocation.
+ */
+size_t StringStorage::get_capacity(
+   char *s )
+{
+   int const trick_size = get_size( s );
+   __atomic_add_fetch( &lookup_count, 1, __ATOMIC_RELAXED );
+
+   return ( trick_size > 0 ) ? (size_t)trick_size : 0;
+}
+
+char *StringStorage::get_string(
+   char       **strings,
+   size_t const index,
+   size_t const num_bytes )
+{
+   char *s = strings[index];
+
+   if ( s != NULL ) {
+      size_t const capacity = get_capacity( s );
+
+      if ( num_bytes <= capacity ) {
+         __atomic_add_fetch( &reuse_count, 1, __ATOMIC_RELAXED );
+         return s;
+      }
+
+      // Grow geometrically so a string that keeps getting longer settles
+      // after a few resizes.
+      size_t new_capacity = Utilities::next_positive_multiple_of_8( num_bytes );
+      if ( new_capacity < ( 2 * capacity ) ) {
+         new_capacity = 2 * capacity;
+      }
+      s = (char *)TMM_resize_array_1d_a( s, (int)new_capacity );
+      __atomic_add_fetch( &resize_count, 1, __ATOMIC_RELAXED );
+   } else {
+      // Include room for the terminating null character and add a few more
+      // bytes to give us a little more space for next time.
+      size_t const new_capacity = Utilities::next_positive_multiple_of_8( num_bytes );
+
+      s = (char *)TMM_declare_var_1d( "char", (int)new_capacity );
+      __atomic_add_fetch( &allocate_count, 1, __ATOMIC_RELAXED );
+   }
+
+   strings[index] = s;
+
+   return s;
+}
+
+/*!
+ * @details The HLAopaqueData encoder uses the size of the Trick allocation as
+ * the number of bytes to send, so the allocation must be exactly the size of
+ * the data and cannot be grown geometrically.
+ */
+char *StringStorage::get_exact(
+   char       **strings,
+   size_t const index,
+   size_t const num_bytes )
+{
+   // Trick can not allocate zero bytes so use at least one.
+   size_t const alloc_size = ( num_bytes > 0 ) ? num_bytes : 1;
+
+   char *s = strings[index];
+
+   if ( s != NULL ) {
+      if ( get_capacity( s ) == alloc_size ) {
+         __atomic_add_fetch( &reuse_count, 1, __ATOMIC_RELAXED );
+         return s;
+      }
+      s = (char *)TMM_resize_array_1d_a( s, (int)alloc_size );
+      __atomic_add_fetch( &resize_count, 1, __ATOMIC_RELAXED );
+   } else {
+      s = (char *)TMM_declare_var_1d( "char", (int)alloc_size );
+      __atomic_add_fetch( &allocate_count, 1, __ATOMIC_RELAXED );
+   }
+
+   strings[index] = s;
+
+   return s;
+}
+
+bool StringStorage::copy_if_changed(
+   void        *dest,
+   void const  *src,
+   size_t const num_bytes )
+{
+   if ( memcmp( dest, src, num_bytes ) == 0 ) {
+      __atomic_add_fetch( &copy_skipped_count, 1, __ATOMIC_RELAXED );
+      return false;
+   }
+   memcpy( dest, src, num_bytes );
+   return true;
+}
+
+void StringStorage::reset_counters()
+{
+   __atomic_store_n( &allocate_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &resize_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &lookup_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &reuse_count, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &copy_skipped_count, 0, __ATOMIC_RELAXED );
+}
+
+string StringStorage::get_counters_summary()
+{
+   ostringstream msg;
+   msg << "StringStorage: TMM allocations:" << get_allocate_count()
+       << " TMM resizes:" << get_resize_count()
+       << " TMM size lookups:" << get_lookup_count()
+       << " reused:" << get_reuse_count()
+       << " copies skipped:" << get_copy_skipped_count();
+   return msg.str();
+}
+
+/*!
+ * @details A string is allocated larger than needed and decoded into, then
+ * deleted and a shorter string is allocated in its place, as a setter using
+ * mm_strdup() would do. The allocation is repeated a few times to try to get
+ * the same address back. Decoding the original length again must then grow
+ * the new allocation instead of writing past its end, and an exact size
+ * request must match the size of the new allocation.
+ */
+string const StringStorage::self_test()
+{
+   StringStorage storage;
+   char         *strings[1];
+
+   // Sizes in the same small allocator bin make getting the same address
+   // back likely.
+   strings[0] = (char *)TMM_declare_var_1d( "char", 24 );
+   if ( strings[0] == NULL ) {
+      return "FAILED: Could not allocate the test string.";
+   }
+
+   char *const original = storage.get_string( strings, 0, 20 );
+   if ( original == NULL ) {
+      return "FAILED: Could not decode into the test string.";
+   }
+   memset( original, 'x', 19 );
+   original[19] = '\0';
+
+   // Replace the string with a shorter one, trying to get the same address.
+   bool same_address = false;
+   for ( int i = 0; ( i < 16 ) && !same_address; ++i ) {
+      TMM_delete_var_a( strings[0] );
+      strings[0]   = (char *)TMM_declare_var_1d( "char", 12 );
+      same_address = ( strings[0] == original );
+   }
+   if ( strings[0] == NULL ) {
+      return "FAILED: Could not allocate the shorter test string.";
+   }
+
+   ostringstream msg;
+   bool          passed = true;
+
+   char *s = storage.get_string( strings, 0, 20 );
+   if ( ( s == NULL ) || ( get_size( s ) < 20 ) ) {
+      passed = false;
+      msg << " get_string() returned " << ( ( s != NULL ) ? get_size( s ) : 0 )
+          << " bytes for a 20 byte string.";
+   } else {
+      memset( s, 'y', 19 );
+      s[19] = '\0';
+   }
+
+   // The exact size data must also follow a replaced allocation.
+   TMM_delete_var_a( strings[0] );
+   strings[0] = (char *)TMM_declare_var_1d( "char", 12 );
+
+   s = storage.get_exact( strings, 0, 16 );
+   if ( ( s == NULL ) || ( get_size( s ) != 16 ) ) {
+      passed = false;
+      msg << " get_exact() returned " << ( ( s != NULL ) ? get_size( s ) : 0 )
+          << " bytes instead of 16.";
+   }
+
+   if ( strings[0] != NULL ) {
+      TMM_delete_var_a( strings[0] );
+   }
+
+   return string( passed ? "PASSED:" : "FAILED:" )
+          + ( same_address ? " The shorter string got the same address."
+                           : " The shorter string got a different address." )
+          + msg.str();
+}
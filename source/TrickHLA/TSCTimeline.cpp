@@ -0,0 +1,393 @@
+/*!
+@file TrickHLA/TSCTimeline.cpp
+@ingroup TrickHLA
+@brief This class is a low overhead monotonic timeline read from the
+calibrated invariant Time Stamp Counter (TSC) of the CPU.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Timeline.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <fstream>
+#include <pthread.h>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// Trick include files.
+#include "trick/clock_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/TSCTimeline.hh"
+
+#if defined( THLA_TSC_CLOCK ) && defined( __x86_64__ )
+#   define THLA_TSC_CLOCK_AVAILABLE
+#   include <cpuid.h>
+#   include <x86intrin.h>
+#endif
+
+using namespace std;
+using namespace TrickHLA;
+
+// Calibrate the TSC rate over this many nanoseconds.
+#define THLA_TSC_CALIBRATION_NS 20000000LL
+
+// Compare the TSC time to the system clock this often in nanoseconds.
+#define THLA_TSC_CHECK_INTERVAL_NS 100000000LL
+
+int                TSCTimeline::tsc_clock              = -1;
+uint32_t           TSCTimeline::seq_count              = 0;
+uint64_t           TSCTimeline::base_tsc               = 0;
+int64_t            TSCTimeline::base_ns                = 0;
+int64_t            TSCTimeline::base_lead_ns           = 0;
+uint64_t           TSCTimeline::ns_per_tick            = 0;
+int64_t            TSCTimeline::realtime_offset_ns     = 0;
+uint64_t           TSCTimeline::check_interval_ticks   = 0;
+int                TSCTimeline::updating               = 0;
+int64_t            TSCTimeline::drift_tolerance        = 10000;
+unsigned long long TSCTimeline::drift_checks           = 0;
+unsigned long long TSCTimeline::drift_steps            = 0;
+int64_t            TSCTimeline::max_drift              = 0;
+int64_t            TSCTimeline::last_drift             = 0;
+uint64_t           TSCTimeline::calibrated_ns_per_tick = 0;
+
+static pthread_once_t tsc_calibrate_once = PTHREAD_ONCE_INIT;
+
+static inline int64_t read_clock_ns(
+   clockid_t const id )
+{
+   struct timespec ts;
+   clock_gettime( id, &ts );
+   return ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec;
+}
+
+#if defined( THLA_TSC_CLOCK_AVAILABLE )
+/*!
+ * @brief Convert a TSC count to nanoseconds from the calibration base.
+ */
+static inline int64_t tsc_to_ns(
+   uint64_t const tsc,
+   uint64_t const base_tsc,
+   int64_t const  base_ns,
+   uint64_t const ns_per_tick )
+{
+   // A thread that read the TSC just before a calibration update can be a
+   // few ticks behind the new base.
+   if ( tsc >= base_tsc ) {
+      return base_ns + (int64_t)( ( (unsigned __int128)( tsc - base_tsc ) * ns_per_tick ) >> 32 );
+   }
+   return base_ns - (int64_t)( ( (unsigned __int128)( base_tsc - tsc ) * ns_per_tick ) >> 32 );
+}
+
+/*!
+ * @brief Read the TSC and CLOCK_MONOTONIC together, using the TSC count in
+ * the middle of the fastest of a few clock reads.
+ */
+static void read_tsc_and_clock(
+   uint64_t &tsc,
+   int64_t  &ns )
+{
+   uint64_t best_span = UINT64_MAX;
+   for ( int i = 0; i < 5; ++i ) {
+      uint64_t const before = __rdtsc();
+      int64_t const  now    = read_clock_ns( CLOCK_MONOTONIC );
+      uint64_t const after  = __rdtsc();
+      if ( ( after - before ) < best_span ) {
+         best_span = after - before;
+         tsc       = before + ( ( after - before ) / 2 );
+         ns        = now;
+      }
+   }
+}
+#endif // THLA_TSC_CLOCK_AVAILABLE
+
+/*!
+ * @job_class{initialization}
+ */
+TSCTimeline::TSCTimeline(
+   double t0 )
+   : Timeline( t0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TSCTimeline::~TSCTimeline()
+{
+   return;
+}
+
+double TSCTimeline::get_time()
+{
+   int64_t const ns = get_time_in_nanos();
+   return ( (double)( ns / 1000000000LL ) + ( (double)( ns % 1000000000LL ) * 0.000000001 ) );
+}
+
+void TSCTimeline::initialize()
+{
+   pthread_once( &tsc_calibrate_once, TSCTimeline::calibrate );
+}
+
+bool const TSCTimeline::is_tsc_clock()
+{
+   initialize();
+   return ( tsc_clock == 1 );
+}
+
+int64_t const TSCTimeline::get_time_in_nanos()
+{
+#if defined( THLA_TSC_CLOCK_AVAILABLE )
+   if ( __builtin_expect( __atomic_load_n( &tsc_clock, __ATOMIC_ACQUIRE ) == 1, 1 ) ) {
+      for ( ;; ) {
+         uint64_t const tsc = __rdtsc();
+
+         uint32_t const seq   = __atomic_load_n( &seq_count, __ATOMIC_ACQUIRE );
+         uint64_t const b_tsc = __atomic_load_n( &base_tsc, __ATOMIC_RELAXED );
+         int64_t const  b_ns  = __atomic_load_n( &base_ns, __ATOMIC_RELAXED );
+         uint64_t const rate  = __atomic_load_n( &ns_per_tick, __ATOMIC_RELAXED );
+         __atomic_thread_fence( __ATOMIC_ACQUIRE );
+         if ( ( ( seq & 1 ) != 0 ) || ( seq != __atomic_load_n( &seq_count, __ATOMIC_RELAXED ) ) ) {
+            continue;
+         }
+
+         int64_t drift;
+         if ( ( tsc > b_tsc ) && ( ( tsc - b_tsc ) >= check_interval_ticks )
+              && update_calibration( drift ) ) {
+            continue;
+         }
+         return tsc_to_ns( tsc, b_tsc, b_ns, rate );
+      }
+   }
+   if ( __atomic_load_n( &tsc_clock, __ATOMIC_ACQUIRE ) < 0 ) {
+      initialize();
+      return get_time_in_nanos();
+   }
+#endif // THLA_TSC_CLOCK_AVAILABLE
+   return read_clock_ns( CLOCK_MONOTONIC );
+}
+
+int64_t const TSCTimeline::get_realtime_in_nanos()
+{
+   if ( is_tsc_clock() ) {
+      return get_time_in_nanos() + __atomic_load_n( &realtime_offset_ns, __ATOMIC_RELAXED );
+   }
+   return read_clock_ns( CLOCK_REALTIME );
+}
+
+double const TSCTimeline::get_realtime_in_seconds()
+{
+   int64_t const ns = get_realtime_in_nanos();
+   return ( (double)( ns / 1000000000LL ) + ( (double)( ns % 1000000000LL ) * 0.000000001 ) );
+}
+
+int64_t const TSCTimeline::check_drift()
+{
+   int64_t drift = 0;
+   if ( is_tsc_clock() && !update_calibration( drift ) ) {
+      drift = __atomic_load_n( &last_drift, __ATOMIC_RELAXED );
+   }
+   return drift;
+}
+
+bool const TSCTimeline::is_tsc_usable()
+{
+#if defined( THLA_TSC_CLOCK_AVAILABLE )
+   // CPUID leaf 0x80000007 EDX bit 8 is the invariant TSC flag.
+   unsigned int eax, ebx, ecx, edx;
+   if ( ( __get_cpuid( 0x80000000, &eax, &ebx, &ecx, &edx ) == 0 ) || ( eax < 0x80000007 ) ) {
+      return false;
+   }
+   if ( ( __get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx ) == 0 ) || ( ( edx & ( 1U << 8 ) ) == 0 ) ) {
+      return false;
+   }
+
+   // Linux stops using the TSC as its clock source when it finds the TSC
+   // is not synchronized across the CPUs, so only use it when Linux does.
+   ifstream clock_source( "/sys/devices/system/clocksource/clocksource0/current_clocksource" );
+   if ( clock_source.is_open() ) {
+      string source;
+      clock_source >> source;
+      return ( source == "tsc" );
+   }
+   return true;
+#else
+   return false;
+#endif // THLA_TSC_CLOCK_AVAILABLE
+}
+
+void TSCTimeline::calibrate()
+{
+#if defined( THLA_TSC_CLOCK_AVAILABLE )
+   if ( is_tsc_usable() ) {
+      uint64_t tsc_begin, tsc_end;
+      int64_t  ns_begin, ns_end;
+
+      read_tsc_and_clock( tsc_begin, ns_begin );
+      struct timespec const wait = { 0, THLA_TSC_CALIBRATION_NS };
+      nanosleep( &wait, NULL );
+      read_tsc_and_clock( tsc_end, ns_end );
+
+      if ( ( tsc_end > tsc_begin ) && ( ns_end > ns_begin ) ) {
+         uint64_t const rate = (uint64_t)( ( (unsigned __int128)( ns_end - ns_begin ) << 32 ) / ( tsc_end - tsc_begin ) );
+         if ( rate > 0 ) {
+            base_tsc               = tsc_end;
+            base_ns                = ns_end;
+            ns_per_tick            = rate;
+            calibrated_ns_per_tick = rate;
+            realtime_offset_ns     = read_clock_ns( CLOCK_REALTIME ) - read_clock_ns( CLOCK_MONOTONIC );
+            check_interval_ticks   = (uint64_t)( ( (unsigned __int128)THLA_TSC_CHECK_INTERVAL_NS << 32 ) / rate );
+            __atomic_store_n( &tsc_clock, 1, __ATOMIC_RELEASE );
+            return;
+         }
+      }
+   }
+#endif // THLA_TSC_CLOCK_AVAILABLE
+   __atomic_store_n( &tsc_clock, 0, __ATOMIC_RELEASE );
+}
+
+/*!
+ * @details The new rate is the TSC rate measured over the interval since the
+ * last update. The conversion restarts from the system clock when the TSC
+ * time is behind, or ahead by more than the drift tolerance. When it is
+ * ahead by less it restarts from the TSC time, so that the time never goes
+ * back for a drift that small.
+ */
+bool const TSCTimeline::update_calibration(
+   int64_t &drift )
+{
+#if defined( THLA_TSC_CLOCK_AVAILABLE )
+   // Only one thread updates, the others keep using the current values.
+   if ( __atomic_exchange_n( &updating, 1, __ATOMIC_ACQUIRE ) != 0 ) {
+      return false;
+   }
+
+   uint64_t tsc;
+   int64_t  ns;
+   read_tsc_and_clock( tsc, ns );
+   int64_t const realtime_offset = read_clock_ns( CLOCK_REALTIME ) - read_clock_ns( CLOCK_MONOTONIC );
+
+   drift = tsc_to_ns( tsc, base_tsc, base_ns, ns_per_tick ) - ns;
+
+   uint64_t rate = ns_per_tick;
+   if ( ( tsc > base_tsc ) && ( ns > base_ns ) ) {
+      // Measure against the clock only, ignoring the drift already kept.
+      int64_t const clock_base_ns = base_ns - base_lead_ns;
+      if ( ns > clock_base_ns ) {
+         uint64_t const measured = (uint64_t)( ( (unsigned __int128)( ns - clock_base_ns ) << 32 ) / ( tsc - base_tsc ) );
+         if ( measured > 0 ) {
+            rate = measured;
+         }
+      }
+   }
+
+   int64_t new_base_ns = ns;
+   if ( ( drift > 0 ) && ( drift <= drift_tolerance ) ) {
+      new_base_ns = ns + drift;
+   } else if ( drift > drift_tolerance ) {
+      ++drift_steps;
+   }
+
+   __atomic_fetch_add( &seq_count, 1, __ATOMIC_ACQ_REL );
+   __atomic_store_n( &base_tsc, tsc, __ATOMIC_RELAXED );
+   __atomic_store_n( &base_ns, new_base_ns, __ATOMIC_RELAXED );
+   __atomic_store_n( &ns_per_tick, rate, __ATOMIC_RELAXED );
+   __atomic_store_n( &realtime_offset_ns, realtime_offset, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &seq_count, 1, __ATOMIC_RELEASE );
+
+   int64_t const abs_drift = ( drift < 0 ) ? -drift : drift;
+   if ( abs_drift > max_drift ) {
+      max_drift = abs_drift;
+   }
+   ++drift_checks;
+   base_lead_ns = new_base_ns - ns;
+   __atomic_store_n( &last_drift, drift, __ATOMIC_RELAXED );
+
+   __atomic_store_n( &updating, 0, __ATOMIC_RELEASE );
+   return true;
+#else
+   drift = 0;
+   return false;
+#endif // THLA_TSC_CLOCK_AVAILABLE
+}
+
+string const TSCTimeline::to_string()
+{
+   ostringstream msg;
+   if ( is_tsc_clock() ) {
+      double const calibrated_GHz = 4294967296.0 / (double)calibrated_ns_per_tick;
+      double const current_GHz    = 4294967296.0 / (double)__atomic_load_n( &ns_per_tick, __ATOMIC_RELAXED );
+      msg << "  Clock source: invariant TSC, calibrated at " << calibrated_GHz
+          << " GHz, now " << current_GHz << " GHz" << endl
+          << "  Drift checks: " << drift_checks
+          << ", steps back: " << drift_steps
+          << ", max drift: " << max_drift << " ns"
+          << ", tolerance: " << drift_tolerance << " ns";
+   } else {
+      msg << "  Clock source: clock_gettime(CLOCK_MONOTONIC)";
+   }
+   return msg.str();
+}
+
+string const TSCTimeline::benchmark(
+   unsigned int const reads )
+{
+   unsigned int const count = ( reads > 0 ) ? reads : 1;
+   int64_t            sink  = 0;
+
+   // Make sure the calibration is not part of the measurement.
+   initialize();
+
+   int64_t start = read_clock_ns( CLOCK_MONOTONIC );
+   for ( unsigned int i = 0; i < count; ++i ) {
+      sink += get_time_in_nanos();
+   }
+   double const tsc_ns = (double)( read_clock_ns( CLOCK_MONOTONIC ) - start ) / (double)count;
+
+   start = read_clock_ns( CLOCK_MONOTONIC );
+   for ( unsigned int i = 0; i < count; ++i ) {
+      sink += read_clock_ns( CLOCK_MONOTONIC );
+   }
+   double const monotonic_ns = (double)( read_clock_ns( CLOCK_MONOTONIC ) - start ) / (double)count;
+
+   start = read_clock_ns( CLOCK_MONOTONIC );
+   for ( unsigned int i = 0; i < count; ++i ) {
+      sink += clock_wall_time();
+   }
+   double const wall_ns = (double)( read_clock_ns( CLOCK_MONOTONIC ) - start ) / (double)count;
+
+   ostringstream msg;
+   msg << "  Mean clock read time over " << count << " reads:" << endl
+       << "    TSCTimeline::get_time_in_nanos(): " << tsc_ns << " ns"
+       << ( is_tsc_clock() ? "" : " (clock_gettime fallback)" ) << endl
+       << "    clock_gettime(CLOCK_MONOTONIC):   " << monotonic_ns << " ns" << endl
+       << "    Trick clock_wall_time():          " << wall_ns << " ns";
+
+   // Keep the compiler from removing the reads.
+   if ( sink == 0 ) {
+      msg << " ";
+   }
+   return msg.str();
+}
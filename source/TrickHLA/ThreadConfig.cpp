@@ -0,0 +1,240 @@
+/*!
+@file TrickHLA/ThreadConfig.cpp
+@ingroup TrickHLA
+@brief This class holds the CPU affinity, real-time priority and name for a
+thread that TrickHLA creates or first sees in an RTI callback, and applies
+them from that thread.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ThreadConfig.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/ThreadConfig.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Parse a list of cores and ranges such as "2,4-5" into the CPU set.
+bool parse_cpu_list(
+   char const *cpus,
+   cpu_set_t  &cpu_set )
+{
+   CPU_ZERO( &cpu_set );
+
+   char const *str = cpus;
+   while ( *str != '\0' ) {
+      char *end;
+      long  first = strtol( str, &end, 10 );
+      if ( ( end == str ) || ( first < 0 ) ) {
+         return false;
+      }
+      long last = first;
+      str       = end;
+      if ( *str == '-' ) {
+         ++str;
+         last = strtol( str, &end, 10 );
+         if ( ( end == str ) || ( last < first ) ) {
+            return false;
+         }
+         str = end;
+      }
+      if ( last >= CPU_SETSIZE ) {
+         return false;
+      }
+      for ( long cpu = first; cpu <= last; ++cpu ) {
+         CPU_SET( (int)cpu, &cpu_set );
+      }
+      while ( *str == ' ' ) {
+         ++str;
+      }
+      if ( *str == ',' ) {
+         ++str;
+      } else if ( *str != '\0' ) {
+         return false;
+      }
+      while ( *str == ' ' ) {
+         ++str;
+      }
+   }
+   return ( CPU_COUNT( &cpu_set ) > 0 );
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+ThreadConfig::ThreadConfig()
+   : cpus( NULL ),
+     priority( 0 ),
+     name( NULL ),
+     mutex(),
+     effective(),
+     thread_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ThreadConfig::~ThreadConfig()
+{
+   return;
+}
+
+void ThreadConfig::apply(
+   char const *default_name )
+{
+   pthread_t const thread = pthread_self();
+
+   // The kernel limits the thread name to 15 characters.
+   char const *thread_name = ( ( name != NULL ) && ( *name != '\0' ) ) ? name : default_name;
+   if ( thread_name == NULL ) {
+      thread_name = "";
+   } else {
+      char short_name[16];
+      strncpy( short_name, thread_name, sizeof( short_name ) - 1 );
+      short_name[sizeof( short_name ) - 1] = '\0';
+      pthread_setname_np( thread, short_name );
+   }
+
+   if ( ( cpus != NULL ) && ( *cpus != '\0' ) ) {
+      cpu_set_t cpu_set;
+      if ( !parse_cpu_list( cpus, cpu_set ) ) {
+         send_hs( stderr, "ThreadConfig::apply():%d WARNING: Invalid CPU list \
+'%s' for thread '%s', which must be cores and ranges like \"2,4-5\", so the \
+affinity is not changed.%c",
+                  __LINE__, cpus, thread_name, THLA_NEWLINE );
+      } else {
+         int const ret = pthread_setaffinity_np( thread, sizeof( cpu_set ), &cpu_set );
+         if ( ret != 0 ) {
+            send_hs( stderr, "ThreadConfig::apply():%d WARNING: Could not set \
+the CPU affinity of thread '%s' to '%s': %s%c",
+                     __LINE__, thread_name, cpus, strerror( ret ), THLA_NEWLINE );
+         }
+      }
+   }
+
+   if ( priority > 0 ) {
+      int const   min_priority = sched_get_priority_min( SCHED_FIFO );
+      int const   max_priority = sched_get_priority_max( SCHED_FIFO );
+      sched_param param;
+      param.sched_priority = ( priority < min_priority )   ? min_priority
+                             : ( priority > max_priority ) ? max_priority
+                                                           : priority;
+
+      int const ret = pthread_setschedparam( thread, SCHED_FIFO, &param );
+      if ( ret != 0 ) {
+         send_hs( stderr, "ThreadConfig::apply():%d WARNING: Could not set \
+thread '%s' to SCHED_FIFO priority %d, which usually needs the CAP_SYS_NICE \
+capability or a larger rtprio limit: %s%c",
+                  __LINE__, thread_name, param.sched_priority, strerror( ret ),
+                  THLA_NEWLINE );
+      }
+   }
+
+   string const description = describe_current_thread();
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+   this->effective = description;
+   ++this->thread_count;
+}
+
+string const ThreadConfig::get_effective()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( thread_count > 1 ) {
+      ostringstream msg;
+      msg << effective << " (last of " << thread_count << " threads)";
+      return msg.str();
+   }
+   return effective;
+}
+
+string const ThreadConfig::describe_current_thread()
+{
+   pthread_t const thread = pthread_self();
+   ostringstream   msg;
+
+   char thread_name[16];
+   if ( pthread_getname_np( thread, thread_name, sizeof( thread_name ) ) != 0 ) {
+      thread_name[0] = '\0';
+   }
+   msg << "tid:" << (long)syscall( SYS_gettid ) << " name:'" << thread_name << "'";
+
+   int         policy;
+   sched_param param;
+   if ( pthread_getschedparam( thread, &policy, &param ) == 0 ) {
+      msg << " policy:"
+          << ( ( policy == SCHED_FIFO ) ? "SCHED_FIFO"
+                                        : ( ( policy == SCHED_RR ) ? "SCHED_RR" : "SCHED_OTHER" ) )
+          << " priority:" << param.sched_priority;
+   }
+
+   cpu_set_t cpu_set;
+   if ( pthread_getaffinity_np( thread, sizeof( cpu_set ), &cpu_set ) == 0 ) {
+      // List the cores as ranges, such as "0-3,6".
+      msg << " cpus:";
+      bool first = true;
+      for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu ) {
+         if ( !CPU_ISSET( cpu, &cpu_set ) ) {
+            continue;
+         }
+         int last = cpu;
+         while ( ( ( last + 1 ) < CPU_SETSIZE ) && CPU_ISSET( last + 1, &cpu_set ) ) {
+            ++last;
+         }
+         msg << ( first ? "" : "," ) << cpu;
+         if ( last > cpu ) {
+            msg << "-" << last;
+         }
+         first = false;
+         cpu   = last;
+      }
+   }
+   return msg.str();
+}
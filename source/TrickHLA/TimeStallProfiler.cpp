@@ -0,0 +1,324 @@
+/*!
+@file TrickHLA/TimeStallProfiler.cpp
+@ingroup TrickHLA
+@brief This class finds which federate holds back the Time Advance Grants of
+this federate.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{TimeStallProfiler.cpp}
+@trick_link_dependency{LatencyHistogram.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+// TrickHLA include files.
+#include "TrickHLA/Int64Interval.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/StringUtilities.hh"
+#include "TrickHLA/TimeStallProfiler.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated"
+// HLA include files.
+#include <RTI/encoding/BasicDataElements.h>
+#pragma GCC diagnostic pop
+
+using namespace std;
+using namespace RTI1516_NAMESPACE;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+TimeStallProfiler::TimeStallProfiler()
+   : initialized( false ),
+     stall_threshold_ns( 0 ),
+     own_name(),
+     name_handle(),
+     time_handle(),
+     lookahead_handle(),
+     regulating_handle(),
+     constrained_handle(),
+     mutex(),
+     federates(),
+     wait_stats(),
+     stall_stats(),
+     unattributed_stalls( 0 ),
+     last_stall_ns( 0 ),
+     last_stall_requested( 0 ),
+     last_stall_GALT( -1 ),
+     last_stall_limiter()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TimeStallProfiler::~TimeStallProfiler()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void TimeStallProfiler::initialize(
+   wstring const  &own_name,
+   int64_t const   stall_threshold_ns,
+   AttributeHandle name_handle,
+   AttributeHandle time_handle,
+   AttributeHandle lookahead_handle,
+   AttributeHandle regulating_handle,
+   AttributeHandle constrained_handle )
+{
+   this->own_name           = own_name;
+   this->stall_threshold_ns = stall_threshold_ns;
+   this->name_handle        = name_handle;
+   this->time_handle        = time_handle;
+   this->lookahead_handle   = lookahead_handle;
+   this->regulating_handle  = regulating_handle;
+   this->constrained_handle = constrained_handle;
+   this->initialized        = true;
+}
+
+bool TimeStallProfiler::is_time_state_reflection(
+   AttributeHandleValueMap const &values ) const
+{
+   return ( this->initialized && ( values.find( time_handle ) != values.end() ) );
+}
+
+void TimeStallProfiler::reflect_time_state(
+   ObjectInstanceHandle const    &id,
+   AttributeHandleValueMap const &values )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   FederateTimeStateMap::iterator fed_iter = federates.find( id );
+   if ( fed_iter == federates.end() ) {
+      FederateTimeState state;
+      state.logical_time     = -1;
+      state.lookahead        = -1;
+      state.time_regulating  = false;
+      state.time_constrained = false;
+      state.stall_count      = 0;
+      state.stall_total_ns   = 0;
+      state.stall_max_ns     = 0;
+
+      fed_iter = federates.insert( FederateTimeStateMap::value_type( id, state ) ).first;
+   }
+   FederateTimeState &state = fed_iter->second;
+
+   AttributeHandleValueMap::const_iterator attr_iter = values.find( name_handle );
+   if ( attr_iter != values.end() ) {
+      HLAunicodeString name_unicode;
+      name_unicode.decode( attr_iter->second );
+      state.name = wstring( name_unicode );
+   }
+
+   attr_iter = values.find( time_handle );
+   if ( attr_iter != values.end() ) {
+      (void)decode_time( attr_iter->second, state.logical_time );
+   }
+
+   attr_iter = values.find( lookahead_handle );
+   if ( attr_iter != values.end() ) {
+      (void)decode_time( attr_iter->second, state.lookahead );
+   }
+
+   attr_iter = values.find( regulating_handle );
+   if ( attr_iter != values.end() ) {
+      (void)decode_boolean( attr_iter->second, state.time_regulating );
+   }
+
+   attr_iter = values.find( constrained_handle );
+   if ( attr_iter != values.end() ) {
+      (void)decode_boolean( attr_iter->second, state.time_constrained );
+   }
+}
+
+void TimeStallProfiler::remove_federate(
+   ObjectInstanceHandle const &id )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   FederateTimeStateMap::iterator fed_iter = federates.find( id );
+   if ( ( fed_iter != federates.end() ) && ( fed_iter->second.stall_count == 0 ) ) {
+      // Keep the federates that limited us for the report.
+      federates.erase( fed_iter );
+   }
+}
+
+/*!
+ * @details The GALT of a time constrained federate is the smallest logical
+ * time plus lookahead of the other time regulating federates, so the
+ * federate with the smallest sum is the one holding back the grant.
+ */
+void TimeStallProfiler::record_wait(
+   int64_t const wait_ns,
+   int64_t const requested_micros,
+   int64_t const GALT_micros )
+{
+   wait_stats.record( wait_ns );
+
+   if ( wait_ns < this->stall_threshold_ns ) {
+      return;
+   }
+   stall_stats.record( wait_ns );
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   FederateTimeState *limiter      = NULL;
+   int64_t            limit_micros = INT64_MAX;
+
+   FederateTimeStateMap::iterator fed_iter;
+   for ( fed_iter = federates.begin(); fed_iter != federates.end(); ++fed_iter ) {
+      FederateTimeState &state = fed_iter->second;
+      if ( state.time_regulating
+           && ( state.logical_time >= 0 )
+           && ( state.name != this->own_name ) ) {
+         int64_t const micros = state.logical_time + ( ( state.lookahead > 0 ) ? state.lookahead : 0 );
+         if ( micros < limit_micros ) {
+            limit_micros = micros;
+            limiter      = &state;
+         }
+      }
+   }
+
+   this->last_stall_ns        = wait_ns;
+   this->last_stall_requested = requested_micros;
+   this->last_stall_GALT      = GALT_micros;
+
+   if ( limiter != NULL ) {
+      ++limiter->stall_count;
+      limiter->stall_total_ns += wait_ns;
+      if ( wait_ns > limiter->stall_max_ns ) {
+         limiter->stall_max_ns = wait_ns;
+      }
+      this->last_stall_limiter = limiter->name;
+   } else {
+      ++this->unattributed_stalls;
+      this->last_stall_limiter = L"";
+   }
+}
+
+string const TimeStallProfiler::to_string()
+{
+   ostringstream msg;
+   msg << "  TAR to TAG wait: " << wait_stats.to_string() << endl
+       << "  Stalls of " << ( stall_threshold_ns / 1000 ) << " microseconds or more: "
+       << stall_stats.to_string() << endl;
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( stall_stats.get_count() > 0 ) {
+      string limiter_name;
+      StringUtilities::to_string( limiter_name, last_stall_limiter );
+      msg << "  Last stall: " << ( last_stall_ns / 1000 ) << " microseconds waiting for "
+          << Int64Interval::to_seconds( last_stall_requested ) << " seconds, GALT ";
+      if ( last_stall_GALT >= 0 ) {
+         msg << Int64Interval::to_seconds( last_stall_GALT ) << " seconds";
+      } else {
+         msg << "not known";
+      }
+      msg << ", limited by " << ( limiter_name.empty() ? "an unknown federate" : limiter_name )
+          << endl;
+   }
+
+   msg << "  " << left << setw( 32 ) << "Federate" << right
+       << setw( 8 ) << "Stalls" << setw( 14 ) << "Stall-Mean-us" << setw( 14 ) << "Stall-Max-us"
+       << setw( 16 ) << "Logical-Time" << setw( 12 ) << "Lookahead"
+       << setw( 5 ) << "Reg" << setw( 5 ) << "Con" << endl;
+
+   FederateTimeStateMap::const_iterator fed_iter;
+   for ( fed_iter = federates.begin(); fed_iter != federates.end(); ++fed_iter ) {
+      FederateTimeState const &state = fed_iter->second;
+
+      string name;
+      StringUtilities::to_string( name, state.name );
+
+      msg << "  " << left << setw( 32 ) << name.substr( 0, 31 ) << right
+          << setw( 8 ) << state.stall_count
+          << setw( 14 ) << ( ( state.stall_count > 0 ) ? ( state.stall_total_ns / (int64_t)state.stall_count / 1000 ) : 0 )
+          << setw( 14 ) << ( state.stall_max_ns / 1000 )
+          << setw( 16 ) << ( ( state.logical_time >= 0 ) ? Int64Interval::to_seconds( state.logical_time ) : -1.0 )
+          << setw( 12 ) << ( ( state.lookahead >= 0 ) ? Int64Interval::to_seconds( state.lookahead ) : -1.0 )
+          << setw( 5 ) << ( state.time_regulating ? "yes" : "no" )
+          << setw( 5 ) << ( state.time_constrained ? "yes" : "no" ) << endl;
+   }
+   if ( unattributed_stalls > 0 ) {
+      msg << "  Stalls with no known limiting federate: " << unattributed_stalls << endl;
+   }
+   return msg.str();
+}
+
+bool TimeStallProfiler::decode_time(
+   VariableLengthData const &data,
+   int64_t                  &value )
+{
+   unsigned char const *bytes = (unsigned char const *)data.data();
+   size_t               size  = data.size();
+
+   // Skip the element count of the HLAopaqueData encoding.
+   if ( size == 12 ) {
+      bytes += 4;
+      size -= 4;
+   }
+   if ( ( size != 8 ) || ( bytes == NULL ) ) {
+      return false;
+   }
+
+   uint64_t big_endian = 0;
+   for ( size_t i = 0; i < 8; ++i ) {
+      big_endian = ( big_endian << 8 ) | bytes[i];
+   }
+   value = (int64_t)big_endian;
+   return true;
+}
+
+bool TimeStallProfiler::decode_boolean(
+   VariableLengthData const &data,
+   bool                     &value )
+{
+   // HLAboolean is an HLAinteger32BE enumeration where 1 is true.
+   unsigned char const *bytes = (unsigned char const *)data.data();
+   if ( ( data.size() != 4 ) || ( bytes == NULL ) ) {
+      return false;
+   }
+   value = ( bytes[3] != 0 );
+   return true;
+}
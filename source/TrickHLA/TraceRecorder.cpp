@@ -0,0 +1,278 @@
+/*!
+@file TrickHLA/TraceRecorder.cpp
+@ingroup TrickHLA
+@brief This class records the begin and end times of the HLA frame phases and
+RTI callbacks and writes them out as a Chrome trace.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{TraceRecorder.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdio>
+#include <pthread.h>
+#include <string>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/MutexProtection.hh"
+#include "TrickHLA/TraceRecorder.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// A recorded event. The category and name point to string literals.
+typedef struct {
+   char const *category;
+   char const *name;
+   int64_t     begin_ns;
+   int64_t     end_ns;
+   int         obj_id;
+   int         attr_id;
+} TraceEvent;
+
+// Ring buffer of events for one thread. Only the owning thread writes to it.
+typedef struct {
+   TraceEvent        *events;
+   unsigned long long mask;
+   unsigned long long head;
+   long               tid;
+   char               thread_name[16];
+} TraceRing;
+
+// The rings are kept after their thread exits so the events can be written.
+MutexLock                  rings_mutex;
+std::vector< TraceRing * > rings;
+
+// Ring of the calling thread, or NULL if it has not recorded an event yet.
+__thread TraceRing *thread_ring = NULL;
+
+TraceRing *create_thread_ring(
+   size_t const events_per_thread )
+{
+   size_t capacity = 1;
+   while ( capacity < events_per_thread ) {
+      capacity <<= 1;
+   }
+
+   TraceRing *ring = new TraceRing();
+   ring->events    = new TraceEvent[capacity];
+   ring->mask      = capacity - 1;
+   ring->head      = 0;
+   ring->tid       = (long)syscall( SYS_gettid );
+   if ( pthread_getname_np( pthread_self(), ring->thread_name, sizeof( ring->thread_name ) ) != 0 ) {
+      ring->thread_name[0] = '\0';
+   }
+
+   MutexProtection auto_unlock_mutex( &rings_mutex );
+   rings.push_back( ring );
+   return ring;
+}
+
+// Write a string as a JSON string value.
+void write_json_string(
+   FILE       *fp,
+   char const *str )
+{
+   fputc( '"', fp );
+   for ( char const *c = str; *c != '\0'; ++c ) {
+      if ( ( *c == '"' ) || ( *c == '\\' ) ) {
+         fputc( '\\', fp );
+         fputc( *c, fp );
+      } else if ( (unsigned char)*c < 0x20 ) {
+         fprintf( fp, "\\u%04x", (unsigned int)(unsigned char)*c );
+      } else {
+         fputc( *c, fp );
+      }
+   }
+   fputc( '"', fp );
+}
+
+// Index of the oldest event to write for the given head. A thread that
+// started recording before it saw recording disabled can still write one
+// event at the head, which overwrites the oldest slot of a full ring, so that
+// slot is skipped.
+unsigned long long first_event_index(
+   TraceRing const         *ring,
+   unsigned long long const head )
+{
+   return ( head > ring->mask ) ? ( head - ring->mask ) : 0;
+}
+
+} // namespace
+
+bool   TraceRecorder::enabled           = false;
+size_t TraceRecorder::events_per_thread = 65536;
+
+void TraceRecorder::enable(
+   size_t const events_per_thread )
+{
+   TraceRecorder::events_per_thread = ( events_per_thread > 0 ) ? events_per_thread : 1;
+   __atomic_store_n( &enabled, true, __ATOMIC_RELEASE );
+}
+
+void TraceRecorder::disable()
+{
+   __atomic_store_n( &enabled, false, __ATOMIC_RELEASE );
+}
+
+int64_t TraceRecorder::now()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ( ( (int64_t)ts.tv_sec * 1000000000LL ) + (int64_t)ts.tv_nsec );
+}
+
+/*!
+ * @details The event is written before the head is advanced with release
+ * semantics, so a reader that loads the head with acquire semantics sees
+ * every event before it. A scope opened before recording was disabled is
+ * dropped here so it does not write into a ring that is being read.
+ */
+void TraceRecorder::record(
+   char const   *category,
+   char const   *name,
+   int64_t const begin_ns,
+   int64_t const end_ns,
+   int const     obj_id,
+   int const     attr_id )
+{
+   if ( !__atomic_load_n( &enabled, __ATOMIC_ACQUIRE ) ) {
+      return;
+   }
+
+   TraceRing *ring = thread_ring;
+   if ( ring == NULL ) {
+      ring        = create_thread_ring( events_per_thread );
+      thread_ring = ring;
+   }
+
+   unsigned long long const head  = ring->head;
+   TraceEvent              &event = ring->events[head & ring->mask];
+
+   event.category = category;
+   event.name     = name;
+   event.begin_ns = begin_ns;
+   event.end_ns   = end_ns;
+   event.obj_id   = obj_id;
+   event.attr_id  = attr_id;
+
+   __atomic_store_n( &ring->head, head + 1, __ATOMIC_RELEASE );
+}
+
+/*!
+ * @details The events are written as complete ("X") events with the times in
+ * microseconds from the earliest event, along with a thread name metadata
+ * ("M") event for each thread. Recording is disabled first so the rings are
+ * not overwritten while they are being read.
+ */
+bool TraceRecorder::write_chrome_trace(
+   string const &file_name )
+{
+   disable();
+
+   FILE *fp = fopen( file_name.c_str(), "w" );
+   if ( fp == NULL ) {
+      send_hs( stderr, "TraceRecorder::write_chrome_trace():%d WARNING: Could not open the trace file '%s' for writing!%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return false;
+   }
+
+   MutexProtection auto_unlock_mutex( &rings_mutex );
+
+   long const pid = (long)getpid();
+
+   // Take the heads once so both passes see the same events.
+   std::vector< unsigned long long > heads( rings.size() );
+   for ( size_t r = 0; r < rings.size(); ++r ) {
+      heads[r] = __atomic_load_n( &rings[r]->head, __ATOMIC_ACQUIRE );
+   }
+
+   // Use the earliest event as the time origin to keep the numbers small.
+   int64_t origin_ns = 0;
+   bool    found     = false;
+   for ( size_t r = 0; r < rings.size(); ++r ) {
+      unsigned long long const head = heads[r];
+      for ( unsigned long long i = first_event_index( rings[r], head ); i < head; ++i ) {
+         int64_t const begin_ns = rings[r]->events[i & rings[r]->mask].begin_ns;
+         if ( !found || ( begin_ns < origin_ns ) ) {
+            origin_ns = begin_ns;
+            found     = true;
+         }
+      }
+   }
+
+   fprintf( fp, "{\"traceEvents\":[\n" );
+   bool first = true;
+
+   for ( size_t r = 0; r < rings.size(); ++r ) {
+      TraceRing const *ring = rings[r];
+
+      if ( ring->thread_name[0] != '\0' ) {
+         fprintf( fp, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%ld,\"tid\":%ld,\"args\":{\"name\":",
+                  ( first ? "" : ",\n" ), pid, ring->tid );
+         write_json_string( fp, ring->thread_name );
+         fprintf( fp, "}}" );
+         first = false;
+      }
+
+      unsigned long long const head = heads[r];
+      for ( unsigned long long i = first_event_index( ring, head ); i < head; ++i ) {
+         TraceEvent const &event = ring->events[i & ring->mask];
+
+         fprintf( fp, "%s{\"ph\":\"X\",\"name\":", ( first ? "" : ",\n" ) );
+         write_json_string( fp, event.name );
+         fprintf( fp, ",\"cat\":" );
+         write_json_string( fp, event.category );
+         fprintf( fp, ",\"pid\":%ld,\"tid\":%ld,\"ts\":%.3f,\"dur\":%.3f",
+                  pid, ring->tid,
+                  (double)( event.begin_ns - origin_ns ) / 1000.0,
+                  (double)( event.end_ns - event.begin_ns ) / 1000.0 );
+         if ( ( event.obj_id >= 0 ) || ( event.attr_id >= 0 ) ) {
+            fprintf( fp, ",\"args\":{\"obj\":%d,\"attr\":%d}", event.obj_id, event.attr_id );
+         }
+         fprintf( fp, "}" );
+         first = false;
+      }
+   }
+
+   fprintf( fp, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+
+   bool const success = ( ferror( fp ) == 0 );
+   if ( fclose( fp ) != 0 || !success ) {
+      send_hs( stderr, "TraceRecorder::write_chrome_trace():%d WARNING: Error writing the trace file '%s'!%c",
+               __LINE__, file_name.c_str(), THLA_NEWLINE );
+      return false;
+   }
+   return true;
+}
@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{EventCount.cpp}
 @trick_link_dependency{Federate.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{MutexLock.cpp}
@@ -30,6 +31,9 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, March 2023, --, Initial implementation.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Atomic thread states with event count wakeups.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Track the thread associated to each object.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added a CPU pause hint in the spin waits.}
 @revs_end
 
 */
@@ -39,16 +43,20 @@ NASA, Johnson Space Center\n
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <sched.h>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // Trick include files.
+#include "trick/clock_proto.h"
 #include "trick/exec_proto.h"
 #include "trick/memorymanager_c_intf.h"
 #include "trick/message_proto.h"
 
 // TrickHLA include files.
 #include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/EventCount.hh"
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/MutexLock.hh"
@@ -62,6 +70,25 @@ NASA, Johnson Space Center\n
 using namespace std;
 using namespace TrickHLA;
 
+namespace
+{
+
+/*!
+ * @brief Tell the CPU this is a spin-wait loop, which frees the core for a
+ * hyper-thread sibling and avoids the pipeline flush when the loop exits, or
+ * yield the CPU if there is no pause instruction.
+ */
+inline void spin_pause()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+   __builtin_ia32_pause();
+#else
+   sched_yield();
+#endif
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
@@ -71,10 +98,17 @@ TrickThreadCoordinator::TrickThreadCoordinator() // RETURN: -- None.
      mutex(),
      thread_state( NULL ),
      thread_state_cnt( 0 ),
+     send_pending_cnt( 0 ),
+     main_thread_event(),
+     child_thread_event(),
      data_cycle_micros_per_thread( NULL ),
      data_cycle_micros_per_obj( NULL ),
+     thread_id_per_obj( NULL ),
      any_child_thread_associated( false ),
-     main_thread_data_cycle_micros( 0LL )
+     main_thread_data_cycle_micros( 0LL ),
+     main_wait_count( 0 ),
+     main_wait_total_micros( 0LL ),
+     main_wait_max_micros( 0LL )
 {
    return;
 }
@@ -90,9 +124,7 @@ TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
    // Release the arrays.
    if ( this->thread_state != NULL ) {
       this->thread_state_cnt = 0;
-      if ( TMM_is_alloced( (char *)this->thread_state ) ) {
-         TMM_delete_var_a( this->thread_state );
-      }
+      free( this->thread_state );
       this->thread_state = NULL;
    }
    if ( this->data_cycle_micros_per_thread != NULL ) {
@@ -107,6 +139,12 @@ TrickThreadCoordinator::~TrickThreadCoordinator() // RETURN: -- None.
       }
       this->data_cycle_micros_per_obj = NULL;
    }
+   if ( this->thread_id_per_obj != NULL ) {
+      if ( TMM_is_alloced( (char *)this->thread_id_per_obj ) ) {
+         TMM_delete_var_a( this->thread_id_per_obj );
+      }
+      this->thread_id_per_obj = NULL;
+   }
 }
 
 /*!
@@ -155,8 +193,15 @@ void TrickThreadCoordinator::initialize_thread_state(
       this->thread_state_cnt = 1;
    }
 
-   // Allocate the thread state array for all the Trick threads (main + child).
-   this->thread_state = (unsigned int *)TMM_declare_var_1d( "unsigned int", this->thread_state_cnt );
+   // Allocate the thread state array for all the Trick threads (main + child)
+   // aligned to a cache line so each thread state has its own cache line.
+   void *state_memory = NULL;
+   if ( posix_memalign( &state_memory, THLA_CACHE_LINE_SIZE,
+                        this->thread_state_cnt * sizeof( TrickThreadState ) )
+        != 0 ) {
+      state_memory = NULL;
+   }
+   this->thread_state = (TrickThreadState *)state_memory;
    if ( this->thread_state == NULL ) {
       ostringstream errmsg;
       errmsg << "TrickThreadCoordinator::initialize_thread_state():" << __LINE__
@@ -170,7 +215,7 @@ void TrickThreadCoordinator::initialize_thread_state(
    // We don't know if the Child threads are running TrickHLA jobs yet so
    // mark them all as not associated.
    for ( unsigned int id = 0; id < this->thread_state_cnt; ++id ) {
-      this->thread_state[id] = THREAD_STATE_NOT_ASSOCIATED;
+      set_thread_state( id, THREAD_STATE_NOT_ASSOCIATED );
    }
 
    // Allocate memory for the data cycle times per each thread.
@@ -203,6 +248,21 @@ void TrickThreadCoordinator::initialize_thread_state(
       for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
          this->data_cycle_micros_per_obj[obj_index] = 0LL;
       }
+
+      // Allocate memory for the thread-id each object instance is associated to.
+      this->thread_id_per_obj = (unsigned int *)TMM_declare_var_1d( "unsigned int", this->manager->obj_count );
+      if ( this->thread_id_per_obj == NULL ) {
+         ostringstream errmsg;
+         errmsg << "TrickThreadCoordinator::initialize_thread_state():" << __LINE__
+                << " ERROR: Could not allocate memory for 'thread_id_per_obj'"
+                << " for requested size " << this->manager->obj_count
+                << "'!" << THLA_ENDL;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         exit( 1 );
+      }
+      for ( unsigned int obj_index = 0; obj_index < this->manager->obj_count; ++obj_index ) {
+         this->thread_id_per_obj[obj_index] = 0;
+      }
    }
 
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
@@ -279,7 +339,7 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
    }
 
    // We do not support more than one thread association to the same thread-id.
-   if ( this->thread_state[thread_id] != THREAD_STATE_NOT_ASSOCIATED ) {
+   if ( get_thread_state( thread_id ) != THREAD_STATE_NOT_ASSOCIATED ) {
       ostringstream errmsg;
       errmsg << "TrickThreadCoordinator::associate_to_trick_child_thread():" << __LINE__
              << " ERROR: You can not associate the same Trick "
@@ -363,12 +423,27 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
                       << " ensure data coherency." << THLA_ENDL;
                DebugHandler::terminate_with_message( errmsg.str() );
 
+            } else if ( this->federate->child_thread_data_exchange
+                        && ( this->thread_id_per_obj[obj_index] != 0 )
+                        && ( this->thread_id_per_obj[obj_index] != thread_id ) ) {
+               ostringstream errmsg;
+               errmsg << "TrickThreadCoordinator::associate_to_trick_child_thread():" << __LINE__
+                      << " ERROR: For the object instance name specified:'"
+                      << obj_instance_name << "', the object is already"
+                      << " associated to the Trick child thread (thread-id:"
+                      << this->thread_id_per_obj[obj_index] << "). With"
+                      << " 'child_thread_data_exchange' enabled an object"
+                      << " instance can only be associated to one thread, which"
+                      << " sends and receives its data." << THLA_ENDL;
+               DebugHandler::terminate_with_message( errmsg.str() );
+
             } else {
                found_object            = true;
                any_valid_instance_name = true;
 
                this->data_cycle_micros_per_thread[thread_id] = data_cycle_micros;
                this->data_cycle_micros_per_obj[obj_index]    = data_cycle_micros;
+               this->thread_id_per_obj[obj_index]            = thread_id;
             }
          }
       }
@@ -407,7 +482,7 @@ void TrickThreadCoordinator::associate_to_trick_child_thread(
    }
 
    // Make sure we mark the thread state as reset now that we associated to it.
-   this->thread_state[thread_id] = THREAD_STATE_RESET;
+   set_thread_state( thread_id, THREAD_STATE_RESET );
 
    if ( thread_id == 0 ) {
       // Ensure we set the data cycle time for the main thread even if no
@@ -434,22 +509,33 @@ void TrickThreadCoordinator::announce_data_available()
 
       int64_t const sim_time_micros = Int64Interval::to_microseconds( exec_get_sim_time() );
 
-      // When auto_unlock_mutex goes out of scope it automatically unlocks the
-      // mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
+      // Count the child threads the main thread will wait on to send before
+      // changing any of their states, so that the last one to be ready to
+      // send can wake the main thread.
+      int pending_cnt = 0;
+      for ( unsigned int id = 1; id < this->thread_state_cnt; ++id ) {
+         if ( ( get_thread_state( id ) != THREAD_STATE_NOT_ASSOCIATED )
+              && on_data_cycle_boundary_for_thread( id, sim_time_micros ) ) {
+            ++pending_cnt;
+         }
+      }
+      __atomic_store_n( &send_pending_cnt, pending_cnt, __ATOMIC_SEQ_CST );
 
       // Process all the Trick child threads associated to TrickHLA first
       // and only for threads on the data cycle time boundary.
       for ( unsigned int id = 1; id < this->thread_state_cnt; ++id ) {
-         if ( ( this->thread_state[id] != THREAD_STATE_NOT_ASSOCIATED )
+         if ( ( get_thread_state( id ) != THREAD_STATE_NOT_ASSOCIATED )
               && on_data_cycle_boundary_for_thread( id, sim_time_micros ) ) {
 
-            this->thread_state[id] = THREAD_STATE_READY_TO_RECEIVE;
+            set_thread_state( id, THREAD_STATE_READY_TO_RECEIVE );
          }
       }
 
       // Set the state of the Trick main thread last.
-      this->thread_state[0] = THREAD_STATE_READY_TO_RECEIVE;
+      set_thread_state( 0, THREAD_STATE_READY_TO_RECEIVE );
+
+      // Wake any child threads waiting to receive.
+      child_thread_event.notify_all();
    }
 }
 
@@ -466,12 +552,11 @@ void TrickThreadCoordinator::announce_data_sent()
    // Process Trick child thread states associated to TrickHLA.
    if ( this->any_child_thread_associated ) {
 
-      // When auto_unlock_mutex goes out of scope it automatically unlocks the
-      // mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
       // Set the state of the main thread as ready to send.
-      this->thread_state[0] = THREAD_STATE_READY_TO_SEND;
+      set_thread_state( 0, THREAD_STATE_READY_TO_SEND );
+
+      // Wake any child threads waiting for the data to be sent.
+      child_thread_event.notify_all();
    }
 }
 
@@ -508,6 +593,9 @@ void TrickThreadCoordinator::wait_to_send_data()
  * @brief Trick main thread will wait for all associated Trick child threads
  * to have called the wait_to_send_data() function from S_define sim-object
  * to indicate they are ready to send data.
+ * @details The thread states are checked with atomic loads, first spinning
+ * briefly and then blocking on an event count, which the last child thread
+ * to be ready to send signals.
  */
 void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
 {
@@ -520,52 +608,23 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
    // before returning.
 
    int64_t const sim_time_micros = Int64Interval::to_microseconds( exec_get_sim_time() );
+   int64_t const start_time      = clock_wall_time();
 
    // Don't check the Trick main thread (id = 0), only check child threads.
    unsigned int id = 1;
 
    // Trick Main Thread: Take a quick first look to determine if all the
    // Trick child threads associated to TrickHLA are ready to send data.
-   // If all the child threads are ready to send data then this quick look
-   // will return faster than the more involved spin-lock code section
-   // further below with the sleep code.
-   bool all_ready_to_send = true;
-   {
-      // When auto_unlock_mutex goes out of scope it automatically
-      // unlocks the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
-      // Check all the associated thread-id's.
-      while ( ( id < this->thread_state_cnt ) && all_ready_to_send ) {
-
-         // If the state is THREAD_STATE_NOT_ASSOCIATED then there are
-         // no TrickHLA jobs on this thread, so move on to the next
-         // thread-id. If the state is THREAD_STATE_READY_TO_SEND then
-         // this thread-id is ready, so check the next ID. Otherwise we
-         // are not ready to send and don't move on from the current
-         // thread-id. Skip this child thread if it is not scheduled to
-         // run at the same time as the main thread for this job.
-         // Also skip if this thread is not on a data cycle boundary.
-         if ( ( this->thread_state[id] == THREAD_STATE_READY_TO_SEND )
-              || ( this->thread_state[id] == THREAD_STATE_NOT_ASSOCIATED )
-              || !on_data_cycle_boundary_for_thread( id, sim_time_micros ) ) {
-            // Move to the next thread-id because the current ID is
-            // ready. This results in checking all the ID's just once.
-            ++id;
-         } else {
-            // Stay on the current ID and indicate not ready to send.
-            all_ready_to_send = false;
-         }
-      }
-   }
+   bool all_ready_to_send = are_child_threads_ready_to_send( sim_time_micros, id );
 
-   // If the quick look was not successful do a more involved spin-lock with
-   // sleeps, which adds more wait latency.
+   // If the quick look was not successful then spin for a short while before
+   // blocking until the last child thread is ready to send.
    if ( !all_ready_to_send ) {
 
       int64_t      wallclock_time;
+      unsigned int spin_cnt = 0;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout sleep_timer( THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
 
       // Wait for all Trick child threads associated to TrickHLA to be
       // ready to send data.
@@ -574,39 +633,23 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         (void)sleep_timer.sleep();
-
-         // Determine if all the Trick child threads are ready to send data.
-         all_ready_to_send = true;
-         {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            // Check all the associated thread-id's.
-            while ( ( id < this->thread_state_cnt ) && all_ready_to_send ) {
-
-               // If the state is THREAD_STATE_NOT_ASSOCIATED then there are
-               // no TrickHLA jobs on this thread, so move on to the next
-               // thread-id. If the state is THREAD_STATE_READY_TO_SEND then
-               // this thread-id is ready, so check the next ID. Otherwise we
-               // are not ready to send and don't move on from the current
-               // thread-id. Skip this child thread if it is not scheduled to
-               // run at the same time as the main thread for this job.
-               // Also skip if this thread is not on a data cycle boundary.
-               if ( ( this->thread_state[id] == THREAD_STATE_READY_TO_SEND )
-                    || ( this->thread_state[id] == THREAD_STATE_NOT_ASSOCIATED )
-                    || !on_data_cycle_boundary_for_thread( id, sim_time_micros ) ) {
-                  // Move to the next thread-id because the current ID is
-                  // ready. This results in checking all the ID's just once.
-                  ++id;
-               } else {
-                  // Stay on the current ID and indicate not ready to send.
-                  all_ready_to_send = false;
-               }
+         if ( spin_cnt < THLA_THREAD_COORDINATOR_SPIN_COUNT ) {
+            ++spin_cnt;
+            spin_pause();
+         } else {
+            // Register as a waiter before the last check so that a child
+            // thread that becomes ready after the check will wake us.
+            unsigned int const key = main_thread_event.prepare_wait();
+            if ( are_child_threads_ready_to_send( sim_time_micros, id ) ) {
+               main_thread_event.cancel_wait();
+            } else {
+               (void)main_thread_event.wait( key, THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
             }
          }
 
+         // Determine if all the Trick child threads are ready to send data.
+         all_ready_to_send = are_child_threads_ready_to_send( sim_time_micros, id );
+
          if ( !all_ready_to_send ) {
 
             // To be more efficient, we get the time once and share it.
@@ -636,6 +679,14 @@ void TrickThreadCoordinator::wait_to_send_data_for_main_thread()
       } while ( !all_ready_to_send );
    }
 
+   // Keep track of the coordination overhead.
+   int64_t const wait_micros = clock_wall_time() - start_time;
+   ++main_wait_count;
+   main_wait_total_micros += wait_micros;
+   if ( wait_micros > main_wait_max_micros ) {
+      main_wait_max_micros = wait_micros;
+   }
+
    if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       send_hs( stdout, "TrickThreadCoordinator::wait_to_send_data_for_main_thread():%d Done%c",
                __LINE__, THLA_NEWLINE );
@@ -656,45 +707,55 @@ void TrickThreadCoordinator::wait_to_send_data_for_child_thread(
    // Trick Child Threads associated to TrickHLA need to wait for the Trick
    // main thread to send all the HLA data.
 
+   // Mark this child thread as ready to send.
+   unsigned int const prev_state = __atomic_exchange_n( &thread_state[thread_id].state,
+                                                        (unsigned int)THREAD_STATE_READY_TO_SEND,
+                                                        __ATOMIC_SEQ_CST );
+
+   // Only the last child thread the main thread is waiting on needs to wake
+   // it up. A child thread that was not counted when the main thread
+   // announced the data was available always wakes it up to be safe.
+   if ( prev_state == THREAD_STATE_READY_TO_RECEIVE ) {
+      if ( __atomic_sub_fetch( &send_pending_cnt, 1, __ATOMIC_SEQ_CST ) <= 0 ) {
+         main_thread_event.notify_all();
+      }
+   } else if ( prev_state != THREAD_STATE_READY_TO_SEND ) {
+      main_thread_event.notify_all();
+   }
+
    // Do a quick look to determine if the Trick main thread has sent all
    // the HLA data.
-   bool sent_data;
-   {
-      // When auto_unlock_mutex goes out of scope it automatically unlocks
-      // the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
-      // Mark this child thread as ready to send.
-      this->thread_state[thread_id] = THREAD_STATE_READY_TO_SEND;
-
-      // Determine if all the data has been sent by the main thread.
-      sent_data = ( this->thread_state[0] == THREAD_STATE_READY_TO_SEND );
-   }
+   bool sent_data = ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_SEND );
 
    // If the quick look to see if the main thread has announced it has sent
-   // the data has not succeeded then do a more involved spin-lock with a
-   // sleep. This will have more wait latency.
+   // the data has not succeeded then spin for a short while before blocking
+   // until the main thread announces the data was sent.
    if ( !sent_data ) {
 
       int64_t      wallclock_time;
+      unsigned int spin_cnt = 0;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout sleep_timer( THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
 
       // Wait for the main thread to have sent the data.
       do {
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         (void)sleep_timer.sleep();
-
-         {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            sent_data = ( this->thread_state[0] == THREAD_STATE_READY_TO_SEND );
+         if ( spin_cnt < THLA_THREAD_COORDINATOR_SPIN_COUNT ) {
+            ++spin_cnt;
+            spin_pause();
+         } else {
+            unsigned int const key = child_thread_event.prepare_wait();
+            if ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_SEND ) {
+               child_thread_event.cancel_wait();
+            } else {
+               (void)child_thread_event.wait( key, THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
+            }
          }
 
+         sent_data = ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_SEND );
+
          if ( !sent_data ) {
 
             // To be more efficient, we get the time once and share it.
@@ -751,37 +812,35 @@ void TrickThreadCoordinator::wait_to_receive_data()
                thread_id, THLA_NEWLINE );
    }
 
-   bool ready_to_receive;
-   {
-      // When auto_unlock_mutex goes out of scope it automatically unlocks
-      // the mutex even if there is an exception.
-      MutexProtection auto_unlock_mutex( &mutex );
-
-      ready_to_receive = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
-   }
+   bool ready_to_receive = ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_RECEIVE );
 
    // See if the main thread has announced it has received data.
    if ( !ready_to_receive ) {
 
       int64_t      wallclock_time;
+      unsigned int spin_cnt = 0;
       SleepTimeout print_timer( this->federate->wait_status_time );
-      SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
+      SleepTimeout sleep_timer( THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
 
       // Wait for the main thread to receive data.
       do {
          // Check for shutdown.
          this->federate->check_for_shutdown_with_termination();
 
-         (void)sleep_timer.sleep();
-
-         {
-            // When auto_unlock_mutex goes out of scope it automatically
-            // unlocks the mutex even if there is an exception.
-            MutexProtection auto_unlock_mutex( &mutex );
-
-            ready_to_receive = ( this->thread_state[0] == THREAD_STATE_READY_TO_RECEIVE );
+         if ( spin_cnt < THLA_THREAD_COORDINATOR_SPIN_COUNT ) {
+            ++spin_cnt;
+            spin_pause();
+         } else {
+            unsigned int const key = child_thread_event.prepare_wait();
+            if ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_RECEIVE ) {
+               child_thread_event.cancel_wait();
+            } else {
+               (void)child_thread_event.wait( key, THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
+            }
          }
 
+         ready_to_receive = ( get_thread_state( 0 ) == THREAD_STATE_READY_TO_RECEIVE );
+
          if ( !ready_to_receive ) {
 
             // To be more efficient, we get the time once and share it.
@@ -818,6 +877,31 @@ void TrickThreadCoordinator::wait_to_receive_data()
    }
 }
 
+/*!
+ * @details If the state is THREAD_STATE_NOT_ASSOCIATED then there are no
+ * TrickHLA jobs on this thread, so move on to the next thread-id. If the
+ * state is THREAD_STATE_READY_TO_SEND then this thread-id is ready, so check
+ * the next ID. Otherwise we are not ready to send and don't move on from the
+ * current thread-id. Skip this child thread if it is not on a data cycle
+ * boundary. This results in checking all the ID's just once.
+ */
+bool const TrickThreadCoordinator::are_child_threads_ready_to_send(
+   int64_t const sim_time_micros,
+   unsigned int &id ) const
+{
+   while ( id < this->thread_state_cnt ) {
+      unsigned int const state = get_thread_state( id );
+      if ( ( state == THREAD_STATE_READY_TO_SEND )
+           || ( state == THREAD_STATE_NOT_ASSOCIATED )
+           || !on_data_cycle_boundary_for_thread( id, sim_time_micros ) ) {
+         ++id;
+      } else {
+         return false;
+      }
+   }
+   return true;
+}
+
 /*! @brief On boundary if sim-time is an integer multiple of a valid cycle-time. */
 bool const TrickThreadCoordinator::on_data_cycle_boundary_for_thread(
    unsigned int const thread_id,
@@ -856,3 +940,25 @@ int64_t const TrickThreadCoordinator::get_data_cycle_time_micros_for_obj(
              ? this->data_cycle_micros_per_obj[obj_index]
              : default_data_cycle_micros;
 }
+
+/*! @brief Get the Trick thread-id the object instance is associated to. */
+unsigned int const TrickThreadCoordinator::get_thread_id_for_obj(
+   unsigned int const obj_index ) const
+{
+   return ( this->any_child_thread_associated
+            && ( obj_index < this->manager->obj_count ) )
+             ? this->thread_id_per_obj[obj_index]
+             : 0;
+}
+
+string TrickThreadCoordinator::get_summary() const
+{
+   ostringstream msg;
+   msg << "TrickThreadCoordinator: main thread waits:" << main_wait_count
+       << " average wait:"
+       << ( ( main_wait_count > 0 ) ? ( (double)main_wait_total_micros / (double)main_wait_count ) : 0.0 )
+       << " max wait:" << main_wait_max_micros << " microseconds"
+       << " main thread blocks:" << main_thread_event.get_block_count()
+       << " child thread blocks:" << child_thread_event.get_block_count();
+   return msg.str();
+}
@@ -0,0 +1,333 @@
+/*!
+@file TrickHLA/TrickThreadCoordinatorBenchmark.cpp
+@ingroup TrickHLA
+@brief This class measures the wait latency of the Trick main and child
+thread handshake that the TrickThreadCoordinator uses.
+
+@copyright Copyright 2019 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{EventCount.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{TSCTimeline.cpp}
+@trick_link_dependency{TrickThreadCoordinatorBenchmark.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <string>
+#include <time.h>
+#include <vector>
+
+// TrickHLA include files.
+#include "TrickHLA/CompileConfig.hh"
+#include "TrickHLA/EventCount.hh"
+#include "TrickHLA/MutexLock.hh"
+#include "TrickHLA/SleepTimeout.hh"
+#include "TrickHLA/TSCTimeline.hh"
+#include "TrickHLA/TrickThreadCoordinator.hh"
+#include "TrickHLA/TrickThreadCoordinatorBenchmark.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Same CPU pause hint the TrickThreadCoordinator spin waits use.
+inline void spin_pause()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+   __builtin_ia32_pause();
+#else
+   sched_yield();
+#endif
+}
+
+// Shared state of the coordination benchmark, where the main thread announces
+// a frame and waits for all the child threads to see it and respond.
+typedef struct {
+   bool              use_event_count; // False for the original mutex and sleep polling.
+   unsigned int      thread_cnt;      // Number of child threads.
+   unsigned int      frames;          // Number of frames to run.
+   TrickThreadState *state;           // Frame of each thread, where index 0 is the main thread.
+   int               pending_cnt;     // Child threads that have not responded to the frame.
+   int64_t           announce_ns;     // Time the main thread announced the frame.
+   MutexLock         mutex;           // Protects the states for the mutex and sleep polling.
+   EventCount        main_event;      // Wakes the main thread.
+   EventCount        child_event;     // Wakes the child threads.
+} CoordinatorBenchmark;
+
+// Wake latency a benchmark child thread measured.
+typedef struct {
+   CoordinatorBenchmark *bench;
+   unsigned int          thread_id;
+   int64_t               wake_total_ns;
+   int64_t               wake_max_ns;
+} CoordinatorBenchmarkThread;
+
+typedef bool const ( *CoordinatorBenchmarkCondition )( CoordinatorBenchmark &bench,
+                                                        unsigned int const    frame );
+
+bool const is_frame_announced(
+   CoordinatorBenchmark &bench,
+   unsigned int const    frame )
+{
+   return ( __atomic_load_n( &bench.state[0].state, __ATOMIC_SEQ_CST ) == frame );
+}
+
+bool const is_frame_responded(
+   CoordinatorBenchmark &bench,
+   unsigned int const    frame )
+{
+   for ( unsigned int id = 1; id <= bench.thread_cnt; ++id ) {
+      if ( __atomic_load_n( &bench.state[id].state, __ATOMIC_SEQ_CST ) != frame ) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/*!
+ * @brief Wait for the condition the same way the coordinator does, either
+ * spinning and then blocking on the event count, or the original way of
+ * checking under the mutex and sleeping between checks.
+ */
+void coordinator_benchmark_wait(
+   CoordinatorBenchmark               &bench,
+   EventCount                         &event,
+   CoordinatorBenchmarkCondition const condition,
+   unsigned int const                  frame )
+{
+   if ( bench.use_event_count ) {
+      unsigned int spin_cnt = 0;
+      while ( !condition( bench, frame ) ) {
+         if ( spin_cnt < THLA_THREAD_COORDINATOR_SPIN_COUNT ) {
+            ++spin_cnt;
+            spin_pause();
+         } else {
+            unsigned int const key = event.prepare_wait();
+            if ( condition( bench, frame ) ) {
+               event.cancel_wait();
+            } else {
+               (void)event.wait( key, THLA_THREAD_COORDINATOR_WAIT_IN_MICROS );
+            }
+         }
+      }
+   } else {
+      struct timespec const sleep_time = { 0, THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS * 1000L };
+
+      bool done;
+      do {
+         bench.mutex.lock();
+         done = condition( bench, frame );
+         bench.mutex.unlock();
+         if ( !done ) {
+            (void)nanosleep( &sleep_time, NULL );
+         }
+      } while ( !done );
+   }
+}
+
+/*!
+ * @brief Benchmark child thread that waits for each frame and responds.
+ * @return Void pointer and is always NULL.
+ * @param arg The CoordinatorBenchmarkThread of this thread.
+ */
+void *coordinator_benchmark_pthread_function(
+   void *arg )
+{
+   CoordinatorBenchmarkThread *thread = static_cast< CoordinatorBenchmarkThread * >( arg );
+   CoordinatorBenchmark       &bench  = *thread->bench;
+
+   for ( unsigned int frame = 1; frame <= bench.frames; ++frame ) {
+      coordinator_benchmark_wait( bench, bench.child_event, is_frame_announced, frame );
+
+      int64_t const wake_ns = TSCTimeline::get_time_in_nanos()
+                              - __atomic_load_n( &bench.announce_ns, __ATOMIC_SEQ_CST );
+      thread->wake_total_ns += wake_ns;
+      if ( wake_ns > thread->wake_max_ns ) {
+         thread->wake_max_ns = wake_ns;
+      }
+
+      if ( bench.use_event_count ) {
+         __atomic_store_n( &bench.state[thread->thread_id].state, frame, __ATOMIC_SEQ_CST );
+         if ( __atomic_sub_fetch( &bench.pending_cnt, 1, __ATOMIC_SEQ_CST ) <= 0 ) {
+            bench.main_event.notify_all();
+         }
+      } else {
+         bench.mutex.lock();
+         __atomic_store_n( &bench.state[thread->thread_id].state, frame, __ATOMIC_SEQ_CST );
+         bench.mutex.unlock();
+      }
+   }
+   return ( NULL );
+}
+
+/*!
+ * @brief Run the benchmark frames for a number of child threads.
+ * @return The number of child threads that could be started.
+ * @param use_event_count True for the spin and event count waits, false for
+ * the original mutex and sleep polling.
+ * @param thread_cnt      Number of child threads.
+ * @param frames          Number of frames.
+ * @param wake_mean_ns    Mean time for a child thread to see a frame.
+ * @param wake_max_ns     Longest time for a child thread to see a frame.
+ * @param frame_mean_ns   Mean time for all the child threads to respond.
+ */
+unsigned int const run_coordinator_benchmark(
+   bool const         use_event_count,
+   unsigned int const thread_cnt,
+   unsigned int const frames,
+   double            &wake_mean_ns,
+   double            &wake_max_ns,
+   double            &frame_mean_ns )
+{
+   wake_mean_ns  = 0.0;
+   wake_max_ns   = 0.0;
+   frame_mean_ns = 0.0;
+
+   void *state_memory = NULL;
+   if ( posix_memalign( &state_memory, THLA_CACHE_LINE_SIZE,
+                        ( thread_cnt + 1 ) * sizeof( TrickThreadState ) )
+        != 0 ) {
+      return 0;
+   }
+
+   CoordinatorBenchmark bench;
+   bench.use_event_count = use_event_count;
+   bench.thread_cnt      = 0;
+   bench.frames          = frames;
+   bench.state           = (TrickThreadState *)state_memory;
+   bench.pending_cnt     = 0;
+   bench.announce_ns     = 0;
+   memset( bench.state, 0, ( thread_cnt + 1 ) * sizeof( TrickThreadState ) );
+
+   vector< pthread_t >                  pthreads( thread_cnt );
+   vector< CoordinatorBenchmarkThread > threads( thread_cnt );
+   for ( unsigned int i = 0; i < thread_cnt; ++i ) {
+      threads[i].bench         = &bench;
+      threads[i].thread_id     = i + 1;
+      threads[i].wake_total_ns = 0;
+      threads[i].wake_max_ns   = 0;
+      if ( pthread_create( &pthreads[i], NULL,
+                           coordinator_benchmark_pthread_function, &threads[i] )
+           != 0 ) {
+         break;
+      }
+      ++bench.thread_cnt;
+   }
+
+   int64_t frame_total_ns = 0;
+   for ( unsigned int frame = 1; frame <= frames; ++frame ) {
+      __atomic_store_n( &bench.pending_cnt, (int)bench.thread_cnt, __ATOMIC_SEQ_CST );
+
+      int64_t const announce_ns = TSCTimeline::get_time_in_nanos();
+      __atomic_store_n( &bench.announce_ns, announce_ns, __ATOMIC_SEQ_CST );
+      if ( use_event_count ) {
+         __atomic_store_n( &bench.state[0].state, frame, __ATOMIC_SEQ_CST );
+         bench.child_event.notify_all();
+      } else {
+         bench.mutex.lock();
+         __atomic_store_n( &bench.state[0].state, frame, __ATOMIC_SEQ_CST );
+         bench.mutex.unlock();
+      }
+
+      coordinator_benchmark_wait( bench, bench.main_event, is_frame_responded, frame );
+      frame_total_ns += TSCTimeline::get_time_in_nanos() - announce_ns;
+   }
+
+   int64_t wake_total_ns = 0;
+   for ( unsigned int i = 0; i < bench.thread_cnt; ++i ) {
+      pthread_join( pthreads[i], NULL );
+      wake_total_ns += threads[i].wake_total_ns;
+      if ( (double)threads[i].wake_max_ns > wake_max_ns ) {
+         wake_max_ns = (double)threads[i].wake_max_ns;
+      }
+   }
+   free( state_memory );
+
+   if ( ( bench.thread_cnt > 0 ) && ( frames > 0 ) ) {
+      wake_mean_ns  = (double)wake_total_ns / ( (double)bench.thread_cnt * (double)frames );
+      frame_mean_ns = (double)frame_total_ns / (double)frames;
+   }
+   return bench.thread_cnt;
+}
+
+} // namespace
+
+/*!
+ * @details The thread counts double from 1 up to the requested number of
+ * child threads. Running more child threads than there are CPUs measures the
+ * scheduler more than the handshake.
+ */
+string const TrickThreadCoordinatorBenchmark::run(
+   unsigned int const num_threads,
+   unsigned int const frames )
+{
+   unsigned int const max_threads = ( num_threads < 1 ) ? 1
+                                    : ( ( num_threads > THLA_THREAD_COORDINATOR_BENCHMARK_MAX_THREADS )
+                                           ? THLA_THREAD_COORDINATOR_BENCHMARK_MAX_THREADS
+                                           : num_threads );
+   unsigned int const frame_cnt   = ( frames > 0 ) ? frames : 1;
+
+   ostringstream msg;
+   msg << "TrickHLA::TrickThreadCoordinatorBenchmark::run():" << __LINE__
+       << " Wait latency over " << frame_cnt << " frames for 1 to "
+       << max_threads << " child threads." << THLA_ENDL
+       << "  Wake is from the main thread announcing a frame until a child thread" << THLA_ENDL
+       << "  sees it, and frame is until all the child threads have responded." << THLA_ENDL
+       << fixed << setprecision( 2 );
+
+   unsigned int thread_cnt = 1;
+   while ( true ) {
+      double old_wake_mean, old_wake_max, old_frame_mean;
+      double new_wake_mean, new_wake_max, new_frame_mean;
+
+      unsigned int const old_cnt = run_coordinator_benchmark( false, thread_cnt, frame_cnt,
+                                                              old_wake_mean, old_wake_max, old_frame_mean );
+      unsigned int const new_cnt = run_coordinator_benchmark( true, thread_cnt, frame_cnt,
+                                                              new_wake_mean, new_wake_max, new_frame_mean );
+
+      msg << "  " << thread_cnt << " child threads:";
+      if ( ( old_cnt != thread_cnt ) || ( new_cnt != thread_cnt ) ) {
+         msg << " only started " << ( ( old_cnt < new_cnt ) ? old_cnt : new_cnt )
+             << " of the child threads.";
+      }
+      msg << THLA_ENDL
+          << "    Mutex and sleep polling: wake mean " << ( old_wake_mean / 1000.0 )
+          << " max " << ( old_wake_max / 1000.0 )
+          << " frame mean " << ( old_frame_mean / 1000.0 ) << " microseconds" << THLA_ENDL
+          << "    Spin and event count:    wake mean " << ( new_wake_mean / 1000.0 )
+          << " max " << ( new_wake_max / 1000.0 )
+          << " frame mean " << ( new_frame_mean / 1000.0 ) << " microseconds" << THLA_ENDL;
+
+      if ( thread_cnt >= max_threads ) {
+         break;
+      }
+      thread_cnt = ( ( 2 * thread_cnt ) < max_threads ) ? ( 2 * thread_cnt ) : max_threads;
+   }
+
+   return msg.str();
+}
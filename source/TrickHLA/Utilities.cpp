@@ -23,6 +23,9 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, L3 Titan Group, TrickHLA, Aug 2006, --, DSES TrickHLA Utilities.}
 @rev_entry{Dan Dexter, NASA/ER7, TrickHLA, Sept 2010, --, Added Mac FPU control word support.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added UTF-16BE widen/narrow kernels.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added buffer capacity growth policy.}
+@rev_entry{TrickHLA Team, NASA ER7, TrickHLA, October 2026, --, Added memory prefault.}
 @revs_end
 
 */
@@ -30,6 +33,7 @@ NASA, Johnson Space Center\n
 // System include files.
 #include <string>
 #include <time.h>
+#include <unistd.h>
 
 // Trick include files.
 #include "trick/trick_byteswap.h"
@@ -384,6 +388,64 @@ size_t Utilities::next_positive_multiple_of_N(
    return ( ( value >= n ) ? ( n * ( ( value / n ) + 1 ) ) : n );
 }
 
+/*!
+ * @details With geometric growth the capacity at least doubles, which bounds
+ * the number of reallocations for a buffer whose size keeps changing. The
+ * limit keeps a large buffer from doubling past a known high-water mark.
+ */
+size_t Utilities::next_buffer_capacity(
+   size_t const           current,
+   size_t const           requested,
+   BufferGrowthEnum const growth,
+   size_t const           limit )
+{
+   if ( requested <= current ) {
+      return current;
+   }
+   if ( growth != BUFFER_GROWTH_GEOMETRIC ) {
+      return requested;
+   }
+
+   size_t capacity = ( current > 0 ) ? ( 2 * current ) : requested;
+   if ( capacity < requested ) {
+      capacity = requested;
+   }
+   if ( ( limit > 0 ) && ( capacity > limit ) ) {
+      capacity = ( requested > limit ) ? requested : limit;
+   }
+   return capacity;
+}
+
+/*!
+ * @details The restrict qualifiers tell the compiler the input and output do
+ * not alias, which lets it vectorize the interleaved stores instead of
+ * falling back to a byte at a time loop.
+ */
+void Utilities::widen_ascii_to_utf16be(
+   unsigned char *__restrict__       output,
+   unsigned char const *__restrict__ input,
+   size_t const                      length )
+{
+   for ( size_t k = 0; k < length; ++k ) {
+      output[2 * k]         = '\0';
+      output[( 2 * k ) + 1] = input[k];
+   }
+}
+
+/*!
+ * @details Only the low byte of each UTF-16BE character is kept, which is the
+ * same decoding TrickHLA has always used for HLAunicodeString data.
+ */
+void Utilities::narrow_utf16be_to_ascii(
+   unsigned char *__restrict__       output,
+   unsigned char const *__restrict__ input,
+   size_t const                      length )
+{
+   for ( size_t k = 0; k < length; ++k ) {
+      output[k] = input[( 2 * k ) + 1];
+   }
+}
+
 int Utilities::micro_sleep(
    long const usec )
 {
@@ -401,6 +463,29 @@ int Utilities::micro_sleep(
    return nanosleep( &sleep_time, NULL );
 }
 
+void Utilities::prefault_memory(
+   void        *address,
+   size_t const size )
+{
+   if ( ( address == NULL ) || ( size == 0 ) ) {
+      return;
+   }
+
+   static size_t page_size = 0;
+   if ( page_size == 0 ) {
+      long const sys_page_size = sysconf( _SC_PAGESIZE );
+      page_size                = ( sys_page_size > 0 ) ? (size_t)sys_page_size : 4096;
+   }
+
+   // Read and write back a byte of each page, where the volatile keeps the
+   // compiler from removing the write that forces a writable page.
+   volatile unsigned char *bytes = (volatile unsigned char *)address;
+   for ( size_t i = 0; i < size; i += page_size ) {
+      bytes[i] = bytes[i];
+   }
+   bytes[size - 1] = bytes[size - 1];
+}
+
 string Utilities::get_version()
 {
    return TRICKHLA_VERSION;